@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# Copyright (C) 2023 by the authors listed in the AUTHORS file at
+# https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+#
+# This file is part of Bitwuzla under the MIT license. See COPYING for more
+# information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+##
+
+# Solve all benchmarks in a directory and report timings and statistics as
+# JSON. Optionally compare the results against a previously recorded run.
+#
+# Record a baseline:
+#   run-benchmarks.py build/src/main/bitwuzla benchmarks/ -o base.json
+# Compare a later run against the baseline:
+#   run-benchmarks.py build/src/main/bitwuzla benchmarks/ -o new.json \
+#     --compare base.json
+
+import argparse
+import datetime
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+EXTENSIONS = ('.smt2', '.btor2')
+RESULTS = ('sat', 'unsat', 'unknown')
+# Statistics are printed as '<component>::<name>: <value>' on verbosity > 0.
+RE_STAT = re.compile(r'^([A-Za-z_]\w*(?:::\w+)+): (.*)$')
+
+
+def collect(path):
+    if os.path.isfile(path):
+        return [path]
+    files = []
+    for root, _, names in os.walk(path):
+        for name in names:
+            if name.endswith(EXTENSIONS):
+                files.append(os.path.join(root, name))
+    return sorted(files)
+
+
+def parse_value(value):
+    for conv in (int, float):
+        try:
+            return conv(value)
+        except ValueError:
+            pass
+    return value
+
+
+def run(binary, solver_args, path, timeout):
+    cmd = [binary, '-v'] + solver_args + [path]
+    start = time.perf_counter()
+    try:
+        proc = subprocess.run(cmd,
+                              stdout=subprocess.PIPE,
+                              stderr=subprocess.PIPE,
+                              timeout=timeout)
+    except subprocess.TimeoutExpired:
+        return {'status': 'timeout', 'time': timeout, 'statistics': {}}
+    elapsed = time.perf_counter() - start
+
+    results = []
+    stats = {}
+    for line in proc.stdout.decode(errors='replace').splitlines():
+        line = line.strip()
+        if line in RESULTS:
+            results.append(line)
+            continue
+        m = RE_STAT.match(line)
+        if m:
+            stats[m.group(1)] = parse_value(m.group(2))
+
+    if proc.returncode != 0:
+        status = 'error'
+    elif not results:
+        status = 'unknown'
+    else:
+        # Incremental benchmarks report one result per check-sat call.
+        status = ' '.join(results)
+    res = {'status': status, 'time': elapsed, 'statistics': stats}
+    if status == 'error':
+        res['error'] = proc.stderr.decode(errors='replace').strip()
+    return res
+
+
+def solved(status):
+    return status not in ('timeout', 'error', 'unknown') \
+        and 'unknown' not in status.split()
+
+
+def compare(baseline, current, threshold, min_diff):
+    base = {b['name']: b for b in baseline['benchmarks']}
+    regressions = []
+    print(f'{"benchmark":<60} {"base":>10} {"new":>10} {"change":>8}',
+          file=sys.stderr)
+    for b in current['benchmarks']:
+        name = b['name']
+        if name not in base:
+            continue
+        old = base[name]
+        t_old, t_new = old['time'], b['time']
+        change = (t_new - t_old) / t_old if t_old > 0 else 0.0
+        regressed = False
+        if solved(old['status']) and not solved(b['status']):
+            regressed = True
+        elif solved(old['status']) and solved(b['status']) \
+                and old['status'] != b['status']:
+            # Different results are always reported.
+            regressed = True
+        elif change > threshold and t_new - t_old > min_diff:
+            regressed = True
+        if regressed:
+            regressions.append(name)
+        mark = ' !' if regressed else ''
+        print(f'{name:<60} {t_old:>10.3f} {t_new:>10.3f} {change:>+8.1%}'
+              f'{mark}', file=sys.stderr)
+    t_old = sum(b['time'] for b in baseline['benchmarks'])
+    t_new = sum(b['time'] for b in current['benchmarks'])
+    print(f'{"total":<60} {t_old:>10.3f} {t_new:>10.3f}', file=sys.stderr)
+    print(f'{len(regressions)} regression(s)', file=sys.stderr)
+    return regressions
+
+
+def main():
+    ap = argparse.ArgumentParser(
+        description='Solve benchmarks and report timings as JSON.')
+    ap.add_argument('binary', help='the Bitwuzla binary')
+    ap.add_argument('benchmarks',
+                    help='benchmark file or directory (searched recursively '
+                         'for *.smt2 and *.btor2 files)')
+    ap.add_argument('-t', '--timeout', type=float, default=60,
+                    help='time limit per benchmark in seconds')
+    ap.add_argument('-a', '--args', default='',
+                    help='additional options passed to the solver')
+    ap.add_argument('-o', '--output', help='write JSON results to file')
+    ap.add_argument('--compare', metavar='BASELINE',
+                    help='compare against JSON results of previous run, '
+                         'exits with 1 on regressions')
+    ap.add_argument('--threshold', type=float, default=0.1,
+                    help='relative slowdown reported as regression')
+    ap.add_argument('--min-diff', type=float, default=0.1,
+                    help='minimum absolute slowdown in seconds reported as '
+                         'regression')
+    args = ap.parse_args()
+
+    files = collect(args.benchmarks)
+    if not files:
+        sys.exit(f'no benchmarks found in {args.benchmarks}')
+
+    solver_args = args.args.split()
+    benchmarks = []
+    for i, path in enumerate(files):
+        name = os.path.relpath(path, args.benchmarks) \
+            if os.path.isdir(args.benchmarks) else os.path.basename(path)
+        res = {'name': name}
+        res.update(run(args.binary, solver_args, path, args.timeout))
+        benchmarks.append(res)
+        print(f'[{i + 1}/{len(files)}] {res["name"]}: {res["status"]} '
+              f'{res["time"]:.3f}s', file=sys.stderr)
+
+    results = {
+        'context': {
+            'date': datetime.datetime.now().isoformat(),
+            'binary': os.path.abspath(args.binary),
+            'args': solver_args,
+            'timeout': args.timeout,
+        },
+        'summary': {
+            'benchmarks': len(benchmarks),
+            'solved': sum(1 for b in benchmarks if solved(b['status'])),
+            'timeouts': sum(1 for b in benchmarks if b['status'] == 'timeout'),
+            'errors': sum(1 for b in benchmarks if b['status'] == 'error'),
+            'time': sum(b['time'] for b in benchmarks),
+        },
+        'benchmarks': benchmarks,
+    }
+
+    if args.output:
+        with open(args.output, 'w') as outfile:
+            json.dump(results, outfile, indent=2)
+    else:
+        json.dump(results, sys.stdout, indent=2)
+        print()
+
+    if args.compare:
+        with open(args.compare, 'r') as infile:
+            baseline = json.load(infile)
+        if compare(baseline, results, args.threshold, args.min_diff):
+            sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,171 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig_bitblaster.h"
+
+namespace bzla::bench {
+
+using namespace bitblast;
+
+namespace {
+
+/** SAT interface that only counts the added literals. */
+class CountingSatSolver : public SatInterface
+{
+ public:
+  void add(int64_t lit) override { d_num_lits += lit != 0; }
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    d_num_lits += literals.size();
+  }
+  bool value(int64_t lit) override
+  {
+    (void) lit;
+    return false;
+  }
+  uint64_t num_lits() const { return d_num_lits; }
+
+ private:
+  uint64_t d_num_lits = 0;
+};
+
+enum class Op
+{
+  ADD,
+  MUL,
+  UDIV,
+  SHL,
+  ULT,
+};
+
+AigBitblaster::Bits
+mk_circuit(AigBitblaster& bb, Op op, size_t size)
+{
+  auto a = bb.bv_constant(size);
+  auto b = bb.bv_constant(size);
+  switch (op)
+  {
+    case Op::ADD: return bb.bv_add(a, b);
+    case Op::MUL: return bb.bv_mul(a, b);
+    case Op::UDIV: return bb.bv_udiv(a, b);
+    case Op::SHL: return bb.bv_shl(a, b);
+    default: return bb.bv_ult(a, b);
+  }
+}
+
+/** Bit-blast operation `op` of bit-width range(0). */
+void
+bench_bitblast(benchmark::State& state, Op op)
+{
+  size_t size = static_cast<size_t>(state.range(0));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto bb = std::make_unique<AigBitblaster>();
+    state.ResumeTiming();
+    {
+      auto bits = mk_circuit(*bb, op, size);
+      benchmark::DoNotOptimize(bits);
+      state.counters["ands"] = static_cast<double>(bb->num_aig_ands());
+      state.PauseTiming();
+    }
+    bb.reset();
+    state.ResumeTiming();
+  }
+}
+
+/** CNF encode the circuit of operation `op` of bit-width range(0). */
+void
+bench_encode(benchmark::State& state, Op op)
+{
+  size_t size = static_cast<size_t>(state.range(0));
+  AigBitblaster bb;
+  auto bits = mk_circuit(bb, op, size);
+  for (auto _ : state)
+  {
+    CountingSatSolver sat;
+    AigCnfEncoder cnf(sat);
+    for (const auto& bit : bits)
+    {
+      cnf.encode(bit, true);
+    }
+    benchmark::DoNotOptimize(sat.num_lits());
+    state.counters["clauses"] =
+        static_cast<double>(cnf.statistics().num_clauses);
+  }
+}
+
+}  // namespace
+
+void
+BM_bitblast_add(benchmark::State& state)
+{
+  bench_bitblast(state, Op::ADD);
+}
+
+void
+BM_bitblast_mul(benchmark::State& state)
+{
+  bench_bitblast(state, Op::MUL);
+}
+
+void
+BM_bitblast_udiv(benchmark::State& state)
+{
+  bench_bitblast(state, Op::UDIV);
+}
+
+void
+BM_bitblast_shl(benchmark::State& state)
+{
+  bench_bitblast(state, Op::SHL);
+}
+
+void
+BM_bitblast_ult(benchmark::State& state)
+{
+  bench_bitblast(state, Op::ULT);
+}
+
+void
+BM_encode_add(benchmark::State& state)
+{
+  bench_encode(state, Op::ADD);
+}
+
+void
+BM_encode_mul(benchmark::State& state)
+{
+  bench_encode(state, Op::MUL);
+}
+
+void
+BM_encode_udiv(benchmark::State& state)
+{
+  bench_encode(state, Op::UDIV);
+}
+
+BENCHMARK(BM_bitblast_add)->Arg(32)->Arg(256);
+BENCHMARK(BM_bitblast_mul)->Arg(32)->Arg(64);
+BENCHMARK(BM_bitblast_udiv)->Arg(32)->Arg(64);
+BENCHMARK(BM_bitblast_shl)->Arg(32)->Arg(256);
+BENCHMARK(BM_bitblast_ult)->Arg(32)->Arg(256);
+BENCHMARK(BM_encode_add)->Arg(32)->Arg(256);
+BENCHMARK(BM_encode_mul)->Arg(32)->Arg(64);
+BENCHMARK(BM_encode_udiv)->Arg(32)->Arg(64);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
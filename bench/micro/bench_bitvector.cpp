@@ -0,0 +1,154 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "bv/bitvector.h"
+#include "rng/rng.h"
+
+namespace bzla::bench {
+
+namespace {
+
+/** The number of operand pairs a benchmark iterates over. */
+constexpr size_t s_num_operands = 1024;
+
+/** Generate random operands of given size, divisors are non-zero. */
+std::vector<BitVector>
+mk_operands(uint64_t size, bool non_zero = false)
+{
+  RNG rng(42);
+  std::vector<BitVector> res;
+  res.reserve(s_num_operands);
+  while (res.size() < s_num_operands)
+  {
+    BitVector bv(size, rng);
+    if (non_zero && bv.is_zero())
+    {
+      continue;
+    }
+    res.push_back(bv);
+  }
+  return res;
+}
+
+/** Benchmark binary in-place operation `fun` on operands of size range(0). */
+template <typename Fun>
+void
+bench_binary(benchmark::State& state, Fun fun, bool non_zero = false)
+{
+  uint64_t size                  = static_cast<uint64_t>(state.range(0));
+  std::vector<BitVector> lhs     = mk_operands(size);
+  std::vector<BitVector> rhs     = mk_operands(size, non_zero);
+  BitVector res(size);
+  size_t i = 0;
+  for (auto _ : state)
+  {
+    fun(res, lhs[i], rhs[i]);
+    benchmark::DoNotOptimize(res);
+    i = (i + 1) % s_num_operands;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+void
+BM_bv_add(benchmark::State& state)
+{
+  bench_binary(state, [](BitVector& r, const BitVector& a, const BitVector& b) {
+    r.ibvadd(a, b);
+  });
+}
+
+void
+BM_bv_and(benchmark::State& state)
+{
+  bench_binary(state, [](BitVector& r, const BitVector& a, const BitVector& b) {
+    r.ibvand(a, b);
+  });
+}
+
+void
+BM_bv_mul(benchmark::State& state)
+{
+  bench_binary(state, [](BitVector& r, const BitVector& a, const BitVector& b) {
+    r.ibvmul(a, b);
+  });
+}
+
+void
+BM_bv_udiv(benchmark::State& state)
+{
+  bench_binary(
+      state,
+      [](BitVector& r, const BitVector& a, const BitVector& b) {
+        r.ibvudiv(a, b);
+      },
+      true);
+}
+
+void
+BM_bv_ult(benchmark::State& state)
+{
+  bench_binary(state, [](BitVector& r, const BitVector& a, const BitVector& b) {
+    r.ibvult(a, b);
+  });
+}
+
+void
+BM_bv_shl(benchmark::State& state)
+{
+  bench_binary(state, [](BitVector& r, const BitVector& a, const BitVector& b) {
+    r.ibvshl(a, b);
+  });
+}
+
+void
+BM_bv_concat_extract(benchmark::State& state)
+{
+  bench_binary(state, [](BitVector& r, const BitVector& a, const BitVector& b) {
+    r.ibvconcat(a, b).ibvextract(a.size() + a.size() / 2, a.size() / 2);
+  });
+}
+
+void
+BM_bv_copy(benchmark::State& state)
+{
+  uint64_t size              = static_cast<uint64_t>(state.range(0));
+  std::vector<BitVector> ops = mk_operands(size);
+  size_t i                   = 0;
+  for (auto _ : state)
+  {
+    BitVector copy(ops[i]);
+    benchmark::DoNotOptimize(copy);
+    i = (i + 1) % s_num_operands;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Bit-widths cover the uint64_t, the inline limbs and the GMP representation.
+#define BZLA_BV_SIZES \
+  Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(1024)->Arg(4096)
+
+BENCHMARK(BM_bv_add)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_and)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_mul)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_udiv)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_ult)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_shl)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_concat_extract)->BZLA_BV_SIZES;
+BENCHMARK(BM_bv_copy)->BZLA_BV_SIZES;
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
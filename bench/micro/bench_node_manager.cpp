@@ -0,0 +1,110 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "node/node_manager.h"
+
+namespace bzla::bench {
+
+using namespace node;
+
+namespace {
+
+/**
+ * Create a DAG of range(0) bit-vector nodes over 16 constants, each node
+ * combines the two most recently created nodes.
+ */
+std::vector<Node>
+mk_dag(NodeManager& nm, size_t num_nodes)
+{
+  Type bv32 = nm.mk_bv_type(32);
+  std::vector<Node> nodes;
+  nodes.reserve(num_nodes + 16);
+  for (size_t i = 0; i < 16; ++i)
+  {
+    nodes.push_back(nm.mk_const(bv32));
+  }
+  const Kind kinds[] = {Kind::BV_ADD, Kind::BV_AND, Kind::BV_MUL, Kind::BV_XOR};
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    size_t n = nodes.size();
+    nodes.push_back(nm.mk_node(kinds[i % 4], {nodes[n - 1], nodes[n - 2]}));
+  }
+  return nodes;
+}
+
+}  // namespace
+
+/** Create new nodes, includes allocation and insertion into the unique table. */
+void
+BM_mk_node_new(benchmark::State& state)
+{
+  size_t num_nodes = static_cast<size_t>(state.range(0));
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto nm = std::make_unique<NodeManager>();
+    state.ResumeTiming();
+    {
+      std::vector<Node> nodes = mk_dag(*nm, num_nodes);
+      benchmark::DoNotOptimize(nodes);
+      state.PauseTiming();
+    }
+    nm.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/** Create existing nodes, measures unique table lookups. */
+void
+BM_mk_node_lookup(benchmark::State& state)
+{
+  size_t num_nodes = static_cast<size_t>(state.range(0));
+  NodeManager nm;
+  std::vector<Node> nodes = mk_dag(nm, num_nodes);
+  for (auto _ : state)
+  {
+    for (size_t i = 16, n = nodes.size(); i < n; ++i)
+    {
+      Node res = nm.mk_node(nodes[i].kind(), {nodes[i][0], nodes[i][1]});
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/** Release nodes, measures reference counting and garbage collection. */
+void
+BM_node_gc(benchmark::State& state)
+{
+  size_t num_nodes = static_cast<size_t>(state.range(0));
+  NodeManager nm;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    std::vector<Node> nodes = mk_dag(nm, num_nodes);
+    state.ResumeTiming();
+    nodes.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+BENCHMARK(BM_mk_node_new)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_mk_node_lookup)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_node_gc)->Arg(1 << 10)->Arg(1 << 16);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include "env.h"
+#include "node/node_manager.h"
+#include "rewrite/rewriter.h"
+
+namespace bzla::bench {
+
+using namespace node;
+
+namespace {
+
+/**
+ * Create a bit-vector DAG of `num_nodes` nodes that contains rewritable
+ * patterns (neutral elements, double negation, extracts over concats,
+ * comparisons of equal terms) interleaved with non-rewritable operations.
+ */
+Node
+mk_dag(NodeManager& nm, size_t num_nodes)
+{
+  Type bv32  = nm.mk_bv_type(32);
+  Node zero  = nm.mk_value(BitVector::mk_zero(32));
+  Node one   = nm.mk_value(BitVector::mk_one(32));
+  Node ones  = nm.mk_value(BitVector::mk_ones(32));
+  std::vector<Node> nodes;
+  for (size_t i = 0; i < 8; ++i)
+  {
+    nodes.push_back(nm.mk_const(bv32));
+  }
+  for (size_t i = 0; i < num_nodes; ++i)
+  {
+    size_t n = nodes.size();
+    const Node& a = nodes[n - 1];
+    const Node& b = nodes[n - 2];
+    Node res;
+    switch (i % 8)
+    {
+      case 0: res = nm.mk_node(Kind::BV_ADD, {a, zero}); break;
+      case 1: res = nm.mk_node(Kind::BV_MUL, {one, a}); break;
+      case 2:
+        res = nm.mk_node(Kind::BV_NOT, {nm.mk_node(Kind::BV_NOT, {a})});
+        break;
+      case 3: res = nm.mk_node(Kind::BV_AND, {a, ones}); break;
+      case 4:
+        res = nm.mk_node(Kind::BV_EXTRACT,
+                         {nm.mk_node(Kind::BV_CONCAT, {a, b})},
+                         {31, 0});
+        break;
+      case 5:
+        res = nm.mk_node(Kind::ITE,
+                         {nm.mk_node(Kind::EQUAL, {a, a}), b, a});
+        break;
+      case 6: res = nm.mk_node(Kind::BV_XOR, {a, b}); break;
+      default: res = nm.mk_node(Kind::BV_ADD, {a, b});
+    }
+    nodes.push_back(res);
+  }
+  return nodes.back();
+}
+
+}  // namespace
+
+/** Rewrite a DAG with a fresh rewriter, i.e., with an empty cache. */
+void
+BM_rewrite(benchmark::State& state)
+{
+  size_t num_nodes = static_cast<size_t>(state.range(0));
+  NodeManager nm;
+  Node dag = mk_dag(nm, num_nodes);
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto env = std::make_unique<Env>(nm);
+    state.ResumeTiming();
+    const Node& res = env->rewriter().rewrite(dag);
+    benchmark::DoNotOptimize(res);
+    state.PauseTiming();
+    env.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * num_nodes);
+}
+
+/** Rewrite an already rewritten DAG, measures rewrite cache lookups. */
+void
+BM_rewrite_cached(benchmark::State& state)
+{
+  size_t num_nodes = static_cast<size_t>(state.range(0));
+  NodeManager nm;
+  Env env(nm);
+  Node dag = mk_dag(nm, num_nodes);
+  env.rewriter().rewrite(dag);
+  for (auto _ : state)
+  {
+    const Node& res = env.rewriter().rewrite(dag);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_rewrite)->Arg(1 << 10)->Arg(1 << 14);
+BENCHMARK(BM_rewrite_cached)->Arg(1 << 10);
+
+}  // namespace bzla::bench
+
+BENCHMARK_MAIN();
@@ -89,6 +89,7 @@ def main():
     bool_opt(ap, 'testing', 'regression and unit testing')
     bool_opt(ap, 'unit-testing', 'unit testing')
     bool_opt(ap, 'docs', 'documentation')
+    bool_opt(ap, 'benchmarks', 'micro-benchmarks')
     ap.add_argument('--wipe', action='store_true',
                     help='delete build directory if it already exists')
     bool_opt(ap, 'kissat', 'Kissat support')
@@ -134,6 +135,8 @@ def main():
         build_opts.append(f'-Dpython={_bool(args.python)}')
     if args.docs is not None:
         build_opts.append(f'-Ddocs={_bool(args.docs)}')
+    if args.benchmarks is not None:
+        build_opts.append(f'-Dbenchmarks={_bool(args.benchmarks)}')
     if sanitize:
         build_opts.append(f'-Db_sanitize={",".join(sanitize)}')
     if args.wipe and os.path.exists(args.build_dir):
@@ -76,6 +76,21 @@ void bitwuzla_parser_delete(BitwuzlaParser* parser);
 void bitwuzla_parser_configure_auto_print_model(BitwuzlaParser* parser,
                                                 bool value);
 
+/**
+ * Configure the maximum bound for bounded model checking of sequential
+ * BTOR2 models (models with `state` declarations or `justice` properties).
+ *
+ * Bad state properties and justice properties are checked incrementally for
+ * bounds 0 to `bound`.
+ *
+ * @note By default, the maximum bound is 20. Ignored for SMT-LIB2 input.
+ *
+ * @param parser The Bitwuzla parser instance.
+ * @param bound  The maximum bound.
+ */
+void bitwuzla_parser_configure_bmc_bound(BitwuzlaParser* parser,
+                                         uint64_t bound);
+
 /**
  * Parse input, either from a file or from a string.
  *
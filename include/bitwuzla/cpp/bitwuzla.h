@@ -1077,6 +1077,17 @@ class TermManager
   friend Bitwuzla;
 
   TermManager();
+  /**
+   * Constructor.
+   *
+   * A thread-safe term manager supports concurrent term and sort creation
+   * from several threads, and can be shared between Bitwuzla instances that
+   * run on different threads. Each Bitwuzla instance must only be used by one
+   * thread at a time.
+   *
+   * @param thread_safe True to create a thread-safe term manager.
+   */
+  explicit TermManager(bool thread_safe);
   ~TermManager();
 
   /** Disallow copy construction. */
@@ -83,6 +83,18 @@ class Parser
    * @param value True to enable auto printing of the model.
    */
   void configure_auto_print_model(bool value);
+  /**
+   * Configure the maximum bound for bounded model checking of sequential
+   * BTOR2 models (models with `state` declarations or `justice` properties).
+   *
+   * Bad state properties and justice properties are checked incrementally for
+   * bounds 0 to `bound`.
+   *
+   * @note By default, the maximum bound is 20. Ignored for SMT-LIB2 input.
+   *
+   * @param bound The maximum bound.
+   */
+  void configure_bmc_bound(uint64_t bound);
   /**
    * Parse input, either from a file or from a string.
    * @param input      The name of the input file if `parse_file` is true,
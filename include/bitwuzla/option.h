@@ -101,6 +101,12 @@ enum ENUM(Option)
    */
   EVALUE(MEMORY_LIMIT),
   /*! ** Number of parallel threads.**
+   *
+   * If greater than 1, enables the parallel portfolio mode, which runs the
+   * given number of differently configured solver instances on separate
+   * threads. The first instance that determines a result wins. If
+   * cube-and-conquer is enabled (see Option::CUBE_DEPTH), the threads are
+   * used for solving cubes instead.
    *
    * Values:
    *  * An unsigned integer > 0. [**default**: 1]
@@ -143,6 +149,18 @@ enum ENUM(Option)
    *  @warning This is an expert option to configure rewriting.
    */
   EVALUE(REWRITE_LEVEL),
+  /*! **Memory limit of the rewriter cache in MB.**
+   *
+   * The rewriter cache is kept across satisfiability checks. If it exceeds
+   * the given limit, the least recently used cache entries are evicted.
+   *
+   * Values:
+   *  * An unsigned integer for the limit in MB, 0 for no limit.
+   *    [**default**: 256]
+   *
+   *  @warning This is an expert option to configure rewriting.
+   */
+  EVALUE(REWRITE_CACHE_LIMIT),
   /*! **Configure the SAT solver engine.**
    *
    * Values:
@@ -154,6 +172,94 @@ enum ENUM(Option)
    *    [Kissat](https://github.com/arminbiere/kissat)
    */
   EVALUE(SAT_SOLVER),
+  /*! **Check theory lemmas during SAT search.**
+   *
+   * Check assignments of the bit-blasted formula against the array, function,
+   * floating-point and abstraction theories while the SAT solver is still
+   * searching, and add lemmas to the running search instead of restarting it.
+   * Partial assignments are checked as soon as all bits read by the previous
+   * check are assigned. Only supported with CaDiCaL as SAT solver.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure theory solvers.
+   */
+  EVALUE(LEMMAS_IN_SEARCH),
+  /*! **Cube-and-conquer in the bit-blasting solver.**
+   *
+   * If greater than 0, the bit-blasting solver selects the given number of
+   * high-fanout AIG nodes as splitting variables and solves the resulting
+   * cubes as assumptions on independent instances of the configured SAT
+   * solver (see Option::SAT_SOLVER), which must support incremental solving.
+   * Cubes are distributed over `nthreads` threads (see Option::NTHREADS),
+   * the parallel portfolio mode is disabled in this mode.
+   *
+   * Values:
+   *  * An unsigned integer <= 16. [**default**: 0]
+   *
+   *  @warning This is an expert option to configure the bit-blasting solver.
+   */
+  EVALUE(CUBE_DEPTH),
+  /*! **Share bit-blasted terms between solver instances.**
+   *
+   * If enabled, the AIG cones of terms bit-blasted by the bit-blasting solver
+   * are stored in a cache that is owned by the term manager. Solver instances
+   * that use the same term manager and have this option enabled import the
+   * CNF encoding of cached terms instead of bit-blasting them again. The
+   * cache is thread-safe and grows with the number of shared terms.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the bit-blasting solver.
+   */
+  EVALUE(SHARED_BITBLAST_CACHE),
+  /*! **Fraiging in the bit-blasting solver.**
+   *
+   * Before encoding the bit-blasted assertions to CNF, merge functionally
+   * equivalent AIG nodes. Candidates are determined by bit-parallel random
+   * simulation and proven equivalent with incremental SAT calls
+   * (SAT sweeping). Useful for equivalence checking problems.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the bit-blasting solver.
+   */
+  EVALUE(FRAIG),
+  /*! **Scoped bit-blasting in the bit-blasting solver.**
+   *
+   * If enabled, terms bit-blasted within a scope (see Bitwuzla::push()) are
+   * released when the scope is popped, together with their AIG nodes.
+   * Clauses of the CNF encoding added within a scope are guarded by an
+   * activation literal and disabled when the scope is popped. Useful for
+   * long-running incremental sessions with many push/pop cycles.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the bit-blasting solver.
+   */
+  EVALUE(SCOPED_BITBLAST),
+  /*! **Number of threads for model-based quantifier instantiation.**
+   *
+   * If greater than 1, the quantifier solver distributes the quantifiers
+   * over the given number of MBQI workers and checks their instances in
+   * parallel on separate threads. Each worker maintains its own solver
+   * instance and term manager. The instantiation lemmas of all workers are
+   * added in a single round.
+   *
+   * Values:
+   *  * An unsigned integer > 0 and <= 64. [**default**: 1]
+   *
+   *  @warning This is an expert option to configure the quantifier solver.
+   */
+  EVALUE(MBQI_NTHREADS),
 
   /* ---------------- BV: Prop Engine Options (Expert) ---------------------- */
 
@@ -194,6 +300,22 @@ enum ENUM(Option)
    *  @warning This is an expert option to configure the prop solver engine.
    */
   EVALUE(PROP_NPROPS),
+  /*! **Propagation-based local search solver engine:
+   *    Number of parallel workers.**
+   *
+   * If greater than 1, the propagation-based local search solver engine
+   * runs the given number of independent local search workers on separate
+   * threads. Each worker maintains its own copy of the local search graph and
+   * uses a different seed, path selection mode and probability for inverse
+   * value selection. The first worker that satisfies all roots provides the
+   * model.
+   *
+   * Values:
+   *  * An unsigned integer > 0 and <= 64. [**default**: 1]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  EVALUE(PROP_NTHREADS),
   /*! **Propagation-based local search solver engine:
    *    Number of updates.**
    *
@@ -84,6 +84,15 @@ bitwuzla_parser_configure_auto_print_model(BitwuzlaParser* parser, bool value)
   BITWUZLA_C_TRY_CATCH_END;
 }
 
+void
+bitwuzla_parser_configure_bmc_bound(BitwuzlaParser* parser, uint64_t bound)
+{
+  BITWUZLA_C_TRY_CATCH_BEGIN;
+  BITWUZLA_CHECK_NOT_NULL(parser);
+  parser->d_parser->configure_bmc_bound(bound);
+  BITWUZLA_C_TRY_CATCH_END;
+}
+
 void
 bitwuzla_parser_parse(BitwuzlaParser* parser,
                       const char* input,
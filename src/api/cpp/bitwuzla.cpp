@@ -72,12 +72,22 @@ static const std::unordered_map<Option, bzla::option::Option>
         {Option::NTHREADS, bzla::option::Option::NTHREADS},
         {Option::RELEVANT_TERMS, bzla::option::Option::RELEVANT_TERMS},
         {Option::REWRITE_LEVEL, bzla::option::Option::REWRITE_LEVEL},
+        {Option::REWRITE_CACHE_LIMIT,
+         bzla::option::Option::REWRITE_CACHE_LIMIT},
+        {Option::LEMMAS_IN_SEARCH, bzla::option::Option::LEMMAS_IN_SEARCH},
+        {Option::CUBE_DEPTH, bzla::option::Option::CUBE_DEPTH},
+        {Option::SHARED_BITBLAST_CACHE,
+         bzla::option::Option::SHARED_BITBLAST_CACHE},
+        {Option::FRAIG, bzla::option::Option::FRAIG},
+        {Option::SCOPED_BITBLAST, bzla::option::Option::SCOPED_BITBLAST},
+        {Option::MBQI_NTHREADS, bzla::option::Option::MBQI_NTHREADS},
         {Option::PROP_CONST_BITS, bzla::option::Option::PROP_CONST_BITS},
         {Option::PROP_INFER_INEQ_BOUNDS,
          bzla::option::Option::PROP_INEQ_BOUNDS},
         {Option::PROP_OPT_LT_CONCAT_SEXT,
          bzla::option::Option::PROP_OPT_LT_CONCAT_SEXT},
         {Option::PROP_NPROPS, bzla::option::Option::PROP_NPROPS},
+        {Option::PROP_NTHREADS, bzla::option::Option::PROP_NTHREADS},
         {Option::PROP_NUPDATES, bzla::option::Option::PROP_NUPDATES},
         {Option::PROP_PATH_SEL, bzla::option::Option::PROP_PATH_SEL},
         {Option::PROP_PROB_RANDOM_INPUT,
@@ -1674,6 +1684,11 @@ Bitwuzla::solver_state_change()
 
 TermManager::TermManager() : d_nm(new bzla::NodeManager()) {}
 
+TermManager::TermManager(bool thread_safe)
+    : d_nm(new bzla::NodeManager(thread_safe))
+{
+}
+
 TermManager::~TermManager() {}
 
 Sort
@@ -65,6 +65,13 @@ Parser::configure_auto_print_model(bool value)
   d_parser->configure_auto_print_model(value);
 }
 
+void
+Parser::configure_bmc_bound(uint64_t bound)
+{
+  assert(d_parser);
+  d_parser->configure_bmc_bound(bound);
+}
+
 void
 Parser::parse(const std::string &infile_name,
               std::istream &input,
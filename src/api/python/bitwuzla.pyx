@@ -1553,6 +1553,20 @@ cdef class Parser:
         """
         self.c_parser.get().configure_auto_print_model(value)
 
+    def configure_bmc_bound(self, bound: int):
+        """Configure the maximum bound for bounded model checking of
+           sequential BTOR2 models (models with `state` declarations or
+           `justice` properties).
+
+           Bad state properties and justice properties are checked
+           incrementally for bounds 0 to `bound`.
+
+           :note: By default, the maximum bound is 20. Ignored for SMT-LIB2
+                  input.
+           :param bound: The maximum bound.
+        """
+        self.c_parser.get().configure_bmc_bound(bound)
+
     def parse(self,
               iinput,
               parse_only: bool = False,
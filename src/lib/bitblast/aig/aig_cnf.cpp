@@ -23,11 +23,11 @@ AigCnfEncoder::encode(const AigNode& node, bool top_level)
   if (top_level)
   {
     std::unordered_set<int64_t> cache;
-    std::vector<std::reference_wrapper<const AigNode>> visit{node};
-    std::vector<std::reference_wrapper<const AigNode>> children;
+    std::vector<AigNode> visit{node};
+    std::vector<AigNode> children;
     do
     {
-      const AigNode& cur = visit.back();
+      AigNode cur = visit.back();
       visit.pop_back();
 
       auto [it, inserted] = cache.insert(cur.get_id());
@@ -44,23 +44,41 @@ AigCnfEncoder::encode(const AigNode& node, bool top_level)
       else
       {
         children.push_back(cur);
-        _encode(cur);
+        // Asserted literals only need to be encoded in their polarity.
+        _encode(cur, cur.is_negated() ? NEG : POS);
       }
     } while (!visit.empty());
     assert(!children.empty());
 
     for (const AigNode& child : children)
     {
-      d_sat_solver.add_clause({child.get_id()});
-      ++d_statistics.num_clauses;
+      add_clause({child.get_id()});
     }
   }
   else
   {
-    _encode(node);
+    _encode(node, BOTH);
   }
 }
 
+void
+AigCnfEncoder::encode_assumption(const AigNode& node)
+{
+  _encode(node, node.is_negated() ? NEG : POS);
+}
+
+bool
+AigCnfEncoder::is_encoded(int64_t lit) const
+{
+  assert(lit != 0);
+  size_t pos = static_cast<size_t>(std::abs(lit) - 1);
+  if (pos < d_aig_polarity.size())
+  {
+    return d_aig_polarity[pos] & (lit < 0 ? NEG : POS);
+  }
+  return false;
+}
+
 int32_t
 AigCnfEncoder::value(const AigNode& aig)
 {
@@ -74,7 +92,7 @@ AigCnfEncoder::value(const AigNode& aig)
   }
 
   int32_t val = -1;
-  if (is_encoded(aig))
+  if (polarity(aig) != 0)
   {
     val = d_sat_solver.value(std::abs(aig.get_id())) ? 1 : -1;
   }
@@ -82,6 +100,36 @@ AigCnfEncoder::value(const AigNode& aig)
   return aig.is_negated() ? -val : val;
 }
 
+void
+AigCnfEncoder::push(int64_t activation)
+{
+  assert(activation > 0);
+  assert(!is_encoded(activation));
+  d_activations.push_back(activation);
+  d_trail_sizes.push_back(d_trail.size());
+}
+
+void
+AigCnfEncoder::pop()
+{
+  assert(!d_activations.empty());
+  int64_t activation = d_activations.back();
+  size_t trail_size  = d_trail_sizes.back();
+  d_activations.pop_back();
+  d_trail_sizes.pop_back();
+
+  while (d_trail.size() > trail_size)
+  {
+    const auto& [pos, pol] = d_trail.back();
+    d_aig_polarity[pos]    = pol;
+    d_trail.pop_back();
+  }
+  // Not guarded by the enclosing scope, the clauses stay disabled.
+  d_sat_solver.add_clause({-activation});
+  ++d_statistics.num_clauses;
+  ++d_statistics.num_literals;
+}
+
 const AigCnfEncoder::Statistics&
 AigCnfEncoder::statistics() const
 {
@@ -102,12 +150,12 @@ namespace {
  * @return True if given AIG is a if-then-else.
  */
 bool
-is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
+is_ite(const AigNode& aig, std::vector<AigNode>& children)
 {
   assert(aig.is_and());
   assert(children.empty());
 
-  const auto& l = aig[0];
+  AigNode l = aig[0];
   if (!l.is_negated() || !l.is_and())
   {
     return false;
@@ -119,7 +167,7 @@ is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
     return false;
   }
 
-  const auto& r = aig[1];
+  AigNode r = aig[1];
   if (!r.is_negated() || !r.is_and())
   {
     return false;
@@ -134,170 +182,331 @@ is_ite(const AigNode& aig, std::vector<const AigNode*>& children)
   // ite(c,a,b) == (c -> a) /\ (~c -> b)
   // Check all commutative cases of: ~(c /\ ~a) /\ ~(~c /\ ~b)
   //                                   ll   lr       rl    rr
-  const auto& ll = l[0];
-  const auto& lr = l[1];
-  const auto& rl = r[0];
-  const auto& rr = r[1];
+  AigNode ll = l[0];
+  AigNode lr = l[1];
+  AigNode rl = r[0];
+  AigNode rr = r[1];
 
   // ~(~b /\ ~c) /\  ~(c /\ ~a)
   if (-lr.get_id() == rl.get_id())
   {
-    children.push_back(&rl);  // c
-    children.push_back(&rr);  // ~a
-    children.push_back(&ll);  // ~b
+    children.push_back(rl);  // c
+    children.push_back(rr);  // ~a
+    children.push_back(ll);  // ~b
     return true;
   }
   // ~(~c /\ ~b) /\ ~(c /\ ~a)
   if (-ll.get_id() == rl.get_id())
   {
-    children.push_back(&rl);  // c
-    children.push_back(&rr);  // ~a
-    children.push_back(&lr);  // ~b
+    children.push_back(rl);  // c
+    children.push_back(rr);  // ~a
+    children.push_back(lr);  // ~b
     return true;
   }
   // ~(~b /\ ~c) /\  ~(~a /\ c)
   if (-lr.get_id() == rr.get_id())
   {
-    children.push_back(&rr);  // c
-    children.push_back(&rl);  // ~a
-    children.push_back(&ll);  // ~b
+    children.push_back(rr);  // c
+    children.push_back(rl);  // ~a
+    children.push_back(ll);  // ~b
     return true;
   }
   // ~(~c /\ ~b) /\  ~(~a /\ c)
   if (-ll.get_id() == rr.get_id())
   {
-    children.push_back(&rr);  // c
-    children.push_back(&rl);  // ~a
-    children.push_back(&lr);  // ~b
+    children.push_back(rr);  // c
+    children.push_back(rl);  // ~a
+    children.push_back(lr);  // ~b
     return true;
   }
 
   return false;
 }
 
+/**
+ * Check whether given two-level AIG encodes a binary xor.
+ *
+ * @param aig The AIG to check.
+ * @param children The children a,b of the xor, a xor b is encoded as
+ *                 ~(a /\ b) /\ ~(~a /\ ~b).
+ *
+ * @return True if given AIG is a xor.
+ */
+bool
+is_xor(const AigNode& aig, std::vector<AigNode>& children)
+{
+  assert(aig.is_and());
+  assert(children.empty());
+
+  AigNode l = aig[0];
+  if (!l.is_negated() || !l.is_and() || l.parents() > 1)
+  {
+    return false;
+  }
+  AigNode r = aig[1];
+  if (!r.is_negated() || !r.is_and() || r.parents() > 1)
+  {
+    return false;
+  }
+
+  int64_t ll = l[0].get_id();
+  int64_t lr = l[1].get_id();
+  int64_t rl = r[0].get_id();
+  int64_t rr = r[1].get_id();
+  if ((ll == -rl && lr == -rr) || (ll == -rr && lr == -rl))
+  {
+    children.push_back(l[0]);
+    children.push_back(l[1]);
+    return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 void
-AigCnfEncoder::_encode(const AigNode& aig)
+AigCnfEncoder::_encode(const AigNode& aig, uint8_t pol)
 {
-  std::vector<const AigNode*> visit;
-  std::unordered_set<const AigNode*> cache;
-  visit.push_back(&aig);
+  std::vector<std::pair<AigNode, uint8_t>> visit{{aig, pol}};
+  std::vector<AigNode> children, sub, ite;
+  std::vector<int64_t> clause;
+
+  // Queue child for encoding, `lit_pol` is the polarity in which the
+  // literal of the child occurs.
+  auto require = [&visit](const AigNode& lit, uint8_t lit_pol) {
+    uint8_t p = lit_pol;
+    if (lit.is_negated())
+    {
+      p = ((lit_pol & POS) << 1) | ((lit_pol & NEG) >> 1);
+    }
+    visit.emplace_back(lit, p);
+  };
+
   do
   {
-    auto cur = visit.back();
-    resize(*cur);
-
-    if (is_encoded(*cur))
+    AigNode cur = visit.back().first;
+    uint8_t p   = visit.back().second;
+    visit.pop_back();
+    resize(cur);
+
+    size_t pos      = static_cast<size_t>(std::abs(cur.get_id()) - 1);
+    uint8_t missing = p & ~d_aig_polarity[pos];
+    if (missing == 0)
     {
-      visit.pop_back();
       continue;
     }
+    if (d_aig_polarity[pos] == 0)
+    {
+      ++d_statistics.num_vars;
+    }
 
-    if (cur->is_true() || cur->is_false() || cur->is_const())
+    if (cur.is_true() || cur.is_false() || cur.is_const())
     {
-      visit.pop_back();
-      set_encoded(*cur);
-      if (cur->is_true() || cur->is_false())
+      set_polarity(pos, BOTH);
+      if (cur.is_true() || cur.is_false())
       {
-        d_sat_solver.add_clause({std::abs(cur->get_id())});
-        ++d_statistics.num_clauses;
-        ++d_statistics.num_literals;
+        add_clause({std::abs(cur.get_id())});
       }
+      continue;
     }
-    else
-    {
-      assert(cur->is_and());
 
-      auto [it, inserted] = cache.insert(cur);
+    assert(cur.is_and());
+    set_polarity(pos, d_aig_polarity[pos] | missing);
+    int64_t x = std::abs(cur.get_id());
+    children.clear();
 
-      std::vector<const AigNode*> children;
-      bool ite = is_ite(*cur, children);
+    if (is_xor(cur, children))
+    {
+      // Flatten xor chains over xors that are not shared.
+      bool negated = false;
+      for (size_t i = 0; i < children.size();)
+      {
+        AigNode child = children[i];
+        sub.clear();
+        if (children.size() < MAX_XOR_SIZE && child.is_and()
+            && child.parents() == 2 && polarity(child) == 0
+            && is_xor(child, sub))
+        {
+          negated     = negated != child.is_negated();
+          children[i] = sub[0];
+          children.push_back(sub[1]);
+          continue;
+        }
+        ++i;
+      }
 
-      if (inserted)
+      // Encode x <-> negated xor c_1 xor ... xor c_n by excluding all
+      // assignments of the children with the wrong value of x.
+      size_t n = children.size();
+      for (uint64_t mask = 0; mask < (UINT64_C(1) << n); ++mask)
       {
-        if (ite)
+        bool val = negated;
+        clause.clear();
+        for (size_t i = 0; i < n; ++i)
         {
-          visit.insert(visit.end(), children.begin(), children.end());
+          int64_t c = children[i].get_id();
+          bool bit  = (mask >> i) & 1;
+          val       = val != bit;
+          clause.push_back(bit ? -c : c);
         }
-        else
+        // x -> xor (POS) excludes x with false xor, ~x -> ~xor (NEG) excludes
+        // ~x with true xor.
+        if (missing & (val ? NEG : POS))
         {
-          visit.push_back(&(*cur)[0]);
-          visit.push_back(&(*cur)[1]);
+          clause.push_back(val ? x : -x);
+          add_clause(clause);
         }
       }
-      else
+      for (const AigNode& child : children)
       {
-        visit.pop_back();
-        set_encoded(*cur);
-
-        // TODO: and optimization: collect all children and encode one big and
-        // TODO: xor optimization: use native xor encoding
+        require(child, BOTH);
+      }
+    }
+    else if (is_ite(cur, children))
+    {
+      // Encode x <-> ite(c,a,b)
+      auto c = children[0].get_id();   // cond
+      auto a = -children[1].get_id();  // then
+      auto b = -children[2].get_id();  // else
 
-        if (ite)
+      if (missing & POS)
+      {
+        add_clause({-x, -c, a});
+        add_clause({-x, c, b});
+      }
+      if (missing & NEG)
+      {
+        add_clause({x, -c, -a});
+        add_clause({x, c, -b});
+      }
+      require(children[0], BOTH);
+      // Then and else occur negated in `children`.
+      uint8_t neg_missing = ((missing & POS) << 1) | ((missing & NEG) >> 1);
+      require(children[1], neg_missing);
+      require(children[2], neg_missing);
+    }
+    else
+    {
+      // Encode n-ary AND over all AND children that are not shared.
+      //
+      // x <-> a_1 /\ ... /\ a_n
+      //   --> (~x \/ a_1) /\ ... /\ (~x \/ a_n)
+      //       /\ (x \/ ~a_1 \/ ... \/ ~a_n)
+      sub.push_back(cur[1]);
+      sub.push_back(cur[0]);
+      do
+      {
+        AigNode child = sub.back();
+        sub.pop_back();
+        // Do not flatten ite and xor gates, which have a more compact
+        // encoding.
+        bool flatten = child.is_and() && !child.is_negated()
+                       && child.parents() == 1 && polarity(child) == 0;
+        if (flatten)
+        {
+          ite.clear();
+          flatten = !is_ite(child, ite);
+        }
+        if (flatten)
         {
-          // Encode x <-> ite(c,a,b)
-          auto x = std::abs(cur->get_id());
-          auto c = children[0]->get_id();   // cond
-          auto a = -children[1]->get_id();  // then
-          auto b = -children[2]->get_id();  // else
-
-          d_sat_solver.add_clause({-x, -c, a});
-          d_sat_solver.add_clause({-x, c, b});
-          d_sat_solver.add_clause({x, -c, -a});
-          d_sat_solver.add_clause({x, c, -b});
-          d_statistics.num_clauses += 4;
-          d_statistics.num_literals += 12;
+          sub.push_back(child[1]);
+          sub.push_back(child[0]);
         }
         else
         {
-          // Encode binary AND
-          //
-          // x <-> a /\ b --> (~x \/ a) /\ (~x \/ b) /\ (x \/ ~a \/ ~b)
-
-          auto x = std::abs(cur->get_id());
-          auto a = (*cur)[0].get_id();
-          auto b = (*cur)[1].get_id();
-
-          d_sat_solver.add_clause({-x, a});
-          d_sat_solver.add_clause({-x, b});
-          d_sat_solver.add_clause({x, -a, -b});
-          d_statistics.num_clauses += 3;
-          d_statistics.num_literals += 7;
+          children.push_back(child);
+        }
+      } while (!sub.empty());
+
+      if (missing & POS)
+      {
+        for (const AigNode& child : children)
+        {
+          add_clause({-x, child.get_id()});
         }
       }
+      if (missing & NEG)
+      {
+        clause.clear();
+        clause.push_back(x);
+        for (const AigNode& child : children)
+        {
+          clause.push_back(-child.get_id());
+        }
+        add_clause(clause);
+      }
+      for (const AigNode& child : children)
+      {
+        require(child, missing);
+      }
     }
   } while (!visit.empty());
 }
 
 void
-AigCnfEncoder::resize(const AigNode& aig)
+AigCnfEncoder::add_clause(const std::vector<int64_t>& clause)
 {
-  size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
-  if (pos < d_aig_encoded.size())
+  for (int64_t lit : clause)
   {
-    return;
+    d_sat_solver.add(lit);
   }
-  d_aig_encoded.resize(pos + 1, false);
+  end_clause(clause.size());
 }
 
-bool
-AigCnfEncoder::is_encoded(const AigNode& aig) const
+void
+AigCnfEncoder::add_clause(const std::initializer_list<int64_t>& clause)
 {
-  size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
-  if (pos < d_aig_encoded.size())
+  for (int64_t lit : clause)
   {
-    return d_aig_encoded[pos];
+    d_sat_solver.add(lit);
   }
-  return false;
+  end_clause(clause.size());
 }
 
 void
-AigCnfEncoder::set_encoded(const AigNode& aig)
+AigCnfEncoder::end_clause(size_t size)
+{
+  if (!d_activations.empty())
+  {
+    // Clauses of a scope are only active if its activation literal is true.
+    d_sat_solver.add(-d_activations.back());
+    ++size;
+  }
+  d_sat_solver.add(0);
+  ++d_statistics.num_clauses;
+  d_statistics.num_literals += size;
+}
+
+void
+AigCnfEncoder::set_polarity(size_t pos, uint8_t pol)
+{
+  if (!d_activations.empty())
+  {
+    d_trail.emplace_back(pos, d_aig_polarity[pos]);
+  }
+  d_aig_polarity[pos] = pol;
+}
+
+void
+AigCnfEncoder::resize(const AigNode& aig)
+{
+  size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
+  if (pos < d_aig_polarity.size())
+  {
+    return;
+  }
+  d_aig_polarity.resize(pos + 1, 0);
+}
+
+uint8_t
+AigCnfEncoder::polarity(const AigNode& aig) const
 {
   size_t pos = static_cast<size_t>(std::abs(aig.get_id()) - 1);
-  assert(pos < d_aig_encoded.size());
-  d_aig_encoded[pos] = true;
-  ++d_statistics.num_vars;
+  if (pos < d_aig_polarity.size())
+  {
+    return d_aig_polarity[pos];
+  }
+  return 0;
 }
+
 }  // namespace bzla::bitblast
@@ -10,6 +10,9 @@
 
 #ifndef BZLA__BITBLAST_AIG_CNF_H
 #define BZLA__BITBLAST_AIG_CNF_H
+
+#include <vector>
+
 #include "bitblast/aig/aig_manager.h"
 
 namespace bzla::bitblast {
@@ -35,6 +38,25 @@ class SatInterface
   virtual bool value(int64_t lit) = 0;
 };
 
+/**
+ * CNF encoder for AIGs.
+ *
+ * AIG nodes are encoded polarity-aware (Plaisted-Greenbaum): for each node,
+ * only the clauses of the polarities in which it occurs are added, i.e.,
+ * clauses x -> def(x) if it occurs positively and def(x) -> x if it occurs
+ * negatively. Missing polarities are added incrementally if a node occurs in
+ * a new polarity in subsequently encoded AIGs.
+ *
+ * Gates are encoded as n-ary ANDs over their non-shared AND children,
+ * if-then-else or n-ary XOR if the corresponding two-level pattern is
+ * detected, and binary ANDs otherwise.
+ *
+ * Encodings can be scoped via push() and pop(). Clauses added within a scope
+ * are guarded by the activation literal of the scope, which must be assumed
+ * while the scope is active. On pop(), the activation literal is asserted
+ * to be false, which permanently disables the clauses of the scope, and all
+ * encodings added within the scope are forgotten.
+ */
 class AigCnfEncoder
 {
  public:
@@ -50,29 +72,112 @@ class AigCnfEncoder
   /**
    * Recursively encodes AIG node to CNF.
    *
+   * If `top_level` is false, the node is encoded in both polarities, i.e.,
+   * the value of its variable in a satisfying assignment corresponds to the
+   * value of the node.
+   *
    * @param node The AIG node to encode.
    * @param top_level Indicates whether given node is at the top level, which
-   *        enables certain optimization.
+   *        enables certain optimization. Top-level nodes are asserted and
+   *        only encoded in the polarity in which they occur.
    * */
   void encode(const AigNode& node, bool top_level = false);
 
+  /**
+   * Recursively encodes AIG node to CNF such that it can be assumed.
+   *
+   * The node is only encoded in the polarity in which it occurs, i.e., if
+   * the (possibly negated) literal of the node is true in a satisfying
+   * assignment, the node is true, but not vice versa.
+   *
+   * @param node The AIG node to encode.
+   */
+  void encode_assumption(const AigNode& node);
+
+  /**
+   * Determine whether given AIG literal can be used in clauses, i.e., if the
+   * literal being true in a satisfying assignment implies that the
+   * corresponding AIG node is true.
+   *
+   * @param lit The literal, the negated id of an AIG node if negative.
+   * @return True if the AIG node of `lit` is encoded in the polarity of
+   *         `lit`.
+   */
+  bool is_encoded(int64_t lit) const;
+
+  /**
+   * Get the value of given encoded AIG node in the current assignment.
+   *
+   * @note For nodes that are not encoded in both polarities, the value is not
+   *       necessarily the value of the node under the current assignment of
+   *       the inputs.
+   * @param node The AIG node.
+   * @return 1 if `node` is true, -1 if it is false or not encoded.
+   */
   int32_t value(const AigNode& node);
 
+  /**
+   * Open a new scope.
+   * @param activation The activation literal of the scope, a variable that
+   *                   does not correspond to any encoded AIG node.
+   */
+  void push(int64_t activation);
+
+  /**
+   * Close the current scope, disable all clauses added within the scope and
+   * restore the encoded polarities of all nodes to the state before the
+   * matching push().
+   */
+  void pop();
+
+  /** @return The activation literals of all open scopes. */
+  const std::vector<int64_t>& activations() const { return d_activations; }
+
   /** @return CNF statistics. */
   const Statistics& statistics() const;
 
  private:
-  /** Encode AIG to CNF. */
-  void _encode(const AigNode& node);
-  /** Ensure that `d_aig_encoded` is big enough to store `aig`. */
+  /** Polarity flags. */
+  static constexpr uint8_t POS  = 1;
+  static constexpr uint8_t NEG  = 2;
+  static constexpr uint8_t BOTH = POS | NEG;
+
+  /** The maximum number of inputs of n-ary XOR gates. */
+  static constexpr size_t MAX_XOR_SIZE = 3;
+
+  /**
+   * Encode AIG to CNF.
+   * @param aig The AIG.
+   * @param pol The polarities in which the node of `aig` is encoded.
+   */
+  void _encode(const AigNode& aig, uint8_t pol);
+  /** Add clause with given literals, guarded by the current scope. */
+  void add_clause(const std::vector<int64_t>& clause);
+  /** Add clause with given literals, guarded by the current scope. */
+  void add_clause(const std::initializer_list<int64_t>& clause);
+  /** Terminate clause of given size, guarded by the current scope. */
+  void end_clause(size_t size);
+  /** Set the encoded polarities of the node at `pos` in d_aig_polarity. */
+  void set_polarity(size_t pos, uint8_t pol);
+  /** Ensure that `d_aig_polarity` is big enough to store `aig`. */
   void resize(const AigNode& aig);
-  /** Checks whether `aig` was already encoded. */
-  bool is_encoded(const AigNode& aig) const;
-  /** Mark `aig` as encoded. */
-  void set_encoded(const AigNode& aig);
+  /** @return The polarities in which `aig` is already encoded. */
+  uint8_t polarity(const AigNode& aig) const;
 
-  /** Maps AIG id to flag that indicates whether the AIG was already encoded. */
-  std::vector<bool> d_aig_encoded;
+  /**
+   * Maps AIG id to the polarities in which the AIG was already encoded, 0 if
+   * not yet encoded.
+   */
+  std::vector<uint8_t> d_aig_polarity;
+  /** The activation literals of the open scopes. */
+  std::vector<int64_t> d_activations;
+  /**
+   * Previous polarities of nodes whose polarities changed within an open
+   * scope, given as pairs of position in d_aig_polarity and polarity.
+   */
+  std::vector<std::pair<size_t, uint8_t>> d_trail;
+  /** The size of d_trail at the start of each open scope. */
+  std::vector<size_t> d_trail_sizes;
   /** SAT solver. */
   SatInterface& d_sat_solver;
   /** CNF statistics. */
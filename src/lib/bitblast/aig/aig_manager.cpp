@@ -11,90 +11,92 @@
 #include "bitblast/aig/aig_manager.h"
 
 #include <cstdlib>
+#include <stdexcept>
 
 namespace bzla::bitblast {
 
 // AigNodeUniqueTable
 
-AigNodeUniqueTable::AigNodeUniqueTable() { d_buckets.resize(16, nullptr); }
+AigNodeUniqueTable::AigNodeUniqueTable(AigManager& mgr) : d_mgr(mgr)
+{
+  d_buckets.resize(16, 0);
+}
 
-std::pair<bool, AigNodeData*>
-AigNodeUniqueTable::insert(AigNodeData* d)
+uint32_t
+AigNodeUniqueTable::find(uint32_t left, uint32_t right) const
 {
-  size_t h         = hash(d->d_left, d->d_right);
-  AigNodeData* cur = d_buckets[h];
-  int64_t left_id  = d->d_left.get_id();
-  int64_t right_id = d->d_right.get_id();
+  uint32_t cur = d_buckets[hash(left, right)];
 
   // Check collision chain.
   while (cur)
   {
-    if (cur->d_left.get_id() == left_id && cur->d_right.get_id() == right_id)
+    if (d_mgr.d_left[cur] == left && d_mgr.d_right[cur] == right)
     {
-      return std::make_pair(false, cur);
+      return cur;
     }
-    cur = cur->next;
+    cur = d_mgr.d_next[cur];
   }
+  return 0;
+}
 
+void
+AigNodeUniqueTable::insert(uint32_t id)
+{
+  assert(find(d_mgr.d_left[id], d_mgr.d_right[id]) == 0);
   if (d_num_elements == d_buckets.capacity())
   {
     resize();
-    h = hash(d->d_left, d->d_right);
   }
-  assert(d->next == nullptr);
-  d->next      = d_buckets[h];
-  d_buckets[h] = d;
-
+  size_t h = hash(d_mgr.d_left[id], d_mgr.d_right[id]);
+  // The collision chain is stored in the AIG manager.
+  auto& next = d_mgr.d_next;
+  assert(next[id] == 0);
+  next[id]     = d_buckets[h];
+  d_buckets[h] = id;
   ++d_num_elements;
-  return std::make_pair(true, d);
 }
 
 void
-AigNodeUniqueTable::erase(const AigNodeData* d)
+AigNodeUniqueTable::erase(uint32_t id)
 {
-  size_t h          = hash(d->d_left, d->d_right);
-  AigNodeData* cur  = d_buckets[h];
-  AigNodeData* prev = nullptr;
-  assert(cur != nullptr);
+  size_t h      = hash(d_mgr.d_left[id], d_mgr.d_right[id]);
+  uint32_t cur  = d_buckets[h];
+  uint32_t prev = 0;
+  assert(cur != 0);
 
   // Should not happen
-  if (cur == nullptr)
+  if (cur == 0)
   {
     return;
   }
 
-  // Find data in collision chain.
-  int64_t left_id  = d->d_left.get_id();
-  int64_t right_id = d->d_right.get_id();
-  while (cur)
+  // Find node in collision chain.
+  while (cur && cur != id)
   {
-    if (cur->d_left.get_id() == left_id && cur->d_right.get_id() == right_id)
-    {
-      break;
-    }
     prev = cur;
-    cur  = cur->next;
+    cur  = d_mgr.d_next[cur];
   }
   assert(cur);
 
   // Update collision chain.
-  if (prev == nullptr)
+  auto& next = d_mgr.d_next;
+  if (prev == 0)
   {
-    d_buckets[h] = cur->next;
+    d_buckets[h] = next[cur];
   }
   else
   {
-    prev->next = cur->next;
+    next[prev] = next[cur];
   }
+  next[cur] = 0;
   --d_num_elements;
 }
 
 size_t
-AigNodeUniqueTable::hash(const AigNode& left, const AigNode& right)
+AigNodeUniqueTable::hash(uint32_t left, uint32_t right) const
 {
-  size_t lhs = static_cast<size_t>(std::abs(left.get_id()));
-  size_t rhs = static_cast<size_t>(std::abs(right.get_id()));
-  size_t h   = 547789289u * lhs + 786695309u * rhs;
+  size_t h = 547789289u * static_cast<size_t>(left)
+             + 786695309u * static_cast<size_t>(right);
   return h & (d_buckets.capacity() - 1);
 }
 
@@ -104,18 +106,19 @@ AigNodeUniqueTable::resize()
   auto buckets = d_buckets;
 
   d_buckets.clear();
-  d_buckets.resize(d_buckets.capacity() * 2, nullptr);
+  d_buckets.resize(d_buckets.capacity() * 2, 0);
 
   // Rehash elements.
+  auto& next = d_mgr.d_next;
   for (auto cur : buckets)
   {
     while (cur)
     {
-      size_t h     = hash(cur->d_left, cur->d_right);
-      auto next    = cur->next;
-      cur->next    = d_buckets[h];
+      size_t h     = hash(d_mgr.d_left[cur], d_mgr.d_right[cur]);
+      auto nxt     = next[cur];
+      next[cur]    = d_buckets[h];
       d_buckets[h] = cur;
-      cur          = next;
+      cur          = nxt;
     }
   }
 }
@@ -123,8 +126,15 @@ AigNodeUniqueTable::resize()
 // BitNodeInterface<AigNode>
 
 AigManager::AigManager()
-    : d_true(new_data(), false), d_false(d_true.d_data, true)
+    : d_left(1, 0),
+      d_right(1, 0),
+      d_refs(1, 0),
+      d_parents(1, 0),
+      d_next(1, 0),
+      d_unique_table(*this)
 {
+  d_true  = AigNode(this, new_node(0, 0) << 1);
+  d_false = mk_not(d_true);
   assert(d_true.get_id() == AigNode::s_true_id);
   assert(d_false.get_id() == -AigNode::s_true_id);
 }
@@ -137,38 +147,21 @@ AigManager::statistics() const
   return d_statistics;
 }
 
-void
-AigManager::init_id(AigNodeData* d)
-{
-  assert(d_aig_id_counter < INT64_MAX);
-  assert(d != nullptr);
-  assert(d->d_id == 0);
-  d_node_data.emplace_back(d);
-  assert(d_node_data.size() == static_cast<size_t>(d_aig_id_counter));
-  d->d_id = d_aig_id_counter++;
-  if (!d->d_left.is_null())
-  {
-    ++d->d_left.d_data->d_parents;
-    ++d->d_right.d_data->d_parents;
-  }
-}
-
-AigNodeData*
-AigManager::find_or_create_and(const AigNode& left, const AigNode& right)
+uint32_t
+AigManager::find_or_create_and(uint32_t left, uint32_t right)
 {
-  assert(std::abs(left.get_id()) < std::abs(right.get_id()));
-  AigNodeData* d          = new AigNodeData(this, left, right);
-  auto [inserted, lookup] = d_unique_table.insert(d);
-  if (!inserted)
+  assert((left >> 1) < (right >> 1));
+  uint32_t id = d_unique_table.find(left, right);
+  if (id)
   {
     ++d_statistics.num_shared;
-    delete d;
-    return lookup;
+    return id;
   }
 
-  init_id(d);
+  id = new_node(left, right);
+  d_unique_table.insert(id);
   ++d_statistics.num_ands;
-  return d;
+  return id;
 }
 
 AigNode
@@ -400,94 +393,89 @@ AigManager::rewrite_and(const AigNode& l, const AigNode& r)
   }
 
   // create AND with left, right
-  AigNodeData* d = find_or_create_and(get_node(left), get_node(right));
-  return AigNode(d);
+  uint32_t id = find_or_create_and(to_lit(left), to_lit(right));
+  return AigNode(this, id << 1);
 }
 
 AigNode
 AigManager::get_node(int64_t id)
 {
-  assert(static_cast<size_t>(std::abs(id)) <= d_node_data.size());
-  return AigNode(d_node_data[std::abs(id) - 1].get(), id < 0);
+  assert(static_cast<size_t>(std::abs(id)) < d_left.size());
+  return AigNode(this, to_lit(id));
 }
 
 std::pair<int64_t, int64_t>
 AigManager::get_children(int64_t id) const
 {
-  assert(static_cast<size_t>(std::abs(id)) <= d_node_data.size());
-  const auto& d = d_node_data[std::abs(id) - 1];
-  return {d->d_left.get_id(), d->d_right.get_id()};
+  size_t idx = static_cast<size_t>(std::abs(id));
+  assert(idx < d_left.size());
+  return {to_id(d_left[idx]), to_id(d_right[idx])};
 }
 
-AigNodeData*
-AigManager::new_data()
+uint32_t
+AigManager::new_node(uint32_t left, uint32_t right)
 {
-  AigNodeData* d = new AigNodeData(this);
-  init_id(d);
-  return d;
+  if (d_left.size() > s_max_id)
+  {
+    throw std::length_error("maximum number of AIG nodes exceeded");
+  }
+  uint32_t id = static_cast<uint32_t>(d_left.size());
+  d_left.push_back(left);
+  d_right.push_back(right);
+  d_refs.push_back(0);
+  d_parents.push_back(0);
+  d_next.push_back(0);
+  if (left)
+  {
+    assert(right);
+    inc_refs(left >> 1);
+    inc_refs(right >> 1);
+    ++d_parents[left >> 1];
+    ++d_parents[right >> 1];
+  }
+  return id;
 }
 
 void
-AigManager::garbage_collect(AigNodeData* d)
+AigManager::garbage_collect(uint32_t id)
 {
-  assert(d->d_refs == 0);
-
-  if (d_gc_mode)
-  {
-    assert(false);
-    return;
-  }
-
-  d_gc_mode = true;
-
-  AigNodeData *cur, *data;
-  std::vector<AigNodeData*> visit{d};
+  assert(d_refs[id] == 0);
 
+  std::vector<uint32_t> visit{id};
   do
   {
-    cur = visit.back();
+    uint32_t cur = visit.back();
     visit.pop_back();
-    assert(cur->d_refs == 0);
+    assert(d_refs[cur] == 0);
 
     // Decrement reference counts for children of AND nodes
-    if (!cur->d_left.is_null())
+    if (d_left[cur])
     {
-      assert(!cur->d_right.is_null());
+      assert(d_right[cur]);
 
-      // Erase node data from unique table before we modify children.
+      // Erase node from unique table before we modify children.
       d_unique_table.erase(cur);
 
-      data = cur->d_left.d_data;
-      --data->d_refs;
-      --data->d_parents;
-      cur->d_left.d_data = nullptr;
-      if (data->d_refs == 0)
+      for (uint32_t lit : {d_left[cur], d_right[cur]})
       {
-        visit.push_back(data);
-      }
-
-      data = cur->d_right.d_data;
-      --data->d_refs;
-      --data->d_parents;
-      cur->d_right.d_data = nullptr;
-      if (data->d_refs == 0)
-      {
-        visit.push_back(data);
+        uint32_t child = lit >> 1;
+        assert(d_refs[child] > 0);
+        --d_refs[child];
+        --d_parents[child];
+        if (d_refs[child] == 0)
+        {
+          visit.push_back(child);
+        }
       }
+      d_left[cur]  = 0;
+      d_right[cur] = 0;
       --d_statistics.num_ands;
     }
     else
     {
       --d_statistics.num_consts;
     }
-
-    // Delete node data
-    assert(cur->d_id > 0);
-    assert(d_node_data[static_cast<size_t>(cur->d_id) - 1]->d_id == cur->d_id);
-    d_node_data[static_cast<size_t>(cur->d_id) - 1].reset(nullptr);
   } while (!visit.empty());
-
-  d_gc_mode = false;
 }
 
 }  // namespace bzla::bitblast
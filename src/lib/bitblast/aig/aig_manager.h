@@ -14,34 +14,45 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
-#include <memory>
 #include <vector>
 
 #include "bitblast/aig/aig_node.h"
 
 namespace bzla::bitblast {
 
+class AigManager;
+
 // AigNodeUniqueTable
 class AigNodeUniqueTable
 {
  public:
-  AigNodeUniqueTable();
+  AigNodeUniqueTable(AigManager& mgr);
 
-  // AigNodeData* lookup(const AigNode& left, const AigNode& right);
-  std::pair<bool, AigNodeData*> insert(AigNodeData* d);
-  void erase(const AigNodeData* d);
+  /**
+   * Find AND gate with given children.
+   * @param left  Literal of the left child.
+   * @param right Literal of the right child.
+   * @return The id of the AND gate or 0 if it was not yet constructed.
+   */
+  uint32_t find(uint32_t left, uint32_t right) const;
+  void insert(uint32_t id);
+  void erase(uint32_t id);
 
  private:
-  size_t hash(const AigNode& left, const AigNode& right);
+  size_t hash(uint32_t left, uint32_t right) const;
   void resize();
 
+  /** The AIG manager storing node data. */
+  AigManager& d_mgr;
   size_t d_num_elements = 0;
-  std::vector<AigNodeData*> d_buckets;
+  std::vector<uint32_t> d_buckets;
 };
 
 class AigManager
 {
-  friend class AigNodeData;
+  friend class AigNode;
+  friend class AigNodeUniqueTable;
+  friend class AigSimulator;
 
  public:
   struct Statistics
@@ -59,13 +70,10 @@ class AigManager
   AigNode mk_const()
   {
     ++d_statistics.num_consts;
-    return AigNode(new_data());
+    return AigNode(this, new_node(0, 0) << 1);
   }
 
-  AigNode mk_not(const AigNode& a)
-  {
-    return AigNode(a.d_data, !a.is_negated());
-  }
+  AigNode mk_not(const AigNode& a) { return AigNode(this, a.d_lit ^ 1); }
 
   AigNode mk_and(const AigNode& a, const AigNode& b)
   {
@@ -76,21 +84,33 @@ class AigManager
   const Statistics& statistics() const;
 
  private:
-  /** Counter for AIG ids. */
-  int64_t d_aig_id_counter = AigNode::s_true_id;
+  /** Maximum number of AIG nodes, ids must fit into 31 bits. */
+  static constexpr uint32_t s_max_id = UINT32_MAX >> 1;
 
-  /** Returns the next free AIG id. */
-  void init_id(AigNodeData* d);
+  /** Convert signed AIG id to literal. */
+  static uint32_t to_lit(int64_t id)
+  {
+    assert(id != 0);
+    return id < 0 ? (static_cast<uint32_t>(-id) << 1) | 1
+                  : static_cast<uint32_t>(id) << 1;
+  }
+
+  /** Convert literal to signed AIG id, literal 0 is mapped to 0. */
+  static int64_t to_id(uint32_t lit)
+  {
+    int64_t id = lit >> 1;
+    return lit & 1 ? -id : id;
+  }
 
   /**
-   * Find already constructed and gate with given children.
+   * Find already constructed AND gate with given children or create a new
+   * one.
    *
-   * @param left Left child of AND gate.
-   * @param right Right child of AND gate.
-   * @return Pointer to existing node data or nullptr if AND gate was not yet
-   * constructed.
+   * @param left Literal of left child of AND gate.
+   * @param right Literal of right child of AND gate.
+   * @return The id of the AND gate.
    */
-  AigNodeData* find_or_create_and(const AigNode& left, const AigNode& right);
+  uint32_t find_or_create_and(uint32_t left, uint32_t right);
 
   /**
    * Implements two-level AIG rewriting from [1].
@@ -107,17 +127,52 @@ class AigManager
   std::pair<int64_t, int64_t> get_children(int64_t id) const;
 
   /**
-   * Construct a new node data.
+   * Construct a new node.
+   * @param left  Literal of left child, 0 for constants.
+   * @param right Literal of right child, 0 for constants.
+   * @return The id of the new node.
+   * @throw std::length_error if the maximum number of nodes is exceeded.
    */
-  AigNodeData* new_data();
+  uint32_t new_node(uint32_t left, uint32_t right);
+
+  void inc_refs(uint32_t id)
+  {
+    assert(id < d_refs.size());
+    ++d_refs[id];
+  }
+
+  void dec_refs(uint32_t id)
+  {
+    assert(id < d_refs.size());
+    assert(d_refs[id] > 0);
+    if (--d_refs[id] == 0)
+    {
+      garbage_collect(id);
+    }
+  }
 
   /**
-   * Delete given node data.
+   * Delete given node and recursively all children that are not referenced
+   * anymore.
    */
-  void garbage_collect(AigNodeData* d);
+  void garbage_collect(uint32_t id);
+
+  /**
+   * Node data, stored as struct-of-arrays indexed by node id. Id 0 is
+   * reserved and ids of deleted nodes are not reused.
+   */
+
+  /** Literals of left children of AND gates, 0 for constants. */
+  std::vector<uint32_t> d_left;
+  /** Literals of right children of AND gates, 0 for constants. */
+  std::vector<uint32_t> d_right;
+  /** Reference counts. */
+  std::vector<uint32_t> d_refs;
+  /** Number of parents. */
+  std::vector<uint32_t> d_parents;
+  /** Next node id in unique table collision chain, 0 terminates chain. */
+  std::vector<uint32_t> d_next;
 
-  /** Maps node id to node data and stores all created node data. */
-  std::vector<std::unique_ptr<AigNodeData>> d_node_data;
   /** AND gate cache used for hash consing. */
   AigNodeUniqueTable d_unique_table;
 
@@ -126,12 +181,70 @@ class AigManager
   /** AIG node representing false. */
   AigNode d_false;
 
-  /** Indicates whether AIG manager is in garbage collection mode. */
-  bool d_gc_mode = false;
-
   Statistics d_statistics;
 };
 
+inline bool
+AigNode::is_true() const
+{
+  return id() == AigNode::s_true_id && !is_negated();
+}
+
+inline bool
+AigNode::is_false() const
+{
+  return id() == AigNode::s_true_id && is_negated();
+}
+
+inline bool
+AigNode::is_and() const
+{
+  return d_mgr->d_left[id()] != 0;
+}
+
+inline bool
+AigNode::is_const() const
+{
+  return !is_and() && !is_true() && !is_false();
+}
+
+inline AigNode
+AigNode::operator[](int index) const
+{
+  assert(is_and());
+  if (index == 0)
+  {
+    return AigNode(d_mgr, d_mgr->d_left[id()]);
+  }
+  assert(index == 1);
+  return AigNode(d_mgr, d_mgr->d_right[id()]);
+}
+
+inline int64_t
+AigNode::get_id() const
+{
+  // only happens if constructed with default constructor
+  if (is_null())
+  {
+    return 0;
+  }
+  return AigManager::to_id(d_lit);
+}
+
+inline uint32_t
+AigNode::parents() const
+{
+  assert(!is_null());
+  return d_mgr->d_parents[id()];
+}
+
+inline uint64_t
+AigNode::get_refs() const
+{
+  assert(!is_null());
+  return d_mgr->d_refs[id()];
+}
+
 }  // namespace bzla::bitblast
 
 #endif
@@ -6,68 +6,64 @@
 
 namespace bzla::bitblast {
 
-AigNode::AigNode(AigNodeData* data, bool negated)
-    : d_data(data), d_negated(negated)
+AigNode::AigNode(AigManager* mgr, uint32_t lit) : d_mgr(mgr), d_lit(lit)
 {
-  d_data->inc_refs();
+  d_mgr->inc_refs(id());
 }
 
 AigNode::~AigNode()
 {
   if (!is_null())
   {
-    d_data->dec_refs();
+    d_mgr->dec_refs(id());
   }
 }
 
-AigNode::AigNode(const AigNode& other)
-    : d_data(other.d_data), d_negated(other.d_negated)
+AigNode::AigNode(const AigNode& other) : d_mgr(other.d_mgr), d_lit(other.d_lit)
 {
   assert(!other.is_null());
-  d_data->inc_refs();
+  d_mgr->inc_refs(id());
 }
 
 AigNode&
 AigNode::operator=(const AigNode& other)
 {
-  if (d_data)
+  // Increment first to handle self-assignment.
+  if (!other.is_null())
   {
-    d_data->dec_refs();
+    other.d_mgr->inc_refs(other.id());
   }
-  d_data    = other.d_data;
-  d_negated = other.d_negated;
-  d_data->inc_refs();
+  if (!is_null())
+  {
+    d_mgr->dec_refs(id());
+  }
+  d_mgr = other.d_mgr;
+  d_lit = other.d_lit;
   return *this;
 }
 
-AigNode::AigNode(AigNode&& other)
+AigNode::AigNode(AigNode&& other) : d_mgr(other.d_mgr), d_lit(other.d_lit)
 {
-  if (d_data)
-  {
-    d_data->dec_refs();
-  }
-  d_data       = other.d_data;
-  d_negated    = other.d_negated;
-  other.d_data = nullptr;
+  other.d_mgr = nullptr;
+  other.d_lit = 0;
 }
 
 AigNode&
 AigNode::operator=(AigNode&& other)
 {
-  if (d_data)
+  if (this == &other)
   {
-    d_data->dec_refs();
+    return *this;
   }
-  d_data       = other.d_data;
-  d_negated    = other.d_negated;
-  other.d_data = nullptr;
+  if (!is_null())
+  {
+    d_mgr->dec_refs(id());
+  }
+  d_mgr       = other.d_mgr;
+  d_lit       = other.d_lit;
+  other.d_mgr = nullptr;
+  other.d_lit = 0;
   return *this;
 }
 
-void
-AigNodeData::gc()
-{
-  d_mgr->garbage_collect(this);
-}
-
 }  // namespace bzla::bitblast
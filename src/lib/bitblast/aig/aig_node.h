@@ -18,16 +18,22 @@
 namespace bzla::bitblast {
 
 class AigManager;
-class AigNodeData;
+class AigSimulator;
 
 /**
- * Wrapper around AigNodeData with automatic reference counting on
+ * Handle to an AIG node with automatic reference counting on
  * construction/destruction.
+ *
+ * The node is represented as literal `id << 1 | negated`, where `id` indexes
+ * the node data stored in the struct-of-arrays of its AigManager.
+ *
+ * @note Inline member functions that access node data are defined in
+ *       aig_manager.h.
  */
 class AigNode
 {
   friend AigManager;
-  friend AigNodeData;
+  friend AigSimulator;
 
  public:
   AigNode() = default;
@@ -45,27 +51,32 @@ class AigNode
 
   bool is_const() const;
 
-  bool is_negated() const { return d_negated; }
+  bool is_negated() const { return d_lit & 1; }
 
-  const AigNode& operator[](int index) const;
+  AigNode operator[](int index) const;
 
   int64_t get_id() const;
 
   uint32_t parents() const;
 
+  /** @return The number of references to this node, including parents. */
+  uint64_t get_refs() const;
+
  private:
   static const int64_t s_true_id = 1;
 
   // Should only be constructed via AigManager
-  AigNode(AigNodeData* data, bool negated = false);
+  AigNode(AigManager* mgr, uint32_t lit);
 
-  bool is_null() const { return d_data == nullptr; }
+  bool is_null() const { return d_mgr == nullptr; }
 
-  uint64_t get_refs() const;
+  /** @return The (unsigned) id of the node. */
+  uint32_t id() const { return d_lit >> 1; }
 
-  AigNodeData* d_data = nullptr;
-  // TODO: optimization hide flag in d_data pointer
-  bool d_negated = false;
+  /** The associated AIG manager. */
+  AigManager* d_mgr = nullptr;
+  /** The literal, id << 1 | negated. */
+  uint32_t d_lit = 0;
 };
 
 inline bool
@@ -80,118 +91,6 @@ operator<(const AigNode& a, const AigNode& b)
   return a.get_id() < b.get_id();
 }
 
-/**
- * AigNodeData storing all node data.
- */
-class AigNodeData
-{
-  friend class AigNode;
-  friend AigManager;
-  friend class AigNodeUniqueTable;
-
- public:
-  AigNodeData() = delete;
-  ~AigNodeData() { assert(d_refs == 0); }
-
-  void inc_refs() { ++d_refs; }
-  void dec_refs()
-  {
-    assert(d_refs > 0);
-    --d_refs;
-    if (d_refs == 0)
-    {
-      gc();
-    }
-  }
-
- private:
-  AigNodeData(AigManager* mgr) : d_mgr(mgr) {}
-  AigNodeData(AigManager* mgr, const AigNode& left, const AigNode& right)
-      : d_mgr(mgr), d_left(left), d_right(right)
-  {
-  }
-
-  void gc();
-
-  /** Pointer to AIG Manager to allow automatic deletion. */
-  AigManager* d_mgr = nullptr;
-
-  /** AIG node id. */
-  int64_t d_id = 0;
-  /** Reference count. */
-  uint32_t d_refs = 0;
-  /** Number of parents. */
-  uint32_t d_parents = 0;
-  /** Left child of AND gate. */
-  AigNode d_left;
-  /** Right child of AND gate. */
-  AigNode d_right;
-
-  /** Next pointer for collision chain. */
-  AigNodeData* next = nullptr;
-};
-
-inline bool
-AigNode::is_true() const
-{
-  return d_data->d_id == AigNode::s_true_id && !is_negated();
-}
-
-inline bool
-AigNode::is_false() const
-{
-  return d_data->d_id == AigNode::s_true_id && is_negated();
-}
-
-inline bool
-AigNode::is_and() const
-{
-  return !d_data->d_left.is_null();
-}
-
-inline bool
-AigNode::is_const() const
-{
-  return !is_and() && !is_true() && !is_false();
-}
-
-inline const AigNode&
-AigNode::operator[](int index) const
-{
-  assert(is_and());
-  if (index == 0)
-  {
-    return d_data->d_left;
-  }
-  assert(index == 1);
-  return d_data->d_right;
-}
-
-inline int64_t
-AigNode::get_id() const
-{
-  // only happens if constructed with default constructor
-  if (is_null())
-  {
-    return 0;
-  }
-  return is_negated() ? -d_data->d_id : d_data->d_id;
-}
-
-inline uint32_t
-AigNode::parents() const
-{
-  assert(!is_null());
-  return d_data->d_parents;
-}
-
-inline uint64_t
-AigNode::get_refs() const
-{
-  assert(!is_null());
-  return d_data->d_refs;
-}
-
 }  // namespace bzla::bitblast
 
 namespace std {
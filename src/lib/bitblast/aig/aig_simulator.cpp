@@ -0,0 +1,101 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_simulator.h"
+
+namespace bzla::bitblast {
+
+void
+AigSimulator::set(const AigNode& input, uint64_t word)
+{
+  assert(!input.is_null());
+  assert(input.is_const());
+  assert(d_mgr == nullptr || d_mgr == input.d_mgr);
+  d_mgr = input.d_mgr;
+  resize();
+  d_inputs[input.id()] = input.is_negated() ? ~word : word;
+  // Invalidate all simulated words.
+  d_gen += 1;
+}
+
+uint64_t
+AigSimulator::simulate(const AigNode& aig)
+{
+  assert(!aig.is_null());
+  assert(d_mgr == nullptr || d_mgr == aig.d_mgr);
+  d_mgr = aig.d_mgr;
+  resize();
+
+  const auto& left  = d_mgr->d_left;
+  const auto& right = d_mgr->d_right;
+
+  assert(d_visit.empty());
+  d_visit.push_back(aig.id());
+  do
+  {
+    uint32_t id = d_visit.back();
+    if (d_stamps[id] == d_gen)
+    {
+      d_visit.pop_back();
+      continue;
+    }
+
+    uint32_t l = left[id];
+    if (l == 0)
+    {
+      d_words[id] = id == AigNode::s_true_id ? ~UINT64_C(0) : d_inputs[id];
+    }
+    else
+    {
+      uint32_t r = right[id];
+      bool done  = true;
+      if (d_stamps[l >> 1] != d_gen)
+      {
+        d_visit.push_back(l >> 1);
+        done = false;
+      }
+      if (d_stamps[r >> 1] != d_gen)
+      {
+        d_visit.push_back(r >> 1);
+        done = false;
+      }
+      if (!done)
+      {
+        continue;
+      }
+      d_words[id] = word(l) & word(r);
+    }
+    d_stamps[id] = d_gen;
+    d_visit.pop_back();
+  } while (!d_visit.empty());
+
+  return word(aig.d_lit);
+}
+
+void
+AigSimulator::reset()
+{
+  d_inputs.assign(d_inputs.size(), 0);
+  d_gen += 1;
+}
+
+void
+AigSimulator::resize()
+{
+  size_t size = d_mgr->d_left.size();
+  if (d_words.size() < size)
+  {
+    d_inputs.resize(size, 0);
+    d_words.resize(size, 0);
+    d_stamps.resize(size, 0);
+  }
+}
+
+}  // namespace bzla::bitblast
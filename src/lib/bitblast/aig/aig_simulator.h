@@ -0,0 +1,95 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BITBLAST_AIG_SIMULATOR_H
+#define BZLA__BITBLAST_AIG_SIMULATOR_H
+
+#include <cstdint>
+#include <vector>
+
+#include "bitblast/aig/aig_manager.h"
+
+namespace bzla::bitblast {
+
+/**
+ * Bit-parallel AIG simulator.
+ *
+ * Evaluates AIG nodes under NUM_PATTERNS input patterns at once. The value of
+ * a node under all patterns is stored as a simulation word, where bit i of
+ * the word corresponds to pattern i. Inputs (AIG constants) are assigned
+ * words via set(), inputs without an assigned word evaluate to 0 under all
+ * patterns.
+ *
+ * Simulated words are cached until the next call to set() or reset(), hence
+ * simulating multiple nodes with shared cones only simulates shared nodes
+ * once. All simulated nodes must belong to the same AIG manager.
+ */
+class AigSimulator
+{
+ public:
+  /** The number of patterns that are simulated in parallel. */
+  static constexpr size_t NUM_PATTERNS = 64;
+
+  /**
+   * Assign simulation word to given input.
+   * @param input The input, may be negated.
+   * @param word  The word, bit i is the value of `input` under pattern i.
+   */
+  void set(const AigNode& input, uint64_t word);
+
+  /**
+   * Simulate given node.
+   * @param aig The node, may be negated.
+   * @return The simulation word of `aig`.
+   */
+  uint64_t simulate(const AigNode& aig);
+
+  /**
+   * Simulate given node and determine its value under a single pattern.
+   * @param aig     The node, may be negated.
+   * @param pattern The index of the pattern.
+   * @return The value of `aig` under given pattern.
+   */
+  bool value(const AigNode& aig, size_t pattern)
+  {
+    assert(pattern < NUM_PATTERNS);
+    return (simulate(aig) >> pattern) & 1;
+  }
+
+  /** Clear the assignment of all inputs. */
+  void reset();
+
+ private:
+  /** Ensure that the node data vectors can be indexed with all node ids. */
+  void resize();
+  /** @return The simulation word of given literal, must be simulated. */
+  uint64_t word(uint32_t lit) const
+  {
+    assert(d_stamps[lit >> 1] == d_gen);
+    return (lit & 1) ? ~d_words[lit >> 1] : d_words[lit >> 1];
+  }
+
+  /** The AIG manager of the simulated nodes. */
+  AigManager* d_mgr = nullptr;
+  /** The words assigned to inputs, indexed by node id. */
+  std::vector<uint64_t> d_inputs;
+  /** The simulated words, indexed by node id. */
+  std::vector<uint64_t> d_words;
+  /** The generation in which a word in d_words was simulated. */
+  std::vector<uint64_t> d_stamps;
+  /** The current generation, incremented when inputs change. */
+  uint64_t d_gen = 1;
+  /** Visit stack for simulate(), kept to avoid reallocation. */
+  std::vector<uint32_t> d_visit;
+};
+
+}  // namespace bzla::bitblast
+
+#endif
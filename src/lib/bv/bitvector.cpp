@@ -10,12 +10,14 @@
 
 #include "bv/bitvector.h"
 
+#include <algorithm>
 #include <bitset>
 #include <cassert>
 #include <iostream>
 #include <sstream>
 #include <utility>
 
+#include "bv/word_kernels.h"
 #include "rng/rng.h"
 
 namespace bzla {
@@ -171,6 +173,582 @@ mpz_mul_2exp_ull(mpz_t rop, const mpz_t op1, uint64_t op2)
   mpz_mul_2exp(rop, op1, op2);
 }
 
+// Kernels for the inline multi-limb representation of bit-vectors of size
+// s_native_size < size <= s_max_limbs_size. All kernels operate on arrays of
+// s_max_limbs 64-bit limbs (least significant limb first) and write all
+// s_max_limbs limbs of the result. Results may alias operands.
+
+constexpr uint64_t N_LIMBS = BitVector::s_max_limbs;
+
+/** @return The number of 64-bit limbs required to represent `size` bits. */
+uint64_t
+limbs_num(uint64_t size)
+{
+  return (size + 63) / 64;
+}
+
+/** Clear all bits >= size. */
+void
+limbs_normalize(uint64_t* r, uint64_t size)
+{
+  uint64_t n = limbs_num(size);
+  if (size % 64)
+  {
+    r[n - 1] &= UINT64_MAX >> (64 - size % 64);
+  }
+  for (uint64_t i = n; i < N_LIMBS; ++i)
+  {
+    r[i] = 0;
+  }
+}
+
+void
+limbs_set_ui(uint64_t* r, uint64_t value)
+{
+  r[0] = value;
+  for (uint64_t i = 1; i < N_LIMBS; ++i)
+  {
+    r[i] = 0;
+  }
+}
+
+bool
+limbs_is_zero(const uint64_t* a)
+{
+  uint64_t res = 0;
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    res |= a[i];
+  }
+  return res == 0;
+}
+
+int32_t
+limbs_cmp(const uint64_t* a, const uint64_t* b)
+{
+  for (uint64_t i = N_LIMBS; i-- > 0;)
+  {
+    if (a[i] != b[i])
+    {
+      return a[i] < b[i] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+bool
+limbs_bit(const uint64_t* a, uint64_t idx)
+{
+  return (a[idx / 64] >> (idx % 64)) & 1;
+}
+
+uint64_t
+clz64(uint64_t x)
+{
+  assert(x);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_clzll(x));
+#else
+  uint64_t res = 0;
+  for (uint64_t mask = (uint64_t) 1 << 63; (x & mask) == 0; mask >>= 1)
+  {
+    res += 1;
+  }
+  return res;
+#endif
+}
+
+uint64_t
+ctz64(uint64_t x)
+{
+  assert(x);
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_ctzll(x));
+#else
+  uint64_t res = 0;
+  for (; (x & 1) == 0; x >>= 1)
+  {
+    res += 1;
+  }
+  return res;
+#endif
+}
+
+uint64_t
+popcount64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_popcountll(x));
+#else
+  uint64_t res = 0;
+  for (; x; x &= x - 1)
+  {
+    res += 1;
+  }
+  return res;
+#endif
+}
+
+/** @return The number of significant bits, zero if `a` is zero. */
+uint64_t
+limbs_bitlen(const uint64_t* a)
+{
+  for (uint64_t i = N_LIMBS; i-- > 0;)
+  {
+    if (a[i])
+    {
+      return i * 64 + 64 - clz64(a[i]);
+    }
+  }
+  return 0;
+}
+
+/** @return The number of trailing zeros, N_LIMBS * 64 if `a` is zero. */
+uint64_t
+limbs_ctz(const uint64_t* a)
+{
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    if (a[i])
+    {
+      return i * 64 + ctz64(a[i]);
+    }
+  }
+  return N_LIMBS * 64;
+}
+
+/** r = a + b, @return The carry out of the most significant limb. */
+uint64_t
+limbs_add(uint64_t* r, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t carry = 0;
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    uint64_t bi = b[i];
+    uint64_t s  = a[i] + carry;
+    carry       = s < carry;
+    s += bi;
+    carry |= s < bi;
+    r[i] = s;
+  }
+  return carry;
+}
+
+/** r = a + value */
+void
+limbs_add_ui(uint64_t* r, const uint64_t* a, uint64_t value)
+{
+  uint64_t carry = value;
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    uint64_t s = a[i] + carry;
+    carry      = s < carry;
+    r[i]       = s;
+  }
+}
+
+/** r = a - b, @return The borrow out of the most significant limb. */
+uint64_t
+limbs_sub(uint64_t* r, const uint64_t* a, const uint64_t* b)
+{
+  uint64_t borrow = 0;
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    uint64_t ai = a[i];
+    uint64_t bi = b[i];
+    uint64_t d  = ai - bi;
+    uint64_t b1 = ai < bi;
+    r[i]        = d - borrow;
+    borrow      = b1 | (d < borrow);
+  }
+  return borrow;
+}
+
+/** r = a - value */
+void
+limbs_sub_ui(uint64_t* r, const uint64_t* a, uint64_t value)
+{
+  uint64_t borrow = value;
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    uint64_t ai = a[i];
+    r[i]        = ai - borrow;
+    borrow      = ai < borrow;
+  }
+}
+
+/** r = a << shift, shift < N_LIMBS * 64 */
+void
+limbs_shl(uint64_t* r, const uint64_t* a, uint64_t shift)
+{
+  assert(shift < N_LIMBS * 64);
+  uint64_t nlimbs = shift / 64;
+  uint64_t nbits  = shift % 64;
+  // Iterate from most to least significant limb to allow r == a.
+  for (uint64_t i = N_LIMBS; i-- > 0;)
+  {
+    uint64_t res = 0;
+    if (i >= nlimbs)
+    {
+      res = a[i - nlimbs] << nbits;
+      if (nbits && i > nlimbs)
+      {
+        res |= a[i - nlimbs - 1] >> (64 - nbits);
+      }
+    }
+    r[i] = res;
+  }
+}
+
+/** r = a >> shift, shift < N_LIMBS * 64 */
+void
+limbs_shr(uint64_t* r, const uint64_t* a, uint64_t shift)
+{
+  assert(shift < N_LIMBS * 64);
+  uint64_t nlimbs = shift / 64;
+  uint64_t nbits  = shift % 64;
+  // Iterate from least to most significant limb to allow r == a.
+  for (uint64_t i = 0; i < N_LIMBS; ++i)
+  {
+    uint64_t res = 0;
+    if (i + nlimbs < N_LIMBS)
+    {
+      res = a[i + nlimbs] >> nbits;
+      if (nbits && i + nlimbs + 1 < N_LIMBS)
+      {
+        res |= a[i + nlimbs + 1] << (64 - nbits);
+      }
+    }
+    r[i] = res;
+  }
+}
+
+/** @return The low 64 bit of a * b, the high 64 bit are stored in `hi`. */
+uint64_t
+mul64(uint64_t a, uint64_t b, uint64_t* hi)
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128_t = unsigned __int128;
+  uint128_t p = static_cast<uint128_t>(a) * b;
+  *hi         = static_cast<uint64_t>(p >> 64);
+  return static_cast<uint64_t>(p);
+#else
+  uint64_t a_lo = a & UINT32_MAX, a_hi = a >> 32;
+  uint64_t b_lo = b & UINT32_MAX, b_hi = b >> 32;
+  uint64_t p0  = a_lo * b_lo;
+  uint64_t p1  = a_lo * b_hi;
+  uint64_t p2  = a_hi * b_lo;
+  uint64_t p3  = a_hi * b_hi;
+  uint64_t mid = (p0 >> 32) + (p1 & UINT32_MAX) + (p2 & UINT32_MAX);
+  *hi          = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+  return (mid << 32) | (p0 & UINT32_MAX);
+#endif
+}
+
+/** r = a * b mod 2^(64 * limbs_num(size)) */
+void
+limbs_mul(uint64_t* r, const uint64_t* a, const uint64_t* b, uint64_t size)
+{
+  uint64_t n = limbs_num(size);
+  uint64_t res[N_LIMBS] = {0};
+  for (uint64_t i = 0; i < n; ++i)
+  {
+    uint64_t ai = a[i];
+    if (ai == 0) continue;
+    uint64_t carry = 0;
+    for (uint64_t j = 0; i + j < n; ++j)
+    {
+      uint64_t hi;
+      uint64_t lo = mul64(ai, b[j], &hi);
+      lo += carry;
+      hi += lo < carry;
+      lo += res[i + j];
+      hi += lo < res[i + j];
+      res[i + j] = lo;
+      carry      = hi;
+    }
+  }
+  std::copy(res, res + N_LIMBS, r);
+}
+
+/**
+ * Unsigned division with remainder, b must not be zero.
+ * @param q The resulting quotient, may be nullptr.
+ * @param r The resulting remainder, may be nullptr.
+ */
+void
+limbs_udivrem(uint64_t* q,
+              uint64_t* r,
+              const uint64_t* a,
+              const uint64_t* b)
+{
+  assert(!limbs_is_zero(b));
+  uint64_t quot[N_LIMBS] = {0};
+  uint64_t rem[N_LIMBS]  = {0};
+  uint64_t nbits_a       = limbs_bitlen(a);
+  uint64_t nbits_b       = limbs_bitlen(b);
+
+  if (nbits_a < nbits_b)
+  {
+    std::copy(a, a + N_LIMBS, rem);
+  }
+#if defined(__SIZEOF_INT128__)
+  else if (nbits_b <= 64)
+  {
+    // Single limb divisor, divide limb-wise from most significant limb.
+    __extension__ using uint128_t = unsigned __int128;
+    uint64_t d  = b[0];
+    uint128_t x = 0;
+    for (uint64_t i = limbs_num(nbits_a); i-- > 0;)
+    {
+      x       = (x << 64) | a[i];
+      quot[i] = static_cast<uint64_t>(x / d);
+      x       = x % d;
+    }
+    rem[0] = static_cast<uint64_t>(x);
+  }
+#endif
+  else
+  {
+    // Shift-subtract over the quotient bits, the remainder is initialized
+    // with the (nbits_b - 1) most significant bits of a.
+    uint64_t shift = nbits_a - nbits_b + 1;
+    if (shift < N_LIMBS * 64)
+    {
+      limbs_shr(rem, a, shift);
+    }
+    for (uint64_t i = shift; i-- > 0;)
+    {
+      uint64_t top = rem[N_LIMBS - 1] >> 63;
+      limbs_shl(rem, rem, 1);
+      rem[0] |= limbs_bit(a, i);
+      if (top || limbs_cmp(rem, b) >= 0)
+      {
+        limbs_sub(rem, rem, b);
+        quot[i / 64] |= (uint64_t) 1 << (i % 64);
+      }
+    }
+  }
+  if (q)
+  {
+    std::copy(quot, quot + N_LIMBS, q);
+  }
+  if (r)
+  {
+    std::copy(rem, rem + N_LIMBS, r);
+  }
+}
+
+// Operations on GMP values of bit-vectors of size > s_max_limbs_size that
+// work directly on the limbs of the GMP value via the word kernels (see
+// word_kernels.h). This avoids the intermediate results and the additional
+// passes for truncation of the corresponding mpz_* functions. Falls back to
+// the mpz_* functions if GMP limbs are not 64-bit words.
+
+#if GMP_NUMB_BITS == 64 && GMP_NAIL_BITS == 0
+#define BZLA_BV_WORD_KERNELS
+#endif
+
+enum class BitwiseOp
+{
+  AND,
+  NAND,
+  NOR,
+  OR,
+  XNOR,
+  XOR,
+};
+
+#ifdef BZLA_BV_WORD_KERNELS
+/** @return The number of 64-bit words required to represent `size` bits. */
+size_t
+mpz_words(uint64_t size)
+{
+  return static_cast<size_t>((size + 63) / 64);
+}
+
+/**
+ * Mask out the bits >= size in the most significant word and normalize `r`.
+ * @param r  The GMP value.
+ * @param rp The limbs of `r` as returned by mpz_limbs_modify().
+ * @param size The bit-width.
+ */
+void
+mpz_words_finish(mpz_t r, uint64_t* rp, uint64_t size)
+{
+  size_t n = mpz_words(size);
+  if (size % 64)
+  {
+    rp[n - 1] &= ~uint64_t(0) >> (64 - size % 64);
+  }
+  mpz_limbs_finish(r, static_cast<mp_size_t>(n));
+}
+#endif
+
+/**
+ * Compute `r = op(a, b)` truncated to `size` bits.
+ * @note `r` may alias `a` and `b`.
+ */
+void
+mpz_bitwise(mpz_t r,
+            const mpz_t a,
+            const mpz_t b,
+            uint64_t size,
+            BitwiseOp op)
+{
+#ifdef BZLA_BV_WORD_KERNELS
+  const WordKernels& kernels = word_kernels();
+  WordKernels::BinaryFun fun = nullptr;
+  switch (op)
+  {
+    case BitwiseOp::AND: fun = kernels.bvand; break;
+    case BitwiseOp::NAND: fun = kernels.bvnand; break;
+    case BitwiseOp::NOR: fun = kernels.bvnor; break;
+    case BitwiseOp::OR: fun = kernels.bvor; break;
+    case BitwiseOp::XNOR: fun = kernels.bvxnor; break;
+    case BitwiseOp::XOR: fun = kernels.bvxor; break;
+  }
+  size_t n  = mpz_words(size);
+  size_t as = mpz_size(a);
+  size_t bs = mpz_size(b);
+  // Get the result limbs first, mpz_limbs_modify() may reallocate the limbs
+  // of an aliased operand.
+  uint64_t* rp = reinterpret_cast<uint64_t*>(
+      mpz_limbs_modify(r, static_cast<mp_size_t>(n)));
+  const uint64_t* ap = reinterpret_cast<const uint64_t*>(mpz_limbs_read(a));
+  const uint64_t* bp = reinterpret_cast<const uint64_t*>(mpz_limbs_read(b));
+  size_t m           = std::min(as, bs);
+  fun(rp, ap, bp, m);
+  // Words beyond the size of one of the operands are zero in that operand.
+  bool keep = op != BitwiseOp::AND && op != BitwiseOp::NAND;
+  bool neg  = op == BitwiseOp::NAND || op == BitwiseOp::NOR
+             || op == BitwiseOp::XNOR;
+  for (size_t i = m; i < n; ++i)
+  {
+    uint64_t x = keep ? (i < as ? ap[i] : (i < bs ? bp[i] : 0)) : 0;
+    rp[i]      = neg ? ~x : x;
+  }
+  mpz_words_finish(r, rp, size);
+#else
+  switch (op)
+  {
+    case BitwiseOp::AND:
+    case BitwiseOp::NAND: mpz_and(r, a, b); break;
+    case BitwiseOp::NOR:
+    case BitwiseOp::OR: mpz_ior(r, a, b); break;
+    case BitwiseOp::XNOR:
+    case BitwiseOp::XOR: mpz_xor(r, a, b); break;
+  }
+  if (op == BitwiseOp::NAND || op == BitwiseOp::NOR || op == BitwiseOp::XNOR)
+  {
+    mpz_com(r, r);
+  }
+  mpz_fdiv_r_2exp_ull(r, r, size);
+#endif
+}
+
+/**
+ * Compute `r = ~a` truncated to `size` bits.
+ * @note `r` may alias `a`.
+ */
+void
+mpz_not(mpz_t r, const mpz_t a, uint64_t size)
+{
+#ifdef BZLA_BV_WORD_KERNELS
+  size_t n  = mpz_words(size);
+  size_t as = mpz_size(a);
+  uint64_t* rp = reinterpret_cast<uint64_t*>(
+      mpz_limbs_modify(r, static_cast<mp_size_t>(n)));
+  const uint64_t* ap = reinterpret_cast<const uint64_t*>(mpz_limbs_read(a));
+  word_kernels().bvnot(rp, ap, as);
+  std::fill(rp + as, rp + n, ~uint64_t(0));
+  mpz_words_finish(r, rp, size);
+#else
+  mpz_com(r, a);
+  mpz_fdiv_r_2exp_ull(r, r, size);
+#endif
+}
+
+/**
+ * Compute `r = a << shift` truncated to `size` bits, `shift < size`.
+ * @note `r` may alias `a`.
+ */
+void
+mpz_shl(mpz_t r, const mpz_t a, uint64_t shift, uint64_t size)
+{
+  assert(shift < size);
+#ifdef BZLA_BV_WORD_KERNELS
+  size_t n  = mpz_words(size);
+  size_t as = mpz_size(a);
+  uint64_t* rp = reinterpret_cast<uint64_t*>(
+      mpz_limbs_modify(r, static_cast<mp_size_t>(n)));
+  const uint64_t* ap = reinterpret_cast<const uint64_t*>(mpz_limbs_read(a));
+  if (rp != ap)
+  {
+    std::copy(ap, ap + as, rp);
+  }
+  std::fill(rp + as, rp + n, 0);
+  word_kernels().shl(rp, rp, n, shift);
+  mpz_words_finish(r, rp, size);
+#else
+  mpz_mul_2exp_ull(r, a, shift);
+  mpz_fdiv_r_2exp_ull(r, r, size);
+#endif
+}
+
+/**
+ * Compute `r = a >> shift` for a value `a` of `size` bits, `shift < size`.
+ * @note `r` may alias `a`.
+ */
+void
+mpz_shr(mpz_t r, const mpz_t a, uint64_t shift, uint64_t size)
+{
+  assert(shift < size);
+  (void) size;
+#ifdef BZLA_BV_WORD_KERNELS
+  size_t as = mpz_size(a);
+  if (shift >= 64 * as)
+  {
+    mpz_set_ui(r, 0);
+    return;
+  }
+  uint64_t* rp = reinterpret_cast<uint64_t*>(
+      mpz_limbs_modify(r, static_cast<mp_size_t>(as)));
+  const uint64_t* ap = reinterpret_cast<const uint64_t*>(mpz_limbs_read(a));
+  word_kernels().shr(rp, ap, as, shift);
+  mpz_limbs_finish(r, static_cast<mp_size_t>(as));
+#else
+  mpz_fdiv_q_2exp_ull(r, a, shift);
+#endif
+}
+
+#ifdef BZLA_BV_WORD_KERNELS
+/** @return The number of leading ones of value `a` of `size` bits. */
+uint64_t
+mpz_count_leading_ones(const mpz_t a, uint64_t size)
+{
+  size_t n = mpz_words(size);
+  if (mpz_size(a) < n)
+  {
+    return 0;
+  }
+  const uint64_t* ap = reinterpret_cast<const uint64_t*>(mpz_limbs_read(a));
+  uint64_t rem       = size % 64;
+  uint64_t pad       = rem ? 64 - rem : 0;
+  uint64_t top       = ap[n - 1] | ~(~uint64_t(0) >> pad);
+  if (~top)
+  {
+    return clz64(~top) - pad;
+  }
+  size_t i = word_kernels().find_last_not(ap, n - 1, ~uint64_t(0));
+  if (i == n - 1)
+  {
+    return size;
+  }
+  return (n - 1 - i) * 64 - pad + clz64(~ap[i]);
+}
+#endif
+
 }  // namespace
 
 bool
@@ -191,6 +769,14 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
     {
       res = mpz_cmp(tmp, min.d_val_gmp) <= 0;
     }
+    else if (min.is_limbs())
+    {
+      mpz_t bound;
+      mpz_init(bound);
+      min.get_mpz(bound);
+      res = mpz_cmp(tmp, bound) <= 0;
+      mpz_clear(bound);
+    }
     else
     {
       res = mpz_cmp_ui(tmp, min.d_val_uint64) <= 0;
@@ -203,6 +789,14 @@ BitVector::fits_in_size(uint64_t size, const std::string& str, uint32_t base)
     {
       res = mpz_cmp(tmp, max.d_val_gmp) <= 0;
     }
+    else if (max.is_limbs())
+    {
+      mpz_t bound;
+      mpz_init(bound);
+      max.get_mpz(bound);
+      res = mpz_cmp(tmp, bound) <= 0;
+      mpz_clear(bound);
+    }
     else
     {
       res = mpz_cmp_ui(tmp, max.d_val_uint64) <= 0;
@@ -255,12 +849,17 @@ BitVector
 BitVector::mk_ones(uint64_t size)
 {
   BitVector res(size);
-  if (size > s_native_size)
+  if (res.is_gmp())
   {
     mpz_set_ui(res.d_val_gmp, 1);
     mpz_mul_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
     mpz_sub_ui(res.d_val_gmp, res.d_val_gmp, 1);
   }
+  else if (res.is_limbs())
+  {
+    std::fill(res.d_val_limbs, res.d_val_limbs + N_LIMBS, UINT64_MAX);
+    limbs_normalize(res.d_val_limbs, size);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, UINT64_MAX);
@@ -304,6 +903,10 @@ BitVector::BitVector(uint64_t size) : d_size(size), d_val_uint64(0)
   {
     mpz_init(d_val_gmp);
   }
+  else if (is_limbs())
+  {
+    limbs_set_ui(d_val_limbs, 0);
+  }
 }
 
 BitVector::BitVector(uint64_t size, RNG& rng) : BitVector(size)
@@ -313,6 +916,15 @@ BitVector::BitVector(uint64_t size, RNG& rng) : BitVector(size)
     mpz_urandomb(d_val_gmp, *rng.get_gmp_state(), size);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (is_limbs())
+  {
+    // Draw via GMP to get the same random sequence as for GMP values.
+    mpz_t tmp;
+    mpz_init(tmp);
+    mpz_urandomb(tmp, *rng.get_gmp_state(), size);
+    set_mpz(size, tmp);
+    mpz_clear(tmp);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(
@@ -391,6 +1003,14 @@ BitVector::BitVector(uint64_t size, const std::string& value, uint32_t base)
      * absolute value of 'value') in GMP when created from mpz_init_set_str. */
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (is_limbs())
+  {
+    mpz_t tmp;
+    mpz_init_set_str(tmp, value.c_str(), base);
+    mpz_fdiv_r_2exp_ull(tmp, tmp, size);
+    set_mpz(size, tmp);
+    mpz_clear(tmp);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(
@@ -411,6 +1031,11 @@ BitVector::from_ui(uint64_t size, uint64_t value, bool truncate)
     mpz_init_set_ull(res.d_val_gmp, value);
     mpz_fdiv_r_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
   }
+  else if (res.is_limbs())
+  {
+    limbs_set_ui(res.d_val_limbs, value);
+    limbs_normalize(res.d_val_limbs, size);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, value);
@@ -431,6 +1056,14 @@ BitVector::from_si(uint64_t size, int64_t value, bool truncate)
     mpz_init_set_sll(res.d_val_gmp, value);
     mpz_fdiv_r_2exp_ull(res.d_val_gmp, res.d_val_gmp, size);
   }
+  else if (res.is_limbs())
+  {
+    std::fill(res.d_val_limbs,
+              res.d_val_limbs + N_LIMBS,
+              value < 0 ? UINT64_MAX : 0);
+    res.d_val_limbs[0] = static_cast<uint64_t>(value);
+    limbs_normalize(res.d_val_limbs, size);
+  }
   else
   {
     res.d_val_uint64 = uint64_fdiv_r_2exp(size, static_cast<uint64_t>(value));
@@ -455,6 +1088,10 @@ BitVector::BitVector(const BitVector& other)
     {
       mpz_init_set(d_val_gmp, other.d_val_gmp);
     }
+    else if (is_limbs())
+    {
+      std::copy(other.d_val_limbs, other.d_val_limbs + N_LIMBS, d_val_limbs);
+    }
     else
     {
       d_val_uint64 = other.d_val_uint64;
@@ -471,6 +1108,11 @@ BitVector::BitVector(BitVector&& other)
       mpz_set(d_val_gmp, other.d_val_gmp);
       mpz_clear(other.d_val_gmp);
     }
+    else if (other.is_limbs())
+    {
+      mpz_clear(d_val_gmp);
+      std::copy(other.d_val_limbs, other.d_val_limbs + N_LIMBS, d_val_limbs);
+    }
     else
     {
       mpz_clear(d_val_gmp);
@@ -484,6 +1126,10 @@ BitVector::BitVector(BitVector&& other)
       mpz_init_set(d_val_gmp, other.d_val_gmp);
       mpz_clear(other.d_val_gmp);
     }
+    else if (other.is_limbs())
+    {
+      std::copy(other.d_val_limbs, other.d_val_limbs + N_LIMBS, d_val_limbs);
+    }
     else
     {
       d_val_uint64 = std::exchange(other.d_val_uint64, 0);
@@ -521,6 +1167,11 @@ BitVector::operator=(const BitVector& other)
       {
         mpz_init_set(d_val_gmp, other.d_val_gmp);
       }
+      else if (other.is_limbs())
+      {
+        std::copy(
+            other.d_val_limbs, other.d_val_limbs + N_LIMBS, d_val_limbs);
+      }
       else
       {
         d_val_uint64 = other.d_val_uint64;
@@ -531,7 +1182,15 @@ BitVector::operator=(const BitVector& other)
       if (!other.is_gmp())
       {
         mpz_clear(d_val_gmp);
-        d_val_uint64 = other.d_val_uint64;
+        if (other.is_limbs())
+        {
+          std::copy(
+              other.d_val_limbs, other.d_val_limbs + N_LIMBS, d_val_limbs);
+        }
+        else
+        {
+          d_val_uint64 = other.d_val_uint64;
+        }
       }
       else
       {
@@ -586,6 +1245,33 @@ BitVector::hash() const
       res = ((x >> 16) ^ x);
     }
   }
+  else if (is_limbs())
+  {
+    // same as for GMP values with 64-bit limbs, zero limbs are disregarded
+    for (n = N_LIMBS; n > 0 && d_val_limbs[n - 1] == 0; --n)
+      ;
+    for (i = 0, j = 0; i < n; ++i)
+    {
+      p0 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      p1 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      uint64_t lo = d_val_limbs[i];
+      uint64_t hi = (d_val_limbs[i] >> 32);
+      x           = lo ^ res;
+      x           = ((x >> 16) ^ x) * p0;
+      x           = ((x >> 16) ^ x) * p1;
+      x           = ((x >> 16) ^ x);
+      p0          = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      p1 = s_hash_primes[j++];
+      if (j == s_n_primes) j = 0;
+      x   = x ^ hi;
+      x   = ((x >> 16) ^ x) * p0;
+      x   = ((x >> 16) ^ x) * p1;
+      res = ((x >> 16) ^ x);
+    }
+  }
   else
   {
     p0 = s_hash_primes[j++];
@@ -611,6 +1297,11 @@ BitVector::iset(uint64_t value)
     mpz_set_ull(d_val_gmp, value);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, d_size);
   }
+  else if (is_limbs())
+  {
+    limbs_set_ui(d_val_limbs, value);
+    limbs_normalize(d_val_limbs, d_size);
+  }
   else
   {
     d_val_uint64 = uint64_fdiv_r_2exp(d_size, value);
@@ -627,6 +1318,10 @@ BitVector::iset(const BitVector& bv)
   {
     mpz_set(d_val_gmp, bv.d_val_gmp);
   }
+  else if (is_limbs())
+  {
+    std::copy(bv.d_val_limbs, bv.d_val_limbs + N_LIMBS, d_val_limbs);
+  }
   else
   {
     d_val_uint64 = bv.d_val_uint64;
@@ -667,6 +1362,21 @@ BitVector::iset(RNG& rng,
       mpz_add(d_val_gmp, d_val_gmp, from.d_val_gmp);
     }
   }
+  else if (is_limbs())
+  {
+    // Draw via GMP to get the same random sequence as for GMP values.
+    mpz_t range, val;
+    mpz_init(range);
+    mpz_init(val);
+    to.bvsub(from).get_mpz(range);
+    mpz_add_ui(range, range, 1);
+    mpz_urandomm(val, *rng.get_gmp_state(), range);
+    from.add_to_mpz(val);
+    mpz_fdiv_r_2exp_ull(val, val, d_size);
+    set_mpz(d_size, val);
+    mpz_clear(range);
+    mpz_clear(val);
+  }
   else
   {
     if (is_signed)
@@ -703,10 +1413,16 @@ BitVector::str(uint32_t base) const
 {
   if (is_null()) return "(nil)";
 
-  if (is_gmp())
+  if (is_gmp() || is_limbs())
   {
+    mpz_t limbs_val;
+    if (is_limbs())
+    {
+      mpz_init(limbs_val);
+      get_mpz(limbs_val);
+    }
     std::stringstream res;
-    char* tmp = mpz_get_str(0, base, d_val_gmp);
+    char* tmp = mpz_get_str(0, base, is_gmp() ? d_val_gmp : limbs_val);
     assert(tmp[0] != '-');  // may not be negative
     if (base == 2)
     {
@@ -719,6 +1435,10 @@ BitVector::str(uint32_t base) const
     res << tmp;
     assert(base != 2 || res.str().size() == d_size);
     free(tmp);
+    if (is_limbs())
+    {
+      mpz_clear(limbs_val);
+    }
     return res.str();
   }
 
@@ -746,6 +1466,10 @@ BitVector::to_uint64(bool truncate) const
   {
     return mpz_get_ull(d_val_gmp);
   }
+  if (is_limbs())
+  {
+    return d_val_limbs[0];
+  }
   return d_val_uint64;
 }
 
@@ -764,6 +1488,10 @@ BitVector::compare(const BitVector& bv) const
   {
     return mpz_cmp(d_val_gmp, bv.d_val_gmp);
   }
+  if (is_limbs())
+  {
+    return limbs_cmp(d_val_limbs, bv.d_val_limbs);
+  }
 
   if (d_val_uint64 == bv.d_val_uint64)
   {
@@ -810,6 +1538,10 @@ BitVector::bit(uint64_t idx) const
   {
     return mpz_tstbit(d_val_gmp, idx);
   }
+  if (is_limbs())
+  {
+    return limbs_bit(d_val_limbs, idx);
+  }
   return (d_val_uint64 >> idx) & 1;
 }
 
@@ -829,6 +1561,17 @@ BitVector::set_bit(uint64_t idx, bool value)
       mpz_clrbit(d_val_gmp, idx);
     }
   }
+  else if (is_limbs())
+  {
+    if (value)
+    {
+      d_val_limbs[idx / 64] |= ((uint64_t) 1 << (idx % 64));
+    }
+    else
+    {
+      d_val_limbs[idx / 64] &= ~((uint64_t) 1 << (idx % 64));
+    }
+  }
   else
   {
     if (value)
@@ -850,6 +1593,10 @@ BitVector::flip_bit(uint64_t idx)
   {
     mpz_combit(d_val_gmp, idx);
   }
+  else if (is_limbs())
+  {
+    d_val_limbs[idx / 64] ^= ((uint64_t) 1 << (idx % 64));
+  }
   else
   {
     set_bit(idx, bit(idx) ? false : true);
@@ -894,6 +1641,10 @@ BitVector::is_zero() const
   {
     return mpz_cmp_ui(d_val_gmp, 0) == 0;
   }
+  if (is_limbs())
+  {
+    return limbs_is_zero(d_val_limbs);
+  }
   return d_val_uint64 == 0;
 }
 
@@ -924,6 +1675,10 @@ BitVector::is_ones() const
         - d_size % static_cast<uint64_t>(mp_bits_per_limb);
     return (static_cast<uint64_t>(limb)) == (max >> m);
   }
+  if (is_limbs())
+  {
+    return count_trailing_ones() == d_size;
+  }
   return d_val_uint64 == uint64_fdiv_r_2exp(d_size, UINT64_MAX);
 }
 
@@ -935,6 +1690,10 @@ BitVector::is_one() const
   {
     return mpz_cmp_ui(d_val_gmp, 1) == 0;
   }
+  if (is_limbs())
+  {
+    return limbs_ctz(d_val_limbs) == 0 && limbs_bitlen(d_val_limbs) == 1;
+  }
   return d_val_uint64 == 1;
 }
 
@@ -946,6 +1705,10 @@ BitVector::is_min_signed() const
   {
     if (mpz_scan1(d_val_gmp, 0) != d_size - 1) return false;
   }
+  else if (is_limbs())
+  {
+    if (limbs_ctz(d_val_limbs) != d_size - 1) return false;
+  }
   else
   {
     if (d_val_uint64
@@ -965,6 +1728,10 @@ BitVector::is_max_signed() const
   {
     if (mpz_scan0(d_val_gmp, 0) != d_size - 1) return false;
   }
+  else if (is_limbs())
+  {
+    if (count_trailing_ones() != d_size - 1) return false;
+  }
   else
   {
     if (d_size == 1) return d_val_uint64 == 0;
@@ -995,6 +1762,12 @@ BitVector::is_uadd_overflow(const BitVector& bv) const
 {
   assert(!is_null());
   assert(d_size == bv.d_size);
+  if (is_limbs())
+  {
+    uint64_t add[N_LIMBS];
+    uint64_t carry = limbs_add(add, d_val_limbs, bv.d_val_limbs);
+    return carry || (d_size < N_LIMBS * 64 && limbs_bit(add, d_size));
+  }
   mpz_t add;
   if (is_gmp())
   {
@@ -1063,6 +1836,16 @@ BitVector::is_umul_overflow(const BitVector& bv) const
       mpz_init(mul);
       mpz_mul(mul, d_val_gmp, bv.d_val_gmp);
     }
+    else if (is_limbs())
+    {
+      mpz_t tmp;
+      mpz_init(mul);
+      mpz_init(tmp);
+      get_mpz(mul);
+      bv.get_mpz(tmp);
+      mpz_mul(mul, mul, tmp);
+      mpz_clear(tmp);
+    }
     else
     {
       mpz_init_set_ui(mul, d_val_uint64);
@@ -1113,6 +1896,11 @@ BitVector::count_trailing_zeros() const
     res = mpz_scan1(d_val_gmp, 0);
     if (res > d_size) res = d_size;
   }
+  else if (is_limbs())
+  {
+    res = limbs_ctz(d_val_limbs);
+    if (res > d_size) res = d_size;
+  }
   else
   {
     for (uint64_t i = 0; i < d_size; ++i)
@@ -1134,6 +1922,16 @@ BitVector::count_trailing_ones() const
     res = mpz_scan0(d_val_gmp, 0);
     if (res > d_size) res = d_size;
   }
+  else if (is_limbs())
+  {
+    uint64_t limbs[N_LIMBS];
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      limbs[i] = ~d_val_limbs[i];
+    }
+    res = limbs_ctz(limbs);
+    if (res > d_size) res = d_size;
+  }
   else
   {
     for (uint64_t i = 0; i < d_size; ++i)
@@ -1515,6 +2313,11 @@ BitVector::ibvneg(const BitVector& bv)
     mpz_add_ui(d_val_gmp, d_val_gmp, 1);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, d_size);
   }
+  else if (is_limbs())
+  {
+    limbs_add_ui(d_val_limbs, d_val_limbs, 1);
+    limbs_normalize(d_val_limbs, d_size);
+  }
   else
   {
     d_val_uint64 += 1;
@@ -1536,8 +2339,19 @@ BitVector::ibvnot(const BitVector& bv)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_com(d_val_gmp, bv.d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_not(d_val_gmp, bv.d_val_gmp, size);
+  }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = ~bv.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1567,6 +2381,15 @@ BitVector::ibvinc(const BitVector& bv)
     mpz_add_ui(d_val_gmp, bv.d_val_gmp, 1);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_add_ui(d_val_limbs, bv.d_val_limbs, 1);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1595,6 +2418,15 @@ BitVector::ibvdec(const BitVector& bv)
     mpz_sub_ui(d_val_gmp, bv.d_val_gmp, 1);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_sub_ui(d_val_limbs, bv.d_val_limbs, 1);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1640,6 +2472,10 @@ BitVector::ibvredor(const BitVector& bv)
       }
     }
   }
+  else if (bv.is_limbs())
+  {
+    val = limbs_is_zero(bv.d_val_limbs) ? 0 : 1;
+  }
   else if (bv.d_val_uint64 != 0)
   {
     val = 1;
@@ -1659,6 +2495,13 @@ BitVector::ibvredxor(const BitVector& bv)
   {
     val = mpz_popcount(bv.d_val_gmp) % 2 > 0 ? 1 : 0;
   }
+  else if (bv.is_limbs())
+  {
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      val ^= popcount64(bv.d_val_limbs[i]) & 1;
+    }
+  }
   else if (bv.d_val_uint64 != 0)
   {
     for (uint64_t i = 0; i < bv.d_size; ++i)
@@ -1703,6 +2546,15 @@ BitVector::ibvadd(const BitVector& bv0, const BitVector& bv1)
     mpz_add(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_add(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1734,6 +2586,15 @@ BitVector::ibvsub(const BitVector& bv0, const BitVector& bv1)
     mpz_sub(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_sub(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -1762,8 +2623,20 @@ BitVector::ibvand(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_bitwise(
+        d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp, size, BitwiseOp::AND);
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = bv0.d_val_limbs[i] & bv1.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1811,9 +2684,20 @@ BitVector::ibvnand(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_and(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_com(d_val_gmp, d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_bitwise(
+        d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp, size, BitwiseOp::NAND);
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = ~(bv0.d_val_limbs[i] & bv1.d_val_limbs[i]);
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1843,9 +2727,20 @@ BitVector::ibvnor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_com(d_val_gmp, d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_bitwise(
+        d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp, size, BitwiseOp::NOR);
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = ~(bv0.d_val_limbs[i] | bv1.d_val_limbs[i]);
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1875,8 +2770,20 @@ BitVector::ibvor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_ior(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_bitwise(
+        d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp, size, BitwiseOp::OR);
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = bv0.d_val_limbs[i] | bv1.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1906,9 +2813,20 @@ BitVector::ibvxnor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_com(d_val_gmp, d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_bitwise(
+        d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp, size, BitwiseOp::XNOR);
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = ~(bv0.d_val_limbs[i] ^ bv1.d_val_limbs[i]);
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1938,8 +2856,20 @@ BitVector::ibvxor(const BitVector& bv0, const BitVector& bv1)
     {
       mpz_init(d_val_gmp);
     }
-    mpz_xor(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    mpz_bitwise(
+        d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp, size, BitwiseOp::XOR);
+  }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      d_val_limbs[i] = bv0.d_val_limbs[i] ^ bv1.d_val_limbs[i];
+    }
+    limbs_normalize(d_val_limbs, size);
   }
   else
   {
@@ -1968,6 +2898,13 @@ BitVector::ibveq(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) == 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 == bv1.d_val_uint64)
   {
     val = 1;
@@ -1987,7 +2924,14 @@ BitVector::ibvne(const BitVector& bv0, const BitVector& bv1)
   uint64_t val = 0;
   if (bv0.is_gmp())
   {
-    if (mpz_cmp(bv0.d_val_gmp, bv1.d_val_gmp) != 0)
+    if (mpz_cmp(bv0.d_val_gmp, bv1.d_val_gmp) != 0)
+    {
+      val = 1;
+    }
+  }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) != 0)
     {
       val = 1;
     }
@@ -2016,6 +2960,13 @@ BitVector::ibvult(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) < 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 < bv1.d_val_uint64)
   {
     val = 1;
@@ -2040,6 +2991,13 @@ BitVector::ibvule(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) <= 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 <= bv1.d_val_uint64)
   {
     val = 1;
@@ -2064,6 +3022,13 @@ BitVector::ibvugt(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) > 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 > bv1.d_val_uint64)
   {
     val = 1;
@@ -2088,6 +3053,13 @@ BitVector::ibvuge(const BitVector& bv0, const BitVector& bv1)
       val = 1;
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (limbs_cmp(bv0.d_val_limbs, bv1.d_val_limbs) >= 0)
+    {
+      val = 1;
+    }
+  }
   else if (bv0.d_val_uint64 >= bv1.d_val_uint64)
   {
     val = 1;
@@ -2225,8 +3197,23 @@ BitVector::ibvshl(const BitVector& bv, uint64_t shift)
     }
     else
     {
-      mpz_mul_2exp_ull(d_val_gmp, bv.d_val_gmp, shift);
-      mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+      mpz_shl(d_val_gmp, bv.d_val_gmp, shift, size);
+    }
+  }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (shift >= size)
+    {
+      limbs_set_ui(d_val_limbs, 0);
+    }
+    else
+    {
+      limbs_shl(d_val_limbs, bv.d_val_limbs, shift);
+      limbs_normalize(d_val_limbs, size);
     }
   }
   else
@@ -2278,7 +3265,14 @@ BitVector::ibvshl(const BitVector& bv, const BitVector& shift)
       {
         mpz_clear(d_val_gmp);
       }
-      d_val_uint64 = 0;
+      if (bv.is_limbs())
+      {
+        limbs_set_ui(d_val_limbs, 0);
+      }
+      else
+      {
+        d_val_uint64 = 0;
+      }
     }
   }
   d_size = size;
@@ -2304,7 +3298,22 @@ BitVector::ibvshr(const BitVector& bv, uint64_t shift)
     }
     else
     {
-      mpz_fdiv_q_2exp_ull(d_val_gmp, bv.d_val_gmp, shift);
+      mpz_shr(d_val_gmp, bv.d_val_gmp, shift, size);
+    }
+  }
+  else if (bv.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (shift >= size)
+    {
+      limbs_set_ui(d_val_limbs, 0);
+    }
+    else
+    {
+      limbs_shr(d_val_limbs, bv.d_val_limbs, shift);
     }
   }
   else
@@ -2356,7 +3365,14 @@ BitVector::ibvshr(const BitVector& bv, const BitVector& shift)
       {
         mpz_clear(d_val_gmp);
       }
-      d_val_uint64 = 0;
+      if (bv.is_limbs())
+      {
+        limbs_set_ui(d_val_limbs, 0);
+      }
+      else
+      {
+        d_val_uint64 = 0;
+      }
     }
   }
   d_size = size;
@@ -2424,6 +3440,15 @@ BitVector::ibvmul(const BitVector& bv0, const BitVector& bv1)
     mpz_mul(d_val_gmp, bv0.d_val_gmp, bv1.d_val_gmp);
     mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    limbs_mul(d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs, size);
+    limbs_normalize(d_val_limbs, size);
+  }
   else
   {
     if (is_gmp())
@@ -2464,6 +3489,23 @@ BitVector::ibvudiv(const BitVector& bv0, const BitVector& bv1)
       mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (bv1.is_zero())
+    {
+      limbs_set_ui(d_val_limbs, 0);
+      limbs_sub_ui(d_val_limbs, d_val_limbs, 1);
+      limbs_normalize(d_val_limbs, size);
+    }
+    else
+    {
+      limbs_udivrem(d_val_limbs, nullptr, bv0.d_val_limbs, bv1.d_val_limbs);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2508,6 +3550,21 @@ BitVector::ibvurem(const BitVector& bv0, const BitVector& bv1)
       mpz_set(d_val_gmp, bv0.d_val_gmp);
     }
   }
+  else if (bv0.is_limbs())
+  {
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    if (!bv1.is_zero())
+    {
+      limbs_udivrem(nullptr, d_val_limbs, bv0.d_val_limbs, bv1.d_val_limbs);
+    }
+    else if (this != &bv0)
+    {
+      std::copy(bv0.d_val_limbs, bv0.d_val_limbs + N_LIMBS, d_val_limbs);
+    }
+  }
   else
   {
     if (is_gmp())
@@ -2787,63 +3844,62 @@ BitVector::ibvconcat(const BitVector& bv0, const BitVector& bv1)
   assert(!bv0.is_null());
   assert(!bv1.is_null());
   uint64_t size = bv0.d_size + bv1.d_size;
-  const BitVector *b0, *b1;
-  BitVector bb0, bb1;
 
-  /* copy to guard for bv0 == *this */
-  if (&bv0 == this)
-  {
-    bb0 = bv0;
-    b0  = &bb0;
-  }
-  else
+  if (size <= s_native_size)
   {
-    b0 = &bv0;
+    uint64_t val = (bv0.d_val_uint64 << bv1.d_size) + bv1.d_val_uint64;
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    d_val_uint64 = uint64_fdiv_r_2exp(size, val);
   }
-  /* copy to guard for bv1 == *this */
-  if (&bv1 == this)
+  else if (size <= s_max_limbs_size)
   {
-    bb1 = bv1;
-    b1  = &bb1;
+    uint64_t limbs0[N_LIMBS], limbs1[N_LIMBS];
+    bv0.get_limbs(limbs0);
+    bv1.get_limbs(limbs1);
+    limbs_shl(limbs0, limbs0, bv1.d_size);
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      limbs0[i] |= limbs1[i];
+    }
+    set_limbs(size, limbs0);
   }
   else
   {
-    b1 = &bv1;
-  }
+    const BitVector *b0, *b1;
+    BitVector bb0, bb1;
 
-  if (size > s_native_size)
-  {
-    if (!is_gmp())
-    {
-      mpz_init(d_val_gmp);
-    }
-    if (b0->is_gmp())
+    /* copy to guard for bv0 == *this */
+    if (&bv0 == this)
     {
-      mpz_set(d_val_gmp, b0->d_val_gmp);
+      bb0 = bv0;
+      b0  = &bb0;
     }
     else
     {
-      mpz_set_ui(d_val_gmp, b0->d_val_uint64);
+      b0 = &bv0;
     }
-    mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b1->d_size);
-    if (b1->is_gmp())
+    /* copy to guard for bv1 == *this */
+    if (&bv1 == this)
     {
-      mpz_add(d_val_gmp, d_val_gmp, b1->d_val_gmp);
+      bb1 = bv1;
+      b1  = &bb1;
     }
     else
     {
-      mpz_add_ui(d_val_gmp, d_val_gmp, b1->d_val_uint64);
+      b1 = &bv1;
     }
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
-  }
-  else
-  {
-    if (is_gmp())
+
+    if (!is_gmp())
     {
-      mpz_clear(d_val_gmp);
+      mpz_init(d_val_gmp);
     }
-    d_val_uint64 = b0->d_val_uint64 << b1->d_size;
-    d_val_uint64 = uint64_fdiv_r_2exp(size, d_val_uint64 + b1->d_val_uint64);
+    b0->get_mpz(d_val_gmp);
+    mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b1->d_size);
+    b1->add_to_mpz(d_val_gmp);
+    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
   d_size = size;
   return *this;
@@ -2857,60 +3913,45 @@ BitVector::ibvextract(const BitVector& bv, uint64_t idx_hi, uint64_t idx_lo)
   assert(idx_hi < bv.size());
   uint64_t size = idx_hi - idx_lo + 1;
 
-  if (is_gmp())
+  if (bv.is_gmp())
   {
-    if (bv.is_gmp())
+    if (size > s_max_limbs_size)
     {
-      mpz_set(d_val_gmp, bv.d_val_gmp);
+      if (!is_gmp())
+      {
+        mpz_init(d_val_gmp);
+      }
+      mpz_fdiv_r_2exp_ull(d_val_gmp, bv.d_val_gmp, idx_hi + 1);
+      mpz_fdiv_q_2exp_ull(d_val_gmp, d_val_gmp, idx_lo);
+      d_size = size;
     }
     else
     {
-      mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-    }
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, idx_hi + 1);
-    mpz_fdiv_q_2exp_ull(d_val_gmp, d_val_gmp, idx_lo);
-    if (size <= s_native_size)
-    {
-      uint64_t val = mpz_get_ui(d_val_gmp);
-      mpz_clear(d_val_gmp);
-      d_val_uint64 = val;
+      mpz_t tmp;
+      mpz_init(tmp);
+      mpz_fdiv_r_2exp_ull(tmp, bv.d_val_gmp, idx_hi + 1);
+      mpz_fdiv_q_2exp_ull(tmp, tmp, idx_lo);
+      set_mpz(size, tmp);
+      mpz_clear(tmp);
     }
   }
+  else if (bv.is_limbs())
+  {
+    uint64_t limbs[N_LIMBS];
+    limbs_shr(limbs, bv.d_val_limbs, idx_lo);
+    limbs_normalize(limbs, size);
+    set_limbs(size, limbs);
+  }
   else
   {
-    if (size > s_native_size)
-    {
-      mpz_init(d_val_gmp);
-      if (bv.is_gmp())
-      {
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-      }
-      mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, idx_hi + 1);
-      mpz_fdiv_q_2exp_ull(d_val_gmp, d_val_gmp, idx_lo);
-    }
-    else
+    uint64_t val = uint64_fdiv_r_2exp(idx_hi + 1, bv.d_val_uint64) >> idx_lo;
+    if (is_gmp())
     {
-      if (bv.is_gmp())
-      {
-        mpz_t tmp;
-        mpz_init_set(tmp, bv.d_val_gmp);
-        mpz_fdiv_r_2exp_ull(tmp, tmp, idx_hi + 1);
-        mpz_fdiv_q_2exp_ull(tmp, tmp, idx_lo);
-        d_val_uint64 = mpz_get_ui(tmp);
-        mpz_clear(tmp);
-      }
-      else
-      {
-        d_val_uint64 = uint64_fdiv_r_2exp(idx_hi + 1, bv.d_val_uint64);
-        d_val_uint64 >>= idx_lo;
-      }
+      mpz_clear(d_val_gmp);
     }
+    d_val_uint64 = val;
+    d_size       = size;
   }
-  d_size = size;
   return *this;
 }
 
@@ -2923,55 +3964,34 @@ BitVector::ibvzext(const BitVector& bv, uint64_t n)
 
   uint64_t size = bv.d_size + n;
 
-  if (is_gmp())
+  if (size <= s_native_size)
   {
-    if (bv.is_gmp())
-    {
-      mpz_set(d_val_gmp, bv.d_val_gmp);
-    }
-    else
-    {
-      mpz_set_ui(d_val_gmp, bv.d_val_uint64);
-    }
-    if (size <= s_native_size)
+    uint64_t val = bv.d_val_uint64;
+    if (is_gmp())
     {
-      uint64_t val = mpz_get_ui(d_val_gmp);
       mpz_clear(d_val_gmp);
-      d_val_uint64 = val;
     }
+    d_val_uint64 = val;
+    d_size       = size;
+  }
+  else if (size <= s_max_limbs_size)
+  {
+    uint64_t limbs[N_LIMBS];
+    bv.get_limbs(limbs);
+    set_limbs(size, limbs);
+  }
+  else if (bv.is_gmp())
+  {
+    set_mpz(size, bv.d_val_gmp);
   }
   else
   {
-    if (size > s_native_size)
-    {
-      /* copy to guard for bv == *this */
-      const BitVector* b;
-      BitVector bb;
-      if (&bv == this)
-      {
-        bb = bv;
-        b  = &bb;
-      }
-      else
-      {
-        b = &bv;
-      }
-      mpz_init(d_val_gmp);
-      if (b->is_gmp())
-      {
-        mpz_set(d_val_gmp, b->d_val_gmp);
-      }
-      else
-      {
-        mpz_set_ui(d_val_gmp, b->d_val_uint64);
-      }
-    }
-    else
-    {
-      d_val_uint64 = bv.d_val_uint64;
-    }
+    mpz_t tmp;
+    mpz_init(tmp);
+    bv.get_mpz(tmp);
+    set_mpz(size, tmp);
+    mpz_clear(tmp);
   }
-  d_size = size;
   return *this;
 }
 
@@ -2982,68 +4002,57 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
 
   if (n > 0)
   {
-    /* copy to guard for bv == *this */
-    const BitVector* b;
-    BitVector bb;
-    if (&bv == this)
-    {
-      bb = bv;
-      b  = &bb;
-    }
-    else
-    {
-      b = &bv;
-    }
-    if (b->msb())
+    if (bv.msb())
     {
-      uint64_t b_size = b->d_size;
+      uint64_t b_size = bv.d_size;
       uint64_t size   = b_size + n;
-      if (is_gmp())
+      if (size <= s_native_size)
       {
-        mpz_set_ui(d_val_gmp, 1);
-        mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, n);
-        mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
-        mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b_size);
-        if (b->is_gmp())
-        {
-          mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
-        }
-        else
+        uint64_t val = (UINT64_MAX << b_size) + bv.d_val_uint64;
+        if (is_gmp())
         {
-          mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
+          mpz_clear(d_val_gmp);
         }
-        mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
-        if (size <= s_native_size)
+        d_val_uint64 = uint64_fdiv_r_2exp(size, val);
+      }
+      else if (size <= s_max_limbs_size)
+      {
+        uint64_t limbs[N_LIMBS], ones[N_LIMBS];
+        bv.get_limbs(limbs);
+        limbs_set_ui(ones, 0);
+        limbs_sub_ui(ones, ones, 1);
+        limbs_shl(ones, ones, b_size);
+        for (uint64_t i = 0; i < N_LIMBS; ++i)
         {
-          uint64_t val = mpz_get_ui(d_val_gmp);
-          mpz_clear(d_val_gmp);
-          d_val_uint64 = val;
+          limbs[i] |= ones[i];
         }
+        limbs_normalize(limbs, size);
+        set_limbs(size, limbs);
       }
       else
       {
-        if (size > s_native_size)
+        /* copy to guard for bv == *this */
+        const BitVector* b;
+        BitVector bb;
+        if (&bv == this)
         {
-          mpz_init_set_ui(d_val_gmp, 1);
-          mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, n);
-          mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
-          mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b_size);
-          if (b->is_gmp())
-          {
-            mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
-          }
-          else
-          {
-            mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
-          }
-          mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+          bb = bv;
+          b  = &bb;
         }
         else
         {
-          d_val_uint64 = UINT64_MAX << b_size;
-          d_val_uint64 =
-              uint64_fdiv_r_2exp(size, d_val_uint64 + b->d_val_uint64);
+          b = &bv;
+        }
+        if (!is_gmp())
+        {
+          mpz_init(d_val_gmp);
         }
+        mpz_set_ui(d_val_gmp, 1);
+        mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, n);
+        mpz_sub_ui(d_val_gmp, d_val_gmp, 1);
+        mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b_size);
+        b->add_to_mpz(d_val_gmp);
+        mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
       }
       d_size = size;
     }
@@ -3054,31 +4063,7 @@ BitVector::ibvsext(const BitVector& bv, uint64_t n)
   }
   else if (&bv != this)
   {
-    if (is_gmp())
-    {
-      if (bv.is_gmp())
-      {
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        mpz_clear(d_val_gmp);
-        d_val_uint64 = bv.d_val_uint64;
-      }
-    }
-    else
-    {
-      if (bv.is_gmp())
-      {
-        mpz_init(d_val_gmp);
-        mpz_set(d_val_gmp, bv.d_val_gmp);
-      }
-      else
-      {
-        d_val_uint64 = bv.d_val_uint64;
-      }
-    }
-    d_size = bv.d_size;
+    *this = bv;
   }
   return *this;
 }
@@ -3089,62 +4074,66 @@ BitVector::ibvrepeat(const BitVector& bv, uint64_t n)
   assert(!bv.is_null());
   assert(n > 0);
 
-  uint64_t size = n * bv.d_size;
-  const BitVector* b;
-  BitVector bb;
-
-  /* copy to guard for bv0 == *this */
-  if (&bv == this)
-  {
-    bb = bv;
-    b  = &bb;
-  }
-  else
-  {
-    b = &bv;
-  }
+  uint64_t b_size = bv.d_size;
+  uint64_t size   = n * b_size;
 
-  if (size > s_native_size)
+  if (size <= s_native_size)
   {
-    if (!is_gmp())
-    {
-      mpz_init(d_val_gmp);
-    }
-    if (b->is_gmp())
+    uint64_t val = bv.d_val_uint64;
+    uint64_t res = val;
+    for (uint64_t i = 1; i < n; ++i)
     {
-      mpz_set(d_val_gmp, b->d_val_gmp);
+      res <<= b_size;
+      res = uint64_fdiv_r_2exp(size, res + val);
     }
-    else
+    if (is_gmp())
     {
-      mpz_set_ui(d_val_gmp, b->d_val_uint64);
+      mpz_clear(d_val_gmp);
     }
-
+    d_val_uint64 = res;
+  }
+  else if (size <= s_max_limbs_size)
+  {
+    uint64_t limbs[N_LIMBS], res[N_LIMBS];
+    bv.get_limbs(limbs);
+    std::copy(limbs, limbs + N_LIMBS, res);
     for (uint64_t i = 1; i < n; ++i)
     {
-      mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b->d_size);
-      if (b->is_gmp())
-      {
-        mpz_add(d_val_gmp, d_val_gmp, b->d_val_gmp);
-      }
-      else
+      limbs_shl(res, res, b_size);
+      for (uint64_t j = 0; j < N_LIMBS; ++j)
       {
-        mpz_add_ui(d_val_gmp, d_val_gmp, b->d_val_uint64);
+        res[j] |= limbs[j];
       }
     }
-    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
+    set_limbs(size, res);
   }
   else
   {
-    if (is_gmp())
+    const BitVector* b;
+    BitVector bb;
+
+    /* copy to guard for bv0 == *this */
+    if (&bv == this)
     {
-      mpz_clear(d_val_gmp);
+      bb = bv;
+      b  = &bb;
+    }
+    else
+    {
+      b = &bv;
+    }
+
+    if (!is_gmp())
+    {
+      mpz_init(d_val_gmp);
     }
-    d_val_uint64 = b->d_val_uint64;
+    b->get_mpz(d_val_gmp);
     for (uint64_t i = 1; i < n; ++i)
     {
-      d_val_uint64 <<= b->d_size;
-      d_val_uint64 = uint64_fdiv_r_2exp(size, d_val_uint64 + b->d_val_uint64);
+      mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, b_size);
+      b->add_to_mpz(d_val_gmp);
     }
+    mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
   }
   d_size = size;
   return *this;
@@ -3157,56 +4146,68 @@ BitVector::ibvroli(const BitVector& bv, uint64_t n)
 
   uint64_t size = bv.d_size;
   uint64_t rot  = n % size;
-  const BitVector* b;
-  BitVector bb;
 
-  /* copy to guard for bv0 == *this */
-  if (&bv == this)
+  if (size <= s_native_size)
   {
-    bb = bv;
-    b  = &bb;
+    uint64_t val = uint64_fdiv_r_2exp(size, bv.d_val_uint64 << rot);
+    if (rot)
+    {
+      val += uint64_fdiv_r_2exp(size, bv.d_val_uint64 >> (size - rot));
+    }
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    d_val_uint64 = val;
+    d_size       = size;
   }
-  else
+  else if (size <= s_max_limbs_size)
   {
-    b = &bv;
+    uint64_t limbs[N_LIMBS];
+    bv.get_limbs(limbs);
+    if (rot)
+    {
+      uint64_t rotated[N_LIMBS];
+      limbs_shr(rotated, limbs, size - rot);
+      limbs_shl(limbs, limbs, rot);
+      for (uint64_t i = 0; i < N_LIMBS; ++i)
+      {
+        limbs[i] |= rotated[i];
+      }
+      limbs_normalize(limbs, size);
+    }
+    set_limbs(size, limbs);
   }
-
-  if (size > s_native_size)
+  else
   {
-    if (!is_gmp())
+    const BitVector* b;
+    BitVector bb;
+
+    /* copy to guard for bv0 == *this */
+    if (&bv == this)
     {
-      mpz_init(d_val_gmp);
+      bb = bv;
+      b  = &bb;
     }
-    if (b->is_gmp())
+    else
     {
-      mpz_set(d_val_gmp, b->d_val_gmp);
+      b = &bv;
     }
-    else
+
+    if (!is_gmp())
     {
-      mpz_set_ui(d_val_gmp, b->d_val_uint64);
+      mpz_init(d_val_gmp);
     }
+    mpz_set(d_val_gmp, b->d_val_gmp);
+    d_size = size;
     if (rot)
     {
       // shl by number of bits to rotate left
       mpz_mul_2exp_ull(d_val_gmp, d_val_gmp, rot);
       // add bits that were rotated out
-      d_size = size;
       ibvadd(b->bvshr(size - rot));
     }
   }
-  else
-  {
-    if (is_gmp())
-    {
-      mpz_clear(d_val_gmp);
-    }
-    d_val_uint64 = uint64_fdiv_r_2exp(size, b->d_val_uint64 << rot);
-    if (rot)
-    {
-      d_val_uint64 += uint64_fdiv_r_2exp(size, b->d_val_uint64 >> (size - rot));
-    }
-    d_size = size;
-  }
   return *this;
 }
 
@@ -3239,56 +4240,68 @@ BitVector::ibvrori(const BitVector& bv, uint64_t n)
 
   uint64_t size = bv.d_size;
   uint64_t rot  = n % size;
-  const BitVector* b;
-  BitVector bb;
 
-  /* copy to guard for bv0 == *this */
-  if (&bv == this)
+  if (size <= s_native_size)
   {
-    bb = bv;
-    b  = &bb;
+    uint64_t val = uint64_fdiv_r_2exp(size, bv.d_val_uint64 >> rot);
+    if (rot)
+    {
+      val += uint64_fdiv_r_2exp(size, bv.d_val_uint64 << (size - rot));
+    }
+    if (is_gmp())
+    {
+      mpz_clear(d_val_gmp);
+    }
+    d_val_uint64 = val;
+    d_size       = size;
   }
-  else
+  else if (size <= s_max_limbs_size)
   {
-    b = &bv;
+    uint64_t limbs[N_LIMBS];
+    bv.get_limbs(limbs);
+    if (rot)
+    {
+      uint64_t rotated[N_LIMBS];
+      limbs_shl(rotated, limbs, size - rot);
+      limbs_shr(limbs, limbs, rot);
+      for (uint64_t i = 0; i < N_LIMBS; ++i)
+      {
+        limbs[i] |= rotated[i];
+      }
+      limbs_normalize(limbs, size);
+    }
+    set_limbs(size, limbs);
   }
-
-  if (size > s_native_size)
+  else
   {
-    if (!is_gmp())
+    const BitVector* b;
+    BitVector bb;
+
+    /* copy to guard for bv0 == *this */
+    if (&bv == this)
     {
-      mpz_init(d_val_gmp);
+      bb = bv;
+      b  = &bb;
     }
-    if (b->is_gmp())
+    else
     {
-      mpz_set(d_val_gmp, b->d_val_gmp);
+      b = &bv;
     }
-    else
+
+    if (!is_gmp())
     {
-      mpz_set_ui(d_val_gmp, b->d_val_uint64);
+      mpz_init(d_val_gmp);
     }
+    mpz_set(d_val_gmp, b->d_val_gmp);
+    d_size = size;
     if (rot)
     {
       // shr by number of bits to rotate left
       mpz_fdiv_q_2exp_ull(d_val_gmp, d_val_gmp, rot);
       // add bits that were rotated out
-      d_size = size;
       ibvadd(b->bvshl(size - rot));
     }
   }
-  else
-  {
-    if (is_gmp())
-    {
-      mpz_clear(d_val_gmp);
-    }
-    d_val_uint64 = uint64_fdiv_r_2exp(size, b->d_val_uint64 >> rot);
-    if (rot)
-    {
-      d_val_uint64 += uint64_fdiv_r_2exp(size, b->d_val_uint64 << (size - rot));
-    }
-    d_size = size;
-  }
   return *this;
 }
 
@@ -3323,47 +4336,7 @@ BitVector::ibvite(const BitVector& c, const BitVector& t, const BitVector& e)
   assert(c.d_size == 1);
   assert(e.d_size == t.d_size);
 
-  uint64_t size = t.d_size;
-
-  if (c.is_true())
-  {
-    if (t.is_gmp())
-    {
-      if (!is_gmp())
-      {
-        mpz_init(d_val_gmp);
-      }
-      mpz_set(d_val_gmp, t.d_val_gmp);
-    }
-    else
-    {
-      if (is_gmp())
-      {
-        mpz_clear(d_val_gmp);
-      }
-      d_val_uint64 = t.d_val_uint64;
-    }
-  }
-  else
-  {
-    if (e.is_gmp())
-    {
-      if (!is_gmp())
-      {
-        mpz_init(d_val_gmp);
-      }
-      mpz_set(d_val_gmp, e.d_val_gmp);
-    }
-    else
-    {
-      if (is_gmp())
-      {
-        mpz_clear(d_val_gmp);
-      }
-      d_val_uint64 = e.d_val_uint64;
-    }
-  }
-  d_size = size;
+  *this = c.is_true() ? t : e;
   return *this;
 }
 
@@ -3407,7 +4380,7 @@ BitVector::ibvmodinv(const BitVector& bv)
       {
         mpz_clear(d_val_gmp);
       }
-      d_val_uint64 = 1;
+      limbs_set_ui(d_val_limbs, 1);
     }
   }
   else
@@ -3425,6 +4398,27 @@ BitVector::ibvmodinv(const BitVector& bv)
       mpz_fdiv_r_2exp_ull(d_val_gmp, d_val_gmp, size);
       mpz_clear(two);
     }
+    else if (pb->is_limbs())
+    {
+      if (is_gmp())
+      {
+        mpz_clear(d_val_gmp);
+      }
+      /* Newton iteration x = x * (2 - a * x), starting from x = a, which is
+       * correct modulo 2^3 for odd a, doubles the number of correct bits in
+       * each iteration. */
+      uint64_t x[N_LIMBS], t[N_LIMBS], two[N_LIMBS];
+      std::copy(pb->d_val_limbs, pb->d_val_limbs + N_LIMBS, x);
+      limbs_set_ui(two, 2);
+      for (uint64_t nbits = 3; nbits < size; nbits *= 2)
+      {
+        limbs_mul(t, pb->d_val_limbs, x, size);
+        limbs_sub(t, two, t);
+        limbs_mul(x, x, t, size);
+      }
+      limbs_normalize(x, size);
+      std::copy(x, x + N_LIMBS, d_val_limbs);
+    }
     else
     {
       if (is_gmp())
@@ -3438,18 +4432,11 @@ BitVector::ibvmodinv(const BitVector& bv)
        * -> ly * b = bv^-1 * bv = 1
        * -> ly is modular inverse of bv */
       uint64_t esize = size + 1;
-      BitVector a(esize), b(esize);
+      BitVector a(esize);
 
       a.set_bit(size, 1); /* 2^d_size */
       /* b is this bit-vector extended to esize */
-      if (esize > s_native_size)
-      {
-        mpz_set_ui(b.d_val_gmp, pb->d_val_uint64);
-      }
-      else
-      {
-        b.d_val_uint64 = pb->d_val_uint64;
-      }
+      BitVector b = pb->bvzext(1);
 
       BitVector y = mk_one(esize), ty, yq;
       BitVector ly(esize);
@@ -3468,29 +4455,7 @@ BitVector::ibvmodinv(const BitVector& bv)
     }
   }
   d_size = size;
-#ifndef NDEBUG
-  mpz_t ty;
-  mpz_init(ty);
-  if (is_gmp())
-  {
-    mpz_mul(ty, pb->d_val_gmp, d_val_gmp);
-  }
-  else
-  {
-    if (pb->is_gmp())
-    {
-      mpz_mul_ui(ty, pb->d_val_gmp, d_val_uint64);
-    }
-    else
-    {
-      mpz_set_ui(ty, pb->d_val_uint64);
-      mpz_mul_ui(ty, ty, d_val_uint64);
-    }
-  }
-  mpz_fdiv_r_2exp_ull(ty, ty, size);
-  assert(!mpz_cmp_ui(ty, 1));
-  mpz_clear(ty);
-#endif
+  assert(pb->bvmul(*this).is_one());
   return *this;
 }
 
@@ -3939,6 +4904,14 @@ BitVector::bvudivurem(const BitVector& bv,
       mpz_fdiv_r_2exp_ull(quot->d_val_gmp, quot->d_val_gmp, d_size);
       mpz_fdiv_r_2exp_ull(rem->d_val_gmp, rem->d_val_gmp, d_size);
     }
+    else if (is_limbs())
+    {
+      uint64_t q[N_LIMBS], r[N_LIMBS];
+      limbs_udivrem(q, r, d_val_limbs, bv.d_val_limbs);
+      uint64_t size = d_size;
+      quot->set_limbs(size, q);
+      rem->set_limbs(size, r);
+    }
     else
     {
       /* copy to guard for quot == *this and rem == *this */
@@ -3970,6 +4943,27 @@ BitVector::count_leading(bool zeros) const
   uint64_t res = 0;
   mp_limb_t limb;
 
+#ifdef BZLA_BV_WORD_KERNELS
+  if (is_gmp() && !zeros)
+  {
+    return mpz_count_leading_ones(d_val_gmp, d_size);
+  }
+#endif
+  if (is_limbs())
+  {
+    if (zeros)
+    {
+      return d_size - limbs_bitlen(d_val_limbs);
+    }
+    uint64_t limbs[N_LIMBS];
+    for (uint64_t i = 0; i < N_LIMBS; ++i)
+    {
+      limbs[i] = ~d_val_limbs[i];
+    }
+    limbs_normalize(limbs, d_size);
+    return d_size - limbs_bitlen(limbs);
+  }
+
   uint64_t n_bits_per_limb = static_cast<uint64_t>(mp_bits_per_limb);
   /* The number of bits that spill over into the most significant limb,
    * assuming that all bits are represented). Zero if the bit-width is a
@@ -4092,6 +5086,15 @@ BitVector::shift_is_uint64(uint64_t* res) const
     *res = to_uint64();
     return true;
   }
+  if (is_limbs())
+  {
+    for (uint64_t i = 1; i < N_LIMBS; ++i)
+    {
+      if (d_val_limbs[i]) return false;
+    }
+    *res = d_val_limbs[0];
+    return true;
+  }
 
   uint64_t clz = count_leading_zeros();
   if (clz < d_size - 64) return false;
@@ -4102,6 +5105,99 @@ BitVector::shift_is_uint64(uint64_t* res) const
   return true;
 }
 
+void
+BitVector::get_limbs(uint64_t* limbs) const
+{
+  assert(!is_gmp());
+  if (is_limbs())
+  {
+    std::copy(d_val_limbs, d_val_limbs + N_LIMBS, limbs);
+  }
+  else
+  {
+    limbs_set_ui(limbs, d_val_uint64);
+  }
+}
+
+void
+BitVector::set_limbs(uint64_t size, const uint64_t* limbs)
+{
+  assert(size <= s_max_limbs_size);
+  if (is_gmp())
+  {
+    mpz_clear(d_val_gmp);
+  }
+  d_size = size;
+  if (is_limbs())
+  {
+    std::copy(limbs, limbs + N_LIMBS, d_val_limbs);
+  }
+  else
+  {
+    d_val_uint64 = limbs[0];
+  }
+}
+
+void
+BitVector::get_mpz(mpz_t rop) const
+{
+  if (is_gmp())
+  {
+    mpz_set(rop, d_val_gmp);
+  }
+  else if (is_limbs())
+  {
+    mpz_import(rop, N_LIMBS, -1, sizeof(uint64_t), 0, 0, d_val_limbs);
+  }
+  else
+  {
+    mpz_set_ull(rop, d_val_uint64);
+  }
+}
+
+void
+BitVector::set_mpz(uint64_t size, const mpz_t op)
+{
+  assert(mpz_sgn(op) >= 0);
+  assert(mpz_sizeinbase(op, 2) <= size || mpz_sgn(op) == 0);
+  if (size > s_max_limbs_size)
+  {
+    if (!is_gmp())
+    {
+      mpz_init(d_val_gmp);
+    }
+    mpz_set(d_val_gmp, op);
+    d_size = size;
+  }
+  else
+  {
+    uint64_t limbs[N_LIMBS] = {0};
+    mpz_export(limbs, nullptr, -1, sizeof(uint64_t), 0, 0, op);
+    set_limbs(size, limbs);
+  }
+}
+
+void
+BitVector::add_to_mpz(mpz_t rop) const
+{
+  if (is_gmp())
+  {
+    mpz_add(rop, rop, d_val_gmp);
+  }
+  else if (is_limbs())
+  {
+    mpz_t tmp;
+    mpz_init(tmp);
+    get_mpz(tmp);
+    mpz_add(rop, rop, tmp);
+    mpz_clear(tmp);
+  }
+  else
+  {
+    mpz_add_ui(rop, rop, d_val_uint64);
+  }
+}
+
 std::ostream&
 operator<<(std::ostream& out, const BitVector& bv)
 {
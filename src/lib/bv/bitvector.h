@@ -43,6 +43,15 @@ class BitVector
   // 64-bit in d_val_uint64.
   static constexpr size_t s_native_size = sizeof(unsigned long) * 8;
   static_assert(s_native_size == sizeof(mp_bitcnt_t) * 8, "");
+  // Values that require more than s_native_size bits but at most
+  // s_max_limbs_size bits are stored inline as an array of 64-bit limbs and
+  // operated on via hand-written multi-limb kernels. This avoids allocations
+  // and calls into GMP for the very common case of 128- and 256-bit values.
+  // Only values exceeding s_max_limbs_size bits are stored as GMP integer.
+  static constexpr uint64_t s_max_limbs_size = 256;
+  /** The number of 64-bit limbs of the inline multi-limb representation. */
+  static constexpr uint64_t s_max_limbs = s_max_limbs_size / 64;
+  static_assert(s_native_size <= s_max_limbs_size, "");
 
   /**
    * Determine if given string representation of a value in the given numeric
@@ -2201,14 +2210,54 @@ class BitVector
   uint64_t get_limb(void* limb, uint64_t nbits_rem, bool zeros) const;
 
   /**
-   * Determine whether value is stored as GMP value or uint64_t. This check
-   * depends on s_native_size, i.e., for 64-bit Windows values exceeding 32
-   * bit are stored as GMP value, for 64-bit Linux and macOS values exceeding
-   * 64 bit are stored as GMP value.
+   * Get the value of this bit-vector as inline limbs.
+   * @note This bit-vector must not be stored as GMP value.
+   * @param limbs The resulting s_max_limbs limbs, zero-padded.
+   */
+  void get_limbs(uint64_t* limbs) const;
+  /**
+   * Set this bit-vector to given size and inline limbs value.
+   * @param size  The size of the bit-vector, must be <= s_max_limbs_size.
+   * @param limbs The s_max_limbs limbs, all bits >= `size` must be zero.
+   */
+  void set_limbs(uint64_t size, const uint64_t* limbs);
+  /**
+   * Get the value of this bit-vector as GMP value.
+   * @param rop The (initialized) GMP value to store the value in.
+   */
+  void get_mpz(mpz_t rop) const;
+  /**
+   * Set this bit-vector to given size and GMP value.
+   * @param size The size of the bit-vector.
+   * @param op   The value, must be representable with `size` bits.
+   */
+  void set_mpz(uint64_t size, const mpz_t op);
+  /**
+   * Add the value of this bit-vector to given GMP value.
+   * @param rop The GMP value to add the value of this bit-vector to.
+   */
+  void add_to_mpz(mpz_t rop) const;
+
+  /**
+   * Determine whether value is stored as GMP value. This check depends on
+   * s_max_limbs_size, values exceeding s_max_limbs_size bits are stored as
+   * GMP value.
    *
    * @return True if bit-vector wraps a GMPMpz.
    */
-  bool is_gmp() const { return d_size > s_native_size; }
+  bool is_gmp() const { return d_size > s_max_limbs_size; }
+  /**
+   * Determine whether value is stored as inline limbs. This check depends on
+   * s_native_size, i.e., for 64-bit Windows values exceeding 32 bit are
+   * stored as inline limbs, for 64-bit Linux and macOS values exceeding 64
+   * bit are stored as inline limbs (up to s_max_limbs_size bits).
+   *
+   * @return True if bit-vector value is stored in d_val_limbs.
+   */
+  bool is_limbs() const
+  {
+    return d_size > s_native_size && d_size <= s_max_limbs_size;
+  }
 
   /** The size of this bit-vector. */
   uint64_t d_size = 0;
@@ -2224,6 +2273,11 @@ class BitVector
   union
   {
     uint64_t d_val_uint64;
+    /**
+     * Least significant limb first. All bits >= d_size (including all limbs
+     * not required to represent d_size bits) are zero.
+     */
+    uint64_t d_val_limbs[s_max_limbs];
     mpz_t d_val_gmp;
   };
 };
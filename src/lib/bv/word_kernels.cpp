@@ -0,0 +1,599 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bv/word_kernels.h"
+
+#include <cassert>
+
+#if (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define BZLA_WORD_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace bzla {
+
+namespace {
+
+/* --- Portable kernels ----------------------------------------------------- */
+
+/*
+ * The portable kernels are written such that they can be auto-vectorized by
+ * the compiler for the baseline instruction set of the target.
+ */
+
+#define BZLA_WORD_KERNEL_BINARY(isa, attr, name, expr)                   \
+  attr void name##_##isa(                                                 \
+      uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n)       \
+  {                                                                       \
+    for (size_t i = 0; i < n; ++i)                                        \
+    {                                                                     \
+      uint64_t x = a[i], y = b[i];                                        \
+      r[i]       = expr;                                                  \
+    }                                                                     \
+  }
+
+BZLA_WORD_KERNEL_BINARY(portable, , bvand, x & y)
+BZLA_WORD_KERNEL_BINARY(portable, , bvor, x | y)
+BZLA_WORD_KERNEL_BINARY(portable, , bvxor, x ^ y)
+BZLA_WORD_KERNEL_BINARY(portable, , bvnand, ~(x & y))
+BZLA_WORD_KERNEL_BINARY(portable, , bvnor, ~(x | y))
+BZLA_WORD_KERNEL_BINARY(portable, , bvxnor, ~(x ^ y))
+
+void
+bvnot_portable(uint64_t* r, const uint64_t* a, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    r[i] = ~a[i];
+  }
+}
+
+/** Compute words [0, end) of a << shift in descending order. */
+inline void
+shl_words_portable(
+    uint64_t* r, const uint64_t* a, size_t end, size_t k, uint64_t s)
+{
+  for (size_t i = end; i-- > 0;)
+  {
+    uint64_t res = 0;
+    if (i >= k)
+    {
+      res = a[i - k] << s;
+      if (s && i > k)
+      {
+        res |= a[i - k - 1] >> (64 - s);
+      }
+    }
+    r[i] = res;
+  }
+}
+
+/** Compute words [begin, n) of a >> shift in ascending order. */
+inline void
+shr_words_portable(uint64_t* r,
+                   const uint64_t* a,
+                   size_t begin,
+                   size_t n,
+                   size_t k,
+                   uint64_t s)
+{
+  for (size_t i = begin; i < n; ++i)
+  {
+    uint64_t res = 0;
+    if (i + k < n)
+    {
+      res = a[i + k] >> s;
+      if (s && i + k + 1 < n)
+      {
+        res |= a[i + k + 1] << (64 - s);
+      }
+    }
+    r[i] = res;
+  }
+}
+
+void
+shl_portable(uint64_t* r, const uint64_t* a, size_t n, uint64_t shift)
+{
+  assert(shift < 64 * n);
+  shl_words_portable(r, a, n, shift / 64, shift % 64);
+}
+
+void
+shr_portable(uint64_t* r, const uint64_t* a, size_t n, uint64_t shift)
+{
+  assert(shift < 64 * n);
+  shr_words_portable(r, a, 0, n, shift / 64, shift % 64);
+}
+
+inline uint64_t
+popcount64(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint64_t>(__builtin_popcountll(x));
+#else
+  x = x - ((x >> 1) & 0x5555555555555555);
+  x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+  x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0f;
+  return (x * 0x0101010101010101) >> 56;
+#endif
+}
+
+uint64_t
+popcount_portable(const uint64_t* a, size_t n)
+{
+  uint64_t res = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    res += popcount64(a[i]);
+  }
+  return res;
+}
+
+size_t
+find_first_not_portable(const uint64_t* a, size_t n, uint64_t word)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (a[i] != word) return i;
+  }
+  return n;
+}
+
+size_t
+find_last_not_portable(const uint64_t* a, size_t n, uint64_t word)
+{
+  for (size_t i = n; i-- > 0;)
+  {
+    if (a[i] != word) return i;
+  }
+  return n;
+}
+
+const WordKernels s_kernels_portable = {
+    "portable",
+    bvand_portable,
+    bvor_portable,
+    bvxor_portable,
+    bvnand_portable,
+    bvnor_portable,
+    bvxnor_portable,
+    bvnot_portable,
+    shl_portable,
+    shr_portable,
+    popcount_portable,
+    find_first_not_portable,
+    find_last_not_portable,
+};
+
+#ifdef BZLA_WORD_KERNELS_X86
+
+/* --- SSE2 kernels --------------------------------------------------------- */
+
+#define BZLA_SSE2 __attribute__((target("sse2")))
+
+#define BZLA_WORD_KERNEL_BINARY_SSE2(name, expr)                           \
+  BZLA_SSE2 void name##_sse2(                                             \
+      uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n)       \
+  {                                                                       \
+    const __m128i ones = _mm_set1_epi32(-1);                              \
+    (void) ones;                                                          \
+    size_t i = 0;                                                         \
+    for (; i + 2 <= n; i += 2)                                            \
+    {                                                                     \
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)); \
+      __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)); \
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), expr);          \
+    }                                                                     \
+    for (; i < n; ++i)                                                    \
+    {                                                                     \
+      r[i] = name##_scalar(a[i], b[i]);                                   \
+    }                                                                     \
+  }
+
+inline uint64_t
+bvand_scalar(uint64_t x, uint64_t y)
+{
+  return x & y;
+}
+inline uint64_t
+bvor_scalar(uint64_t x, uint64_t y)
+{
+  return x | y;
+}
+inline uint64_t
+bvxor_scalar(uint64_t x, uint64_t y)
+{
+  return x ^ y;
+}
+inline uint64_t
+bvnand_scalar(uint64_t x, uint64_t y)
+{
+  return ~(x & y);
+}
+inline uint64_t
+bvnor_scalar(uint64_t x, uint64_t y)
+{
+  return ~(x | y);
+}
+inline uint64_t
+bvxnor_scalar(uint64_t x, uint64_t y)
+{
+  return ~(x ^ y);
+}
+
+BZLA_WORD_KERNEL_BINARY_SSE2(bvand, _mm_and_si128(x, y))
+BZLA_WORD_KERNEL_BINARY_SSE2(bvor, _mm_or_si128(x, y))
+BZLA_WORD_KERNEL_BINARY_SSE2(bvxor, _mm_xor_si128(x, y))
+BZLA_WORD_KERNEL_BINARY_SSE2(bvnand, _mm_xor_si128(_mm_and_si128(x, y), ones))
+BZLA_WORD_KERNEL_BINARY_SSE2(bvnor, _mm_xor_si128(_mm_or_si128(x, y), ones))
+BZLA_WORD_KERNEL_BINARY_SSE2(bvxnor, _mm_xor_si128(_mm_xor_si128(x, y), ones))
+
+BZLA_SSE2 void
+bvnot_sse2(uint64_t* r, const uint64_t* a, size_t n)
+{
+  const __m128i ones = _mm_set1_epi32(-1);
+  size_t i           = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(r + i), _mm_xor_si128(x, ones));
+  }
+  for (; i < n; ++i)
+  {
+    r[i] = ~a[i];
+  }
+}
+
+BZLA_SSE2 void
+shl_sse2(uint64_t* r, const uint64_t* a, size_t n, uint64_t shift)
+{
+  assert(shift < 64 * n);
+  size_t k         = shift / 64;
+  uint64_t s       = shift % 64;
+  const __m128i cl = _mm_cvtsi32_si128(static_cast<int32_t>(s));
+  // A shift by 64 yields zero, no special handling for s == 0 required.
+  const __m128i cr = _mm_cvtsi32_si128(static_cast<int32_t>(64 - s));
+  // Descending order to allow r == a.
+  size_t i = n;
+  while (i >= k + 3)
+  {
+    i -= 2;
+    __m128i lo =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i - k - 1));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i - k));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(r + i),
+        _mm_or_si128(_mm_sll_epi64(hi, cl), _mm_srl_epi64(lo, cr)));
+  }
+  shl_words_portable(r, a, i, k, s);
+}
+
+BZLA_SSE2 void
+shr_sse2(uint64_t* r, const uint64_t* a, size_t n, uint64_t shift)
+{
+  assert(shift < 64 * n);
+  size_t k         = shift / 64;
+  uint64_t s       = shift % 64;
+  const __m128i cr = _mm_cvtsi32_si128(static_cast<int32_t>(s));
+  const __m128i cl = _mm_cvtsi32_si128(static_cast<int32_t>(64 - s));
+  // Ascending order to allow r == a.
+  size_t i = 0;
+  for (; i + k + 3 <= n; i += 2)
+  {
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + k));
+    __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + k + 1));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(r + i),
+        _mm_or_si128(_mm_srl_epi64(lo, cr), _mm_sll_epi64(hi, cl)));
+  }
+  shr_words_portable(r, a, i, n, k, s);
+}
+
+BZLA_SSE2 size_t
+find_first_not_sse2(const uint64_t* a, size_t n, uint64_t word)
+{
+  const __m128i w = _mm_set1_epi64x(static_cast<int64_t>(word));
+  size_t i        = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(x, w)) != 0xffff)
+    {
+      return a[i] != word ? i : i + 1;
+    }
+  }
+  return i < n && a[i] != word ? i : n;
+}
+
+BZLA_SSE2 size_t
+find_last_not_sse2(const uint64_t* a, size_t n, uint64_t word)
+{
+  const __m128i w = _mm_set1_epi64x(static_cast<int64_t>(word));
+  size_t i        = n;
+  while (i >= 2)
+  {
+    i -= 2;
+    __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(x, w)) != 0xffff)
+    {
+      return a[i + 1] != word ? i + 1 : i;
+    }
+  }
+  return i == 1 && a[0] != word ? 0 : n;
+}
+
+const WordKernels s_kernels_sse2 = {
+    "sse2",
+    bvand_sse2,
+    bvor_sse2,
+    bvxor_sse2,
+    bvnand_sse2,
+    bvnor_sse2,
+    bvxnor_sse2,
+    bvnot_sse2,
+    shl_sse2,
+    shr_sse2,
+    popcount_portable,
+    find_first_not_sse2,
+    find_last_not_sse2,
+};
+
+/* --- AVX2 kernels --------------------------------------------------------- */
+
+#define BZLA_AVX2 __attribute__((target("avx2")))
+
+#define BZLA_WORD_KERNEL_BINARY_AVX2(name, expr)                            \
+  BZLA_AVX2 void name##_avx2(                                              \
+      uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n)        \
+  {                                                                        \
+    const __m256i ones = _mm256_set1_epi32(-1);                            \
+    (void) ones;                                                           \
+    size_t i = 0;                                                          \
+    for (; i + 4 <= n; i += 4)                                             \
+    {                                                                      \
+      __m256i x =                                                          \
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));     \
+      __m256i y =                                                          \
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));     \
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i), expr);        \
+    }                                                                      \
+    for (; i < n; ++i)                                                     \
+    {                                                                      \
+      r[i] = name##_scalar(a[i], b[i]);                                    \
+    }                                                                      \
+  }
+
+BZLA_WORD_KERNEL_BINARY_AVX2(bvand, _mm256_and_si256(x, y))
+BZLA_WORD_KERNEL_BINARY_AVX2(bvor, _mm256_or_si256(x, y))
+BZLA_WORD_KERNEL_BINARY_AVX2(bvxor, _mm256_xor_si256(x, y))
+BZLA_WORD_KERNEL_BINARY_AVX2(bvnand,
+                             _mm256_xor_si256(_mm256_and_si256(x, y), ones))
+BZLA_WORD_KERNEL_BINARY_AVX2(bvnor,
+                             _mm256_xor_si256(_mm256_or_si256(x, y), ones))
+BZLA_WORD_KERNEL_BINARY_AVX2(bvxnor,
+                             _mm256_xor_si256(_mm256_xor_si256(x, y), ones))
+
+BZLA_AVX2 void
+bvnot_avx2(uint64_t* r, const uint64_t* a, size_t n)
+{
+  const __m256i ones = _mm256_set1_epi32(-1);
+  size_t i           = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(r + i),
+                        _mm256_xor_si256(x, ones));
+  }
+  for (; i < n; ++i)
+  {
+    r[i] = ~a[i];
+  }
+}
+
+BZLA_AVX2 void
+shl_avx2(uint64_t* r, const uint64_t* a, size_t n, uint64_t shift)
+{
+  assert(shift < 64 * n);
+  size_t k         = shift / 64;
+  uint64_t s       = shift % 64;
+  const __m128i cl = _mm_cvtsi32_si128(static_cast<int32_t>(s));
+  // A shift by 64 yields zero, no special handling for s == 0 required.
+  const __m128i cr = _mm_cvtsi32_si128(static_cast<int32_t>(64 - s));
+  // Descending order to allow r == a.
+  size_t i = n;
+  while (i >= k + 5)
+  {
+    i -= 4;
+    __m256i lo =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - k - 1));
+    __m256i hi =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i - k));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(r + i),
+        _mm256_or_si256(_mm256_sll_epi64(hi, cl), _mm256_srl_epi64(lo, cr)));
+  }
+  shl_words_portable(r, a, i, k, s);
+}
+
+BZLA_AVX2 void
+shr_avx2(uint64_t* r, const uint64_t* a, size_t n, uint64_t shift)
+{
+  assert(shift < 64 * n);
+  size_t k         = shift / 64;
+  uint64_t s       = shift % 64;
+  const __m128i cr = _mm_cvtsi32_si128(static_cast<int32_t>(s));
+  const __m128i cl = _mm_cvtsi32_si128(static_cast<int32_t>(64 - s));
+  // Ascending order to allow r == a.
+  size_t i = 0;
+  for (; i + k + 5 <= n; i += 4)
+  {
+    __m256i lo =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + k));
+    __m256i hi =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i + k + 1));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(r + i),
+        _mm256_or_si256(_mm256_srl_epi64(lo, cr), _mm256_sll_epi64(hi, cl)));
+  }
+  shr_words_portable(r, a, i, n, k, s);
+}
+
+/** Popcount via nibble lookup table (W. Mula, N. Kurz, D. Lemire). */
+BZLA_AVX2 uint64_t
+popcount_avx2(const uint64_t* a, size_t n)
+{
+  const __m256i lut  = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3,
+                                       2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3,
+                                       1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i mask = _mm256_set1_epi8(0x0f);
+  __m256i acc        = _mm256_setzero_si256();
+  size_t i           = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i x  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i lo = _mm256_and_si256(x, mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), mask);
+    __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo),
+                                  _mm256_shuffle_epi8(lut, hi));
+    acc = _mm256_add_epi64(acc, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+  }
+  uint64_t res = static_cast<uint64_t>(_mm256_extract_epi64(acc, 0))
+                 + static_cast<uint64_t>(_mm256_extract_epi64(acc, 1))
+                 + static_cast<uint64_t>(_mm256_extract_epi64(acc, 2))
+                 + static_cast<uint64_t>(_mm256_extract_epi64(acc, 3));
+  for (; i < n; ++i)
+  {
+    res += popcount64(a[i]);
+  }
+  return res;
+}
+
+BZLA_AVX2 size_t
+find_first_not_avx2(const uint64_t* a, size_t n, uint64_t word)
+{
+  const __m256i w = _mm256_set1_epi64x(static_cast<int64_t>(word));
+  size_t i        = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256i x    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    int32_t mask = _mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(x, w)));
+    if (mask != 0xf)
+    {
+      return i + static_cast<size_t>(__builtin_ctz(~mask & 0xf));
+    }
+  }
+  for (; i < n; ++i)
+  {
+    if (a[i] != word) return i;
+  }
+  return n;
+}
+
+BZLA_AVX2 size_t
+find_last_not_avx2(const uint64_t* a, size_t n, uint64_t word)
+{
+  const __m256i w = _mm256_set1_epi64x(static_cast<int64_t>(word));
+  size_t i        = n;
+  while (i >= 4)
+  {
+    i -= 4;
+    __m256i x    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    int32_t mask = _mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpeq_epi64(x, w)));
+    if (mask != 0xf)
+    {
+      return i + 31 - static_cast<size_t>(__builtin_clz(~mask & 0xf));
+    }
+  }
+  while (i-- > 0)
+  {
+    if (a[i] != word) return i;
+  }
+  return n;
+}
+
+const WordKernels s_kernels_avx2 = {
+    "avx2",
+    bvand_avx2,
+    bvor_avx2,
+    bvxor_avx2,
+    bvnand_avx2,
+    bvnor_avx2,
+    bvxnor_avx2,
+    bvnot_avx2,
+    shl_avx2,
+    shr_avx2,
+    popcount_avx2,
+    find_first_not_avx2,
+    find_last_not_avx2,
+};
+
+#endif
+
+const WordKernels&
+select_word_kernels()
+{
+  if (const WordKernels* k = word_kernels_avx2())
+  {
+    return *k;
+  }
+  if (const WordKernels* k = word_kernels_sse2())
+  {
+    return *k;
+  }
+  return s_kernels_portable;
+}
+
+}  // namespace
+
+const WordKernels&
+word_kernels()
+{
+  static const WordKernels& kernels = select_word_kernels();
+  return kernels;
+}
+
+const WordKernels&
+word_kernels_portable()
+{
+  return s_kernels_portable;
+}
+
+const WordKernels*
+word_kernels_avx2()
+{
+#ifdef BZLA_WORD_KERNELS_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return &s_kernels_avx2;
+  }
+#endif
+  return nullptr;
+}
+
+const WordKernels*
+word_kernels_sse2()
+{
+#ifdef BZLA_WORD_KERNELS_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2"))
+  {
+    return &s_kernels_sse2;
+  }
+#endif
+  return nullptr;
+}
+
+}  // namespace bzla
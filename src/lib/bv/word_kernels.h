@@ -0,0 +1,94 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__BV_WORD_KERNELS_H
+#define BZLA__BV_WORD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bzla {
+
+/**
+ * Kernels for bulk operations on arrays of 64-bit words, least significant
+ * word first. Used for operations on wide bit-vectors that are stored as GMP
+ * values.
+ *
+ * The implementation is selected once at runtime, depending on the
+ * instruction set extensions supported by the CPU (AVX2, SSE2, portable).
+ * All kernels allow the result to alias the (first) operand.
+ */
+struct WordKernels
+{
+  using BinaryFun = void (*)(uint64_t* r,
+                             const uint64_t* a,
+                             const uint64_t* b,
+                             size_t n);
+  using ShiftFun = void (*)(uint64_t* r,
+                            const uint64_t* a,
+                            size_t n,
+                            uint64_t shift);
+
+  /** The name of the implementation. */
+  const char* name;
+
+  /** r[i] = a[i] & b[i] */
+  BinaryFun bvand;
+  /** r[i] = a[i] | b[i] */
+  BinaryFun bvor;
+  /** r[i] = a[i] ^ b[i] */
+  BinaryFun bvxor;
+  /** r[i] = ~(a[i] & b[i]) */
+  BinaryFun bvnand;
+  /** r[i] = ~(a[i] | b[i]) */
+  BinaryFun bvnor;
+  /** r[i] = ~(a[i] ^ b[i]) */
+  BinaryFun bvxnor;
+  /** r[i] = ~a[i] */
+  void (*bvnot)(uint64_t* r, const uint64_t* a, size_t n);
+  /** r = a << shift over n words, shift < 64 * n. */
+  ShiftFun shl;
+  /** r = a >> shift over n words, shift < 64 * n. */
+  ShiftFun shr;
+  /** @return The number of set bits in a[0..n). */
+  uint64_t (*popcount)(const uint64_t* a, size_t n);
+  /**
+   * @return The index of the least significant word of a[0..n) that is not
+   *         equal to `word`, n if all words are equal to `word`.
+   */
+  size_t (*find_first_not)(const uint64_t* a, size_t n, uint64_t word);
+  /**
+   * @return The index of the most significant word of a[0..n) that is not
+   *         equal to `word`, n if all words are equal to `word`.
+   */
+  size_t (*find_last_not)(const uint64_t* a, size_t n, uint64_t word);
+};
+
+/** @return The kernels best supported by the CPU. */
+const WordKernels& word_kernels();
+
+/** @return The portable kernels. */
+const WordKernels& word_kernels_portable();
+
+/**
+ * @return The AVX2 kernels, nullptr if not available on this platform or not
+ *         supported by the CPU.
+ */
+const WordKernels* word_kernels_avx2();
+
+/**
+ * @return The SSE2 kernels, nullptr if not available on this platform or not
+ *         supported by the CPU.
+ */
+const WordKernels* word_kernels_sse2();
+
+}  // namespace bzla
+
+#endif
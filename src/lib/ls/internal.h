@@ -26,6 +26,7 @@ struct LocalSearch<VALUE>::StatisticsInternal
   uint64_t& num_roots_unsat;
   uint64_t& num_props;
   uint64_t& num_updates;
+  uint64_t& num_updates_cutoff;
   uint64_t& num_moves;
 
   uint64_t& num_props_inv;
@@ -55,6 +56,8 @@ LocalSearch<VALUE>::StatisticsInternal::StatisticsInternal(
       num_roots_unsat(stats.new_stat<uint64_t>(prefix + "num_roots_unsat")),
       num_props(stats.new_stat<uint64_t>(prefix + "num_props")),
       num_updates(stats.new_stat<uint64_t>(prefix + "num_updates")),
+      num_updates_cutoff(
+          stats.new_stat<uint64_t>(prefix + "num_updates_cutoff")),
       num_moves(stats.new_stat<uint64_t>(prefix + "num_moves")),
       num_props_inv(stats.new_stat<uint64_t>(prefix + "num_props_inv")),
       num_props_cons(stats.new_stat<uint64_t>(prefix + "num_props_cons")),
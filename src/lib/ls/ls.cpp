@@ -479,13 +479,12 @@ LocalSearch<VALUE>::update_unsat_roots(Node<VALUE>* root)
   assert(root->is_root());
 
   uint64_t id = root->id();
-  auto it     = d_roots_unsat.find(id);
-  if (it != d_roots_unsat.end())
+  if (d_roots_unsat.contains(id))
   {
     if (root->assignment().is_true())
     {
       /* remove from unsatisfied roots list */
-      d_roots_unsat.erase(it);
+      d_roots_unsat.erase(id);
     }
   }
   else if (root->assignment().is_false())
@@ -529,6 +528,73 @@ LocalSearch<VALUE>::normalize_ids()
     }
     visit.pop_back();
   } while (!visit.empty());
+
+  build_parents_csr();
+}
+
+template <class VALUE>
+typename LocalSearch<VALUE>::ParentsRange
+LocalSearch<VALUE>::parents(const Node<VALUE>* node)
+{
+  if (d_parents_csr_dirty || d_parents_offsets.size() != d_nodes.size() + 1)
+  {
+    build_parents_csr();
+  }
+  uint64_t id = node->id();
+  assert(id + 1 < d_parents_offsets.size());
+  Node<VALUE>* const* data = d_parents_csr.data();
+  return ParentsRange(data + d_parents_offsets[id],
+                      data + d_parents_offsets[id + 1]);
+}
+
+template <class VALUE>
+void
+LocalSearch<VALUE>::build_parents_csr()
+{
+  size_t n = d_nodes.size();
+  d_parents_offsets.assign(n + 1, 0);
+  for (size_t i = 0; i < n; ++i)
+  {
+    auto it = d_parents.find(i);
+    d_parents_offsets[i + 1] =
+        d_parents_offsets[i] + (it == d_parents.end() ? 0 : it->second.size());
+  }
+  d_parents_csr.resize(d_parents_offsets[n]);
+  for (size_t i = 0; i < n; ++i)
+  {
+    auto it = d_parents.find(i);
+    if (it == d_parents.end()) continue;
+    auto begin = d_parents_csr.begin() + d_parents_offsets[i];
+    auto cur   = begin;
+    for (uint64_t p : it->second)
+    {
+      *cur++ = get_node(p);
+    }
+    // Sort for a deterministic traversal order.
+    std::sort(begin, cur, [](const Node<VALUE>* a, const Node<VALUE>* b) {
+      return a->id() < b->id();
+    });
+  }
+  d_parents_csr_dirty = false;
+}
+
+template <class VALUE>
+void
+LocalSearch<VALUE>::update_levels(Node<VALUE>* node)
+{
+  std::vector<Node<VALUE>*> visit{node};
+  while (!visit.empty())
+  {
+    Node<VALUE>* cur = visit.back();
+    visit.pop_back();
+    if (cur->update_level())
+    {
+      for (uint64_t p : d_parents.at(cur->id()))
+      {
+        visit.push_back(get_node(p));
+      }
+    }
+  }
 }
 
 template <class VALUE>
@@ -556,63 +622,59 @@ LocalSearch<VALUE>::update_cone(Node<VALUE>* node, const VALUE& assignment)
   node->set_assignment(assignment);
   uint64_t nupdates = 1;
 
-  std::vector<Node<VALUE>*> cone;
-  std::vector<Node<VALUE>*> to_visit;
-  std::unordered_set<Node<VALUE>*> visited;
-
-  /* reset cone */
-  const std::unordered_set<uint64_t>& parents = d_parents.at(node->id());
-  for (uint64_t p : parents)
-  {
-    to_visit.push_back(get_node(p));
-  }
-
-  while (!to_visit.empty())
-  {
-    Node<VALUE>* cur = to_visit.back();
-    to_visit.pop_back();
-
-    if (visited.find(cur) != visited.end()) continue;
-    visited.insert(cur);
-    cone.push_back(cur);
-
-    const std::unordered_set<uint64_t>& parents = d_parents.at(cur->id());
-    for (uint64_t p : parents)
-    {
-      to_visit.push_back(get_node(p));
-    }
-  }
-
-  /* update assignments of cone */
   if (node->is_root())
   {
     update_unsat_roots(node);
   }
 
-  std::sort(
-      cone.begin(), cone.end(), [](const Node<VALUE>* a, const Node<VALUE>* b) {
-        return a->normalized_id() < b->normalized_id();
-      });
+  /* update assignments of cone, level by level */
+  if (d_cone_scheduled.size() < d_nodes.size())
+  {
+    d_cone_scheduled.resize(d_nodes.size(), false);
+  }
+  d_cone_max_level = 0;
+  schedule_parents(node);
 
-  for (Node<VALUE>* cur : cone)
+  StatisticsInternal& stats = d_internal->d_stats;
+  VALUE prev;
+  for (uint32_t level = node->level() + 1; level <= d_cone_max_level; ++level)
   {
-    Log(2) << "  node: " << *cur;
-    cur->evaluate();
-    Log(2) << "      -> new assignment: " << cur->assignment();
-    nupdates += 1;
-    if (d_logger.is_log_enabled(2))
+    // Parents have a higher level than their children, nodes are only
+    // scheduled into higher levels while processing this level. Scheduling
+    // may grow d_cone_levels, hence we access this level by index.
+    for (size_t i = 0; i < d_cone_levels[level].size(); ++i)
     {
-      for (const auto& s : cur->log())
+      Node<VALUE>* cur = d_cone_levels[level][i];
+      assert(cur->level() == level);
+      d_cone_scheduled[cur->id()] = false;
+
+      Log(2) << "  node: " << *cur;
+      prev = cur->assignment();
+      cur->evaluate();
+      Log(2) << "      -> new assignment: " << cur->assignment();
+      nupdates += 1;
+      if (d_logger.is_log_enabled(2))
       {
-        Log(2) << s;
+        for (const auto& s : cur->log())
+        {
+          Log(2) << s;
+        }
       }
-    }
-    Log(2);
+      Log(2);
 
-    if (cur->is_root())
-    {
-      update_unsat_roots(cur);
+      if (cur->assignment().compare(prev) == 0)
+      {
+        /* early cutoff, the parents of this node are not affected */
+        stats.num_updates_cutoff += 1;
+        continue;
+      }
+      if (cur->is_root())
+      {
+        update_unsat_roots(cur);
+      }
+      schedule_parents(cur);
     }
+    d_cone_levels[level].clear();
   }
 #ifndef NDEBUG
   for (uint64_t id : d_roots_unsat)
@@ -623,6 +685,26 @@ LocalSearch<VALUE>::update_cone(Node<VALUE>* node, const VALUE& assignment)
   return nupdates;
 }
 
+template <class VALUE>
+void
+LocalSearch<VALUE>::schedule_parents(Node<VALUE>* node)
+{
+  for (Node<VALUE>* parent : parents(node))
+  {
+    uint64_t id = parent->id();
+    if (d_cone_scheduled[id]) continue;
+    d_cone_scheduled[id] = true;
+    uint32_t level       = parent->level();
+    assert(level > node->level());
+    if (level >= d_cone_levels.size())
+    {
+      d_cone_levels.resize(level + 1);
+    }
+    d_cone_levels[level].push_back(parent);
+    d_cone_max_level = std::max(d_cone_max_level, level);
+  }
+}
+
 template <class VALUE>
 Result
 LocalSearch<VALUE>::move()
@@ -646,7 +728,7 @@ LocalSearch<VALUE>::move()
     Log(1) << "    satisfied roots:";
     for (uint64_t id : d_roots)
     {
-      if (d_roots_unsat.find(id) != d_roots_unsat.end()) continue;
+      if (d_roots_unsat.contains(id)) continue;
       Log(1) << "      + " << *get_node(id);
     }
   }
@@ -665,9 +747,8 @@ LocalSearch<VALUE>::move()
       return Result::UNKNOWN;
     }
 
-    Node<VALUE>* root =
-        get_node(d_rng->pick_from_set<std::unordered_set<uint64_t>, uint64_t>(
-            d_roots_unsat));
+    Node<VALUE>* root = get_node(
+        d_roots_unsat[d_rng->pick<size_t>(0, d_roots_unsat.size() - 1)]);
 
     if (root->is_value_false())
     {
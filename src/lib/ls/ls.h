@@ -18,6 +18,8 @@
 #include <unordered_set>
 #include <vector>
 
+#include "ls/sparse_set.h"
+
 namespace bzla {
 
 class RNG;
@@ -110,6 +112,23 @@ class LocalSearch
   using ParentsSet   = std::unordered_set<uint64_t>;
   using ParentsMap   = std::unordered_map<uint64_t, ParentsSet>;
 
+  /** A range of parent nodes in LocalSearch::d_parents_csr. */
+  class ParentsRange
+  {
+   public:
+    ParentsRange(Node<VALUE>* const* begin, Node<VALUE>* const* end)
+        : d_begin(begin), d_end(end)
+    {
+    }
+    Node<VALUE>* const* begin() const { return d_begin; }
+    Node<VALUE>* const* end() const { return d_end; }
+    size_t size() const { return d_end - d_begin; }
+
+   private:
+    Node<VALUE>* const* d_begin;
+    Node<VALUE>* const* d_end;
+  };
+
   struct Statistics
   {
     uint64_t& num_roots;
@@ -369,6 +388,24 @@ class LocalSearch
    * normalized ids in a post-order DAG traversal manner.
    */
   void normalize_ids();
+  /**
+   * Get the parents of given node.
+   *
+   * Rebuilds d_parents_csr from d_parents if nodes were added or parents
+   * changed since it was last built.
+   *
+   * @param node The node.
+   * @return The parents of `node`, in ascending order of their ids.
+   */
+  ParentsRange parents(const Node<VALUE>* node);
+  /** Rebuild d_parents_csr from d_parents. */
+  void build_parents_csr();
+  /**
+   * Recompute the level of given node after its children changed (e.g., due
+   * to normalization), and propagate level changes to its parents.
+   * @param node The node.
+   */
+  void update_levels(Node<VALUE>* node);
   /**
    * Compute min/max bounds for children of given node.
    *
@@ -383,11 +420,20 @@ class LocalSearch
    * Update the assignment of the given node to the given assignment, and
    * recompute the assignment of all nodes in its cone of influence
    *
+   * Nodes are processed level by level (see Node::level()), and the parents
+   * of a node are only scheduled for re-evaluation if its assignment changed.
+   *
    * @param node The node to update.
    * @param assignment The new assignment of the given node.
    * @return The number of updated assignments.
    */
   uint64_t update_cone(Node<VALUE>* node, const VALUE& assignment);
+  /**
+   * Helper for update_cone() to schedule the parents of the given node for
+   * re-evaluation.
+   * @param node The node.
+   */
+  void schedule_parents(Node<VALUE>* node);
   /**
    * Select an input and a new assignment for that input by propagating the
    * given target value `t_root` for the given root along one path towards an
@@ -425,7 +471,7 @@ class LocalSearch
   std::unordered_map<uint64_t, uint64_t> d_roots_cnt;
 
   /** The set of unsatisfied roots. */
-  std::unordered_set<uint64_t> d_roots_unsat;
+  SparseSet d_roots_unsat;
   /** Root responsible for unsat result. */
   uint64_t d_false_root;
 
@@ -439,12 +485,38 @@ class LocalSearch
    */
   std::unordered_map<const Node<VALUE>*, bool> d_roots_ineq;
 
-  /** Map nodes to their parent nodes. */
+  /**
+   * Map nodes to their parent nodes.
+   *
+   * This is maintained while nodes are created and normalized. Traversals
+   * use its flattened representation d_parents_csr (see parents()), hence
+   * d_parents_csr_dirty must be set when modifying this map.
+   */
   ParentsMap d_parents;
+  /**
+   * The parents of all nodes in compressed sparse row format. The parents of
+   * node with id `i` are stored at indices
+   * [d_parents_offsets[i], d_parents_offsets[i + 1]).
+   */
+  std::vector<Node<VALUE>*> d_parents_csr;
+  /** The start indices of the parents of each node in d_parents_csr. */
+  std::vector<size_t> d_parents_offsets;
+  /** True if d_parents was modified since d_parents_csr was built. */
+  bool d_parents_csr_dirty = true;
 
   /** The target value for each root. */
   std::unique_ptr<VALUE> d_true;
 
+  /**
+   * The nodes scheduled for re-evaluation during update_cone(), bucketed by
+   * level (see Node::level()).
+   */
+  std::vector<std::vector<Node<VALUE>*>> d_cone_levels;
+  /** Indicates if a node (indexed by id) is in one of d_cone_levels. */
+  std::vector<bool> d_cone_scheduled;
+  /** The maximum level of the nodes in d_cone_levels. */
+  uint32_t d_cone_max_level = 0;
+
   /** The maximum number of propagations, 0 for unlimited. */
   uint64_t d_max_nprops = 0;
   /** The maximum number of cone updates, 0 for unlimited. */
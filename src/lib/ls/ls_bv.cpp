@@ -135,6 +135,7 @@ LocalSearchBV::_mk_node(NodeKind kind,
     assert(d_parents.find(c) != d_parents.end());
     d_parents.at(c).insert(id);
   }
+  d_parents_csr_dirty = true;
 
   std::unique_ptr<BitVectorNode> res;
 
@@ -397,11 +398,10 @@ LocalSearchBV::compute_bounds(Node<BitVector>* node)
   }
   for (uint32_t i = 0, arity = node->arity(); i < arity; ++i)
   {
-    const BitVectorNode* child                  = n->child(i);
-    const std::unordered_set<uint64_t>& parents = d_parents.at(child->id());
-    for (uint64_t pid : parents)
+    const BitVectorNode* child = n->child(i);
+    for (Node<BitVector>* parent : parents(child))
     {
-      BitVectorNode* p = get_node(pid);
+      BitVectorNode* p = reinterpret_cast<BitVectorNode*>(parent);
 #ifndef NDEBUG
       if (p->is_inequality())
       {
@@ -598,7 +598,9 @@ LocalSearchBV::normalize_extracts(BitVectorNode* node)
       // Remove this extract from the parents list of the normalized child
       assert(!d_parents[ex->child(0)->id()].empty());
       d_parents[ex->child(0)->id()].erase(ex->id());
+      d_parents_csr_dirty = true;
       ex->normalize(normalized);
+      update_levels(ex);
     }
   }
 }
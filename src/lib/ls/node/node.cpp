@@ -10,6 +10,7 @@
 
 #include "ls/node/node.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <sstream>
@@ -47,6 +48,7 @@ Node<VALUE>::Node(RNG* rng,
       d_all_value(child0->is_value()),
       d_symbol(symbol)
 {
+  update_level();
 }
 
 template <class VALUE>
@@ -64,6 +66,7 @@ Node<VALUE>::Node(RNG* rng,
       d_all_value(child0->is_value() && child1->is_value()),
       d_symbol(symbol)
 {
+  update_level();
 }
 
 template <class VALUE>
@@ -83,6 +86,7 @@ Node<VALUE>::Node(RNG* rng,
                   && child2->is_value()),
       d_symbol(symbol)
 {
+  update_level();
 }
 
 template <class VALUE>
@@ -236,6 +240,23 @@ Node<VALUE>::set_normalized_id(uint64_t id)
   d_normalized_id = id;
 }
 
+template <class VALUE>
+bool
+Node<VALUE>::update_level()
+{
+  uint32_t level = 0;
+  for (const Node<VALUE>* child : d_children)
+  {
+    level = std::max(level, child->level() + 1);
+  }
+  if (level == d_level)
+  {
+    return false;
+  }
+  d_level = level;
+  return true;
+}
+
 template <class VALUE>
 std::vector<std::string>
 Node<VALUE>::log() const
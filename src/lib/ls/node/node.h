@@ -32,13 +32,15 @@ class Node
    * Path selection mode.
    * True if path is to be selected based on essential inputs, false if it is
    * to be selected randomly.
+   * @note Thread-local since local search instances may run concurrently
+   *       (e.g., in portfolio mode).
    */
-  static inline bool s_path_sel_essential = true;
+  static inline thread_local bool s_path_sel_essential = true;
   /**
    * Probability for picking an essential input if there is one, and else
    * a random input (see LocalSearch::d_options.use_path_sel_essential).
    */
-  static inline uint32_t s_prob_pick_ess_input = 990;
+  static inline thread_local uint32_t s_prob_pick_ess_input = 990;
 
   /** Destructor. */
   virtual ~Node();
@@ -223,6 +225,17 @@ class Node
    * @return The id of this node.
    */
   uint64_t normalized_id() const { return d_normalized_id; }
+  /**
+   * Get the level of this node.
+   * @return The level of this node, 0 for leaf nodes, else 1 + the maximum
+   *         level of its children.
+   */
+  uint32_t level() const { return d_level; }
+  /**
+   * Recompute the level of this node from the levels of its children.
+   * @return True if the level of this node changed.
+   */
+  bool update_level();
 
   /** Get the string representation of this node. */
   virtual std::string str() const = 0;
@@ -285,6 +298,15 @@ class Node
    * extra handling but setting this to the same value as `d_id` is required.
    */
   uint64_t d_normalized_id = 0;
+  /**
+   * The level of this node in the DAG.
+   *
+   * The level of a node is always greater than the level of its children.
+   * Cone updates process nodes level by level, in ascending order. If
+   * normalization replaces the children of a node, its level must be updated
+   * via LocalSearch::update_levels().
+   */
+  uint32_t d_level = 0;
 
   /** The children of this node. */
   std::vector<Node<VALUE>*> d_children;
@@ -0,0 +1,121 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA__LS_SPARSE_SET_H
+#define BZLA__LS_SPARSE_SET_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bzla::ls {
+
+/**
+ * A set of (dense) ids with constant time insertion, removal, membership
+ * check and access by index (e.g., for random selection).
+ *
+ * The elements are stored contiguously in an array, and a second array
+ * indexed by id maps elements to their position in the element array. On
+ * removal, the last element is moved into the position of the removed element,
+ * hence the order of elements is not preserved.
+ */
+class SparseSet
+{
+ public:
+  using const_iterator = std::vector<uint64_t>::const_iterator;
+
+  /**
+   * Insert element.
+   * @param id The element.
+   * @return True if the element was inserted, false if it was already in the
+   *         set.
+   */
+  bool insert(uint64_t id)
+  {
+    if (contains(id)) return false;
+    if (id >= d_index.size())
+    {
+      d_index.resize(id + 1, NONE);
+    }
+    d_index[id] = d_elements.size();
+    d_elements.push_back(id);
+    return true;
+  }
+
+  /**
+   * Remove element.
+   * @param id The element.
+   * @return True if the element was removed, false if it was not in the set.
+   */
+  bool erase(uint64_t id)
+  {
+    if (!contains(id)) return false;
+    size_t idx      = d_index[id];
+    uint64_t last   = d_elements.back();
+    d_elements[idx] = last;
+    d_index[last]   = idx;
+    d_elements.pop_back();
+    d_index[id] = NONE;
+    return true;
+  }
+
+  /**
+   * Determine if given element is in the set.
+   * @param id The element.
+   * @return True if `id` is in the set.
+   */
+  bool contains(uint64_t id) const
+  {
+    return id < d_index.size() && d_index[id] != NONE;
+  }
+
+  /**
+   * Get the element at given index.
+   * @param idx The index, must be less than size().
+   * @return The element at index `idx`.
+   */
+  uint64_t operator[](size_t idx) const
+  {
+    assert(idx < d_elements.size());
+    return d_elements[idx];
+  }
+
+  /** @return The number of elements in the set. */
+  size_t size() const { return d_elements.size(); }
+  /** @return True if the set is empty. */
+  bool empty() const { return d_elements.empty(); }
+
+  /** Remove all elements. */
+  void clear()
+  {
+    for (uint64_t id : d_elements)
+    {
+      d_index[id] = NONE;
+    }
+    d_elements.clear();
+  }
+
+  const_iterator begin() const { return d_elements.begin(); }
+  const_iterator end() const { return d_elements.end(); }
+
+ private:
+  /** Marks ids that are not in the set in d_index. */
+  static constexpr size_t NONE = static_cast<size_t>(-1);
+
+  /** The elements. */
+  std::vector<uint64_t> d_elements;
+  /** Maps ids to their index in d_elements, NONE if not in the set. */
+  std::vector<size_t> d_index;
+};
+
+}  // namespace bzla::ls
+
+#endif
@@ -48,6 +48,7 @@ main(int32_t argc, char* argv[])
     bitwuzla::parser::Parser parser(
         tm, options, main_options.language, &std::cout);
     parser.configure_auto_print_model(main_options.print_model);
+    parser.configure_bmc_bound(main_options.bmc_bound);
     parser.parse(
         main_options.infile_name,
         main_options.print || main_options.pp_only || main_options.parse_only);
@@ -170,6 +170,11 @@ print_help()
                     format_longm("lang"),
                     format_dflt(dflt_opts.language),
                     "input language {smt2, btor2}");
+  opts.emplace_back("",
+                    format_longn("bmc-bound"),
+                    format_dflt(std::to_string(dflt_opts.bmc_bound)),
+                    "maximum bound for bounded model checking of sequential "
+                    "btor2 input");
 
   // Format library options
   bitwuzla::Options options;
@@ -403,6 +408,10 @@ parse_options(int32_t argc, char* argv[], std::vector<std::string>& args)
     {
       opts.time_limit = parse_arg_uint64_t(argc, i, argv);
     }
+    else if (check_opt_value(arg, "", "--bmc-bound"))
+    {
+      opts.bmc_bound = parse_arg_uint64_t(argc, i, argv);
+    }
     else if (check_opt_value(arg, "", "--lang"))
     {
       auto [opt, val] = parse_arg_val(argc, i, argv);
@@ -27,6 +27,7 @@ struct Options
   bool pp_only            = false;
   uint8_t bv_format       = 2;
   uint64_t time_limit     = 0;
+  uint64_t bmc_bound      = 20;
   std::string infile_name = "<stdin>";
   std::string language    = "smt2";
 };
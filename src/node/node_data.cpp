@@ -20,20 +20,11 @@ namespace bzla::node {
 /* --- NodeData public ----------------------------------------------------- */
 
 NodeData*
-NodeData::alloc(Kind kind, const std::optional<std::string>& symbol)
+NodeData::alloc(NodeDataArena& arena,
+                Kind kind,
+                const std::optional<std::string>& symbol)
 {
-  size_t size         = sizeof(NodeData);
-  size_t payload_size = sizeof(PayloadSymbol);
-
-  // Subtract size of payload placeholder in NodeData from payload size.
-  size_t reserved_size = sizeof(NodeData::d_payload);
-  payload_size         = std::max(payload_size, reserved_size) - reserved_size;
-
-  NodeData* data = static_cast<NodeData*>(std::calloc(1, size + payload_size));
-  if (data == nullptr)
-  {
-    throw std::bad_alloc();
-  }
+  NodeData* data   = alloc_raw(arena, sizeof(PayloadSymbol));
   data->d_kind     = kind;
   auto& payload    = data->payload_symbol();
   payload.d_symbol = symbol;
@@ -41,11 +32,11 @@ NodeData::alloc(Kind kind, const std::optional<std::string>& symbol)
 }
 
 NodeData*
-NodeData::alloc(Kind kind,
-                const std::vector<Node>& children,
-                const std::vector<uint64_t>& indices)
+NodeData::alloc(NodeDataArena& arena,
+                Kind kind,
+                util::Span<Node> children,
+                util::Span<uint64_t> indices)
 {
-  size_t size         = sizeof(NodeData);
   size_t payload_size = 0;
 
   if (!children.empty())
@@ -61,16 +52,8 @@ NodeData::alloc(Kind kind,
     payload_size += sizeof(PayloadIndexed::d_indices[0]) * (indices.size() - 1);
   }
 
-  // Subtract size of payload placeholder in NodeData from payload size.
-  size_t reserved_size = sizeof(NodeData::d_payload);
-  payload_size         = std::max(payload_size, reserved_size) - reserved_size;
-
-  NodeData* data = static_cast<NodeData*>(std::calloc(1, size + payload_size));
-  if (data == nullptr)
-  {
-    throw std::bad_alloc();
-  }
-  data->d_kind = kind;
+  NodeData* data = alloc_raw(arena, payload_size);
+  data->d_kind   = kind;
 
   // Connect children payload
   if (!children.empty())
@@ -111,10 +94,11 @@ NodeData::alloc(Kind kind,
 }
 
 void
-NodeData::dealloc(NodeData* data)
+NodeData::dealloc(NodeDataArena& arena, NodeData* data)
 {
+  uint16_t size_class = data->d_size_class;
   data->~NodeData();
-  std::free(data);
+  arena.deallocate(data, size_class);
 }
 
 NodeData::~NodeData()
@@ -242,4 +226,20 @@ NodeData::gc()
   d_nm->garbage_collect(this);
 }
 
+/* --- NodeData private ---------------------------------------------------- */
+
+NodeData*
+NodeData::alloc_raw(NodeDataArena& arena, size_t payload_size)
+{
+  // Subtract size of payload placeholder in NodeData from payload size.
+  size_t reserved_size = sizeof(NodeData::d_payload);
+  payload_size         = std::max(payload_size, reserved_size) - reserved_size;
+
+  size_t size         = sizeof(NodeData) + payload_size;
+  uint16_t size_class = NodeDataArena::size_class(size);
+  NodeData* data = static_cast<NodeData*>(arena.allocate(size_class, size));
+  data->d_size_class = size_class;
+  return data;
+}
+
 }  // namespace bzla::node
@@ -11,6 +11,7 @@
 #ifndef BZLA_NODE_NODE_DATA_H_INCLUDED
 #define BZLA_NODE_NODE_DATA_H_INCLUDED
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -18,7 +19,9 @@
 
 #include "node/kind_info.h"
 #include "node/node.h"
+#include "node/node_data_arena.h"
 #include "type/type.h"
+#include "util/span.h"
 
 namespace bzla::node {
 
@@ -63,31 +66,22 @@ class NodeData
   using iterator = const Node*;
 
   /** Allocate node data for constants and variables. */
-  static NodeData* alloc(Kind kind, const std::optional<std::string>& symbol);
+  static NodeData* alloc(NodeDataArena& arena,
+                         Kind kind,
+                         const std::optional<std::string>& symbol);
 
   /** Allocate node data for nodes with children. */
-  static NodeData* alloc(Kind kind,
-                         const std::vector<Node>& children,
-                         const std::vector<uint64_t>& indices);
+  static NodeData* alloc(NodeDataArena& arena,
+                         Kind kind,
+                         util::Span<Node> children,
+                         util::Span<uint64_t> indices);
 
   /** Allocate node data for values. */
   template <class T>
-  static NodeData* alloc(const T& value)
+  static NodeData* alloc(NodeDataArena& arena, const T& value)
   {
-    size_t size         = sizeof(NodeData);
-    size_t payload_size = sizeof(PayloadValue<T>);
-
-    // Subtract size of payload placeholder in NodeData from payload size.
-    size_t reserved_size = sizeof(NodeData::d_payload);
-    payload_size = std::max(payload_size, reserved_size) - reserved_size;
-
-    NodeData* data =
-        static_cast<NodeData*>(std::calloc(1, size + payload_size));
-    if (data == nullptr)
-    {
-      throw std::bad_alloc();
-    }
-    data->d_kind = Kind::VALUE;
+    NodeData* data = alloc_raw(arena, sizeof(PayloadValue<T>));
+    data->d_kind   = Kind::VALUE;
 
     auto& payload   = data->payload_value<T>();
     payload.d_value = value;
@@ -95,7 +89,7 @@ class NodeData
   }
 
   /** Deallocate node data. */
-  static void dealloc(NodeData* data);
+  static void dealloc(NodeDataArena& arena, NodeData* data);
 
   NodeData() = delete;
   ~NodeData();
@@ -187,7 +181,18 @@ class NodeData
   std::optional<std::reference_wrapper<const std::string>> get_symbol() const;
 
   /** Increase the reference count by one. */
-  void inc_ref() { ++d_refs; }
+  void inc_ref()
+  {
+    if (d_thread_safe)
+    {
+      d_refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      d_refs.store(d_refs.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+    }
+  }
 
   /**
    * Decrease the reference count by one.
@@ -197,9 +202,7 @@ class NodeData
    */
   void dec_ref()
   {
-    assert(d_refs > 0);
-    --d_refs;
-    if (d_refs == 0)
+    if (release())
     {
       gc();
     }
@@ -222,6 +225,13 @@ class NodeData
   auto& info() { return d_info; }
 
  private:
+  /**
+   * Allocate zero-initialized node data with given payload size.
+   * @param arena        The arena to allocate from.
+   * @param payload_size The size of the payload in bytes.
+   */
+  static NodeData* alloc_raw(NodeDataArena& arena, size_t payload_size);
+
   /** @return Children payload of this node. */
   PayloadChildren& payload_children()
   {
@@ -280,6 +290,42 @@ class NodeData
     return *reinterpret_cast<const PayloadSymbol*>(&d_payload);
   }
 
+  /**
+   * Decrease the reference count by one without garbage collecting this node.
+   * @return True if the reference count became zero.
+   */
+  bool release()
+  {
+    assert(d_refs.load(std::memory_order_relaxed) > 0);
+    if (d_thread_safe)
+    {
+      return d_refs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+    uint32_t refs = d_refs.load(std::memory_order_relaxed) - 1;
+    d_refs.store(refs, std::memory_order_relaxed);
+    return refs == 0;
+  }
+
+  /**
+   * Increase the reference count by one if it is not zero, i.e., if this node
+   * is not being garbage collected by another thread. Only used in
+   * thread-safe mode.
+   * @return True if the reference count was increased.
+   */
+  bool try_inc_ref()
+  {
+    assert(d_thread_safe);
+    uint32_t refs = d_refs.load(std::memory_order_relaxed);
+    while (refs > 0)
+    {
+      if (d_refs.compare_exchange_weak(refs, refs + 1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
   /** Garbage collect this node. */
   void gc();
 
@@ -291,12 +337,19 @@ class NodeData
   uint64_t d_id = 0;
   /** Node type. */
   Type d_type;
-  /** Number of references. */
-  uint32_t d_refs = 0;
+  /**
+   * Number of references, only modified atomically if the node manager is
+   * thread-safe.
+   */
+  std::atomic<uint32_t> d_refs;
   /** Node kind. */
   Kind d_kind;
   /** Node info flags. */
   NodeInfo d_info;
+  /** Size class of allocated memory, see NodeDataArena. */
+  uint16_t d_size_class : 15;
+  /** True if the associated node manager is thread-safe. */
+  uint16_t d_thread_safe : 1;
 
   /**
    * Payload placeholder.
@@ -0,0 +1,103 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_data_arena.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace bzla::node {
+
+/* --- NodeDataArena public ------------------------------------------------ */
+
+NodeDataArena::~NodeDataArena()
+{
+  for (char* slab : d_slabs)
+  {
+    std::free(slab);
+  }
+}
+
+void*
+NodeDataArena::allocate(uint16_t size_class, size_t size)
+{
+  assert(size_class == NodeDataArena::size_class(size));
+
+  if (size_class == 0)
+  {
+    void* res = std::calloc(1, size);
+    if (res == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    return res;
+  }
+
+  size_t bytes = size_class * s_granularity;
+
+  // Reuse previously deallocated memory of the same size class.
+  FreeEntry* entry = d_free_lists[size_class];
+  if (entry != nullptr)
+  {
+    d_free_lists[size_class] = entry->d_next;
+    std::memset(entry, 0, bytes);
+    return entry;
+  }
+
+  if (static_cast<size_t>(d_end - d_cur) < bytes)
+  {
+    // Put remainder of current slab into the free list of its size class.
+    size_t remainder = d_end - d_cur;
+    if (remainder >= s_granularity)
+    {
+      deallocate(d_cur, static_cast<uint16_t>(remainder / s_granularity));
+    }
+    new_slab();
+  }
+  assert(static_cast<size_t>(d_end - d_cur) >= bytes);
+  void* res = d_cur;
+  d_cur += bytes;
+  return res;
+}
+
+void
+NodeDataArena::deallocate(void* ptr, uint16_t size_class)
+{
+  assert(ptr != nullptr);
+  if (size_class == 0)
+  {
+    std::free(ptr);
+    return;
+  }
+  assert(size_class < s_num_size_classes);
+  FreeEntry* entry         = static_cast<FreeEntry*>(ptr);
+  entry->d_next            = d_free_lists[size_class];
+  d_free_lists[size_class] = entry;
+}
+
+/* --- NodeDataArena private ----------------------------------------------- */
+
+void
+NodeDataArena::new_slab()
+{
+  // Slabs are zero-initialized, memory from free lists is cleared on reuse.
+  char* slab = static_cast<char*>(std::calloc(1, s_slab_size));
+  if (slab == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  d_slabs.push_back(slab);
+  d_cur = slab;
+  d_end = slab + s_slab_size;
+}
+
+}  // namespace bzla::node
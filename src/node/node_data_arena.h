@@ -0,0 +1,111 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_DATA_ARENA_H_INCLUDED
+#define BZLA_NODE_NODE_DATA_ARENA_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bzla::node {
+
+/**
+ * Slab allocator for node data objects.
+ *
+ * Node data objects are variable-sized (the payload depends on the number of
+ * children and indices, the value type or the symbol), but the vast majority
+ * of them is small. Allocation sizes are rounded up to a multiple of
+ * s_granularity bytes, which determines their size class. Small objects are
+ * carved out of large zero-initialized slabs in allocation order, which keeps
+ * nodes that are created together (e.g., a term and its children) close to
+ * each other in memory. Deallocated objects are kept in a free list per size
+ * class and reused by subsequent allocations of the same size class.
+ *
+ * Objects larger than s_max_size (nodes with many children) are allocated
+ * via std::calloc.
+ *
+ * Memory of slabs is only released on destruction of the arena.
+ */
+class NodeDataArena
+{
+ public:
+  /** Allocation granularity in bytes. */
+  static constexpr size_t s_granularity = alignof(std::max_align_t);
+  /** Maximum object size in bytes served from slabs. */
+  static constexpr size_t s_max_size = 512;
+  /** Number of size classes, size class 0 indicates std::calloc. */
+  static constexpr size_t s_num_size_classes = s_max_size / s_granularity + 1;
+  /** Size of a slab in bytes. */
+  static constexpr size_t s_slab_size = 64 * 1024;
+
+  NodeDataArena() = default;
+  ~NodeDataArena();
+  NodeDataArena(const NodeDataArena&)            = delete;
+  NodeDataArena& operator=(const NodeDataArena&) = delete;
+
+  /**
+   * Determine size class of given allocation size.
+   * @param size The size of the object in bytes.
+   * @return The size class, 0 if objects of this size are not served from
+   *         slabs.
+   */
+  static uint16_t size_class(size_t size)
+  {
+    if (size > s_max_size)
+    {
+      return 0;
+    }
+    return static_cast<uint16_t>((size + s_granularity - 1) / s_granularity);
+  }
+
+  /**
+   * Allocate zero-initialized memory.
+   * @param size_class The size class as determined by size_class().
+   * @param size       The size of the object in bytes.
+   * @return The allocated memory.
+   * @throw std::bad_alloc if memory could not be allocated.
+   */
+  void* allocate(uint16_t size_class, size_t size);
+
+  /**
+   * Deallocate memory previously allocated via allocate().
+   * @param ptr        The memory to deallocate.
+   * @param size_class The size class the memory was allocated with.
+   */
+  void deallocate(void* ptr, uint16_t size_class);
+
+  /** @return The number of allocated slabs. */
+  size_t num_slabs() const { return d_slabs.size(); }
+
+ private:
+  /** Free list entry, overlays deallocated memory. */
+  struct FreeEntry
+  {
+    FreeEntry* d_next;
+  };
+
+  /** Allocate a new slab and make it the current slab. */
+  void new_slab();
+
+  /** Allocated slabs. */
+  std::vector<char*> d_slabs;
+  /** Next free byte in the current slab. */
+  char* d_cur = nullptr;
+  /** End of the current slab. */
+  char* d_end = nullptr;
+  /** Free lists, indexed by size class. */
+  std::array<FreeEntry*, s_num_size_classes> d_free_lists{};
+};
+
+}  // namespace bzla::node
+
+#endif
@@ -0,0 +1,292 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_ID_TABLE_H_INCLUDED
+#define BZLA_NODE_NODE_ID_TABLE_H_INCLUDED
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bzla::node {
+
+/**
+ * Dense table of entries indexed by node id.
+ *
+ * Node ids are assigned consecutively by the node manager and never reused,
+ * hence the table stores entries in pages of PAGE_SIZE slots, indexed by the
+ * upper bits of the id. Pages are allocated on first insertion of an id in
+ * their range and never moved, i.e., references to entries stay valid until
+ * the entry is erased. Pages are freed when their last entry is erased, and
+ * all pages are freed on clear(). Memory usage is proportional to the number
+ * of pages with entries rather than to the number of entries, hence tables
+ * are intended for caches over large parts of the node graph.
+ *
+ * All ids must be ids of nodes of the same node manager.
+ *
+ * This is the storage of NodeMap and NodeSet.
+ */
+template <class Entry>
+class NodeIdTable
+{
+  /** A slot, holds an entry if the id is in the table. */
+  using Slot = std::optional<Entry>;
+
+ public:
+  /** Number of bits of a node id that index into a page. */
+  static constexpr uint64_t PAGE_BITS = 10;
+  /** Number of slots per page. */
+  static constexpr uint64_t PAGE_SIZE = UINT64_C(1) << PAGE_BITS;
+
+  /** Forward iterator over the valid entries in order of their id. */
+  template <bool IsConst>
+  class Iterator
+  {
+    friend class NodeIdTable;
+    template <bool>
+    friend class Iterator;
+    using Table = std::conditional_t<IsConst, const NodeIdTable, NodeIdTable>;
+
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Entry;
+    using difference_type   = std::ptrdiff_t;
+    using pointer   = std::conditional_t<IsConst, const Entry*, Entry*>;
+    using reference = std::conditional_t<IsConst, const Entry&, Entry&>;
+
+    Iterator() = default;
+    /** Conversion from non-const to const iterator. */
+    template <bool C = IsConst, class = std::enable_if_t<C>>
+    Iterator(const Iterator<false>& other)
+        : d_table(other.d_table), d_id(other.d_id)
+    {
+    }
+
+    reference operator*() const { return **d_table->slot(d_id); }
+    pointer operator->() const { return &**d_table->slot(d_id); }
+
+    Iterator& operator++()
+    {
+      d_id = d_table->next(d_id + 1);
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator res = *this;
+      ++*this;
+      return res;
+    }
+
+    bool operator==(const Iterator& other) const { return d_id == other.d_id; }
+    bool operator!=(const Iterator& other) const { return d_id != other.d_id; }
+
+   private:
+    Iterator(Table* table, uint64_t id) : d_table(table), d_id(id) {}
+
+    /** The iterated table. */
+    Table* d_table = nullptr;
+    /** The id of the current entry, end_id() for the end iterator. */
+    uint64_t d_id = 0;
+  };
+
+  using iterator       = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  NodeIdTable() = default;
+  NodeIdTable(NodeIdTable&& other) = default;
+  NodeIdTable& operator=(NodeIdTable&& other) = default;
+
+  NodeIdTable(const NodeIdTable& other) { *this = other; }
+  NodeIdTable& operator=(const NodeIdTable& other)
+  {
+    if (this != &other)
+    {
+      clear();
+      for (auto it = other.begin(), end = other.end(); it != end; ++it)
+      {
+        emplace(it.d_id, *it);
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * Lookup entry.
+   * @param id The node id.
+   * @return A pointer to the entry of `id`, nullptr if there is none.
+   */
+  Entry* lookup(uint64_t id)
+  {
+    Slot* s = slot(id);
+    return s && s->has_value() ? &**s : nullptr;
+  }
+  const Entry* lookup(uint64_t id) const
+  {
+    const Slot* s = slot(id);
+    return s && s->has_value() ? &**s : nullptr;
+  }
+
+  /**
+   * Construct entry if there is none for given id.
+   * @param id   The node id.
+   * @param args The arguments of the entry constructor.
+   * @return A pair of a reference to the entry of `id` and a flag that
+   *         indicates whether the entry was inserted.
+   */
+  template <class... Args>
+  std::pair<Entry&, bool> emplace(uint64_t id, Args&&... args)
+  {
+    assert(id > 0);
+    uint64_t page = id >> PAGE_BITS;
+    if (page >= d_pages.size())
+    {
+      d_pages.resize(page + 1);
+      d_page_sizes.resize(page + 1, 0);
+    }
+    if (!d_pages[page])
+    {
+      d_pages[page].reset(new Slot[PAGE_SIZE]);
+    }
+    Slot& s = d_pages[page][id & (PAGE_SIZE - 1)];
+    if (s.has_value())
+    {
+      return {*s, false};
+    }
+    s.emplace(std::forward<Args>(args)...);
+    d_page_sizes[page] += 1;
+    d_size += 1;
+    return {*s, true};
+  }
+
+  /**
+   * Remove entry.
+   * @param id The node id.
+   * @return True if there was an entry for `id`.
+   */
+  bool erase(uint64_t id)
+  {
+    Slot* s = slot(id);
+    if (!s || !s->has_value())
+    {
+      return false;
+    }
+    s->reset();
+    d_size -= 1;
+    uint64_t page = id >> PAGE_BITS;
+    if (--d_page_sizes[page] == 0)
+    {
+      d_pages[page].reset();
+      // Drop trailing unallocated pages.
+      while (!d_pages.empty() && !d_pages.back())
+      {
+        d_pages.pop_back();
+        d_page_sizes.pop_back();
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Remove all entries and free all pages. Takes time linear in the number of
+   * entries and pages.
+   */
+  void clear()
+  {
+    d_pages.clear();
+    d_page_sizes.clear();
+    d_size = 0;
+  }
+
+  /** @return The number of entries. */
+  size_t size() const { return d_size; }
+  /** @return True if the table has no entries. */
+  bool empty() const { return d_size == 0; }
+  /** @return The number of allocated pages. */
+  size_t num_pages() const
+  {
+    size_t res = 0;
+    for (const auto& page : d_pages)
+    {
+      res += page != nullptr;
+    }
+    return res;
+  }
+
+  iterator begin() { return iterator(this, next(0)); }
+  iterator end() { return iterator(this, end_id()); }
+  const_iterator begin() const { return const_iterator(this, next(0)); }
+  const_iterator end() const { return const_iterator(this, end_id()); }
+
+  /** @return An iterator to the entry of given id, end() if there is none. */
+  iterator find(uint64_t id)
+  {
+    return lookup(id) ? iterator(this, id) : end();
+  }
+  const_iterator find(uint64_t id) const
+  {
+    return lookup(id) ? const_iterator(this, id) : end();
+  }
+
+  /** @return The node id of the entry at given iterator. */
+  static uint64_t id(const const_iterator& it) { return it.d_id; }
+
+ private:
+  /** @return The slot of given id, nullptr if its page is not allocated. */
+  Slot* slot(uint64_t id)
+  {
+    uint64_t page = id >> PAGE_BITS;
+    return page < d_pages.size() && d_pages[page]
+               ? &d_pages[page][id & (PAGE_SIZE - 1)]
+               : nullptr;
+  }
+  const Slot* slot(uint64_t id) const
+  {
+    return const_cast<NodeIdTable*>(this)->slot(id);
+  }
+
+  /** @return The id past the last slot of the table. */
+  uint64_t end_id() const { return d_pages.size() << PAGE_BITS; }
+
+  /** @return The smallest id >= `id` with a valid entry, or end_id(). */
+  uint64_t next(uint64_t id) const
+  {
+    for (uint64_t end = end_id(); id < end;)
+    {
+      const auto& page = d_pages[id >> PAGE_BITS];
+      if (!page)
+      {
+        id = ((id >> PAGE_BITS) + 1) << PAGE_BITS;
+        continue;
+      }
+      if (page[id & (PAGE_SIZE - 1)].has_value())
+      {
+        return id;
+      }
+      ++id;
+    }
+    return end_id();
+  }
+
+  /** The pages, nullptr if not allocated. */
+  std::vector<std::unique_ptr<Slot[]>> d_pages;
+  /** The number of entries per page, a page is freed if it has none. */
+  std::vector<uint32_t> d_page_sizes;
+  /** The number of entries. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::node
+
+#endif
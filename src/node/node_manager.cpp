@@ -10,11 +10,14 @@
 
 #include "node/node_manager.h"
 
+#include <array>
 #include <deque>
 #include <functional>
+#include <type_traits>
 
 #include "bv/bitvector.h"
 #include "node/kind_info.h"
+#include "solver/bv/bitblast_cache.h"
 #include "solver/fp/floating_point.h"
 #include "solver/fp/rounding_mode.h"
 
@@ -24,6 +27,16 @@ using namespace node;
 
 /* --- NodeManager public -------------------------------------------------- */
 
+NodeManager::NodeManager(bool thread_safe)
+    : d_thread_safe(thread_safe), d_tm(thread_safe)
+{
+  size_t num_shards = thread_safe ? s_num_shards : 1;
+  for (size_t i = 0; i < num_shards; ++i)
+  {
+    d_shards.emplace_back(new Shard(thread_safe));
+  }
+}
+
 NodeManager::~NodeManager()
 {
   // Cleanup remaining node data for constants and variables.
@@ -34,7 +47,7 @@ NodeManager::~NodeManager()
   //       node data before destructing the node manager.
   for (NodeData* d : d_alloc_nodes)
   {
-    NodeData::dealloc(d);
+    NodeData::dealloc(d_shards[0]->d_arena, d);
   }
 }
 
@@ -47,13 +60,7 @@ NodeManager::tm()
 Node
 NodeManager::mk_const(const Type& t, const std::optional<std::string>& symbol)
 {
-  assert(!t.is_null());
-  assert(t.tm() == &d_tm);
-  NodeData* data = NodeData::alloc(Kind::CONSTANT, symbol);
-  data->d_type   = t;
-  init_id(data);
-  d_alloc_nodes.emplace(data);
-  return Node(data);
+  return mk_symbol(Kind::CONSTANT, t, symbol);
 }
 
 Node
@@ -66,91 +73,52 @@ NodeManager::mk_const_array(const Type& t, const Node& term)
   assert(t.tm() == &d_tm);
   assert(term.nm() == this);
 
-  NodeData* data = find_or_insert_node(Kind::CONST_ARRAY, t, {term}, {});
-  return Node(data);
+  return find_or_insert_node(
+      Kind::CONST_ARRAY, t, util::Span<Node>(&term, 1), {});
 }
 
 Node
 NodeManager::mk_var(const Type& t, const std::optional<std::string>& symbol)
 {
-  assert(!t.is_null());
-  assert(t.tm() == &d_tm);
-  NodeData* data = NodeData::alloc(Kind::VARIABLE, symbol);
-  data->d_type   = t;
-  init_id(data);
-  d_alloc_nodes.emplace(data);
-  return Node(data);
+  return mk_symbol(Kind::VARIABLE, t, symbol);
 }
 
 Node
 NodeManager::mk_value(bool value)
 {
-  Type type             = mk_bool_type();
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(mk_bool_type(), value);
 }
 
 Node
 NodeManager::mk_value(const BitVector& value)
 {
-  Type type             = mk_bv_type(value.size());
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(mk_bv_type(value.size()), value);
 }
 
 Node
 NodeManager::mk_value(const RoundingMode value)
 {
-  Type type             = mk_rm_type();
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(mk_rm_type(), value);
 }
 
 Node
 NodeManager::mk_value(const FloatingPoint& value)
 {
-  Type type =
-      mk_fp_type(value.get_exponent_size(), value.get_significand_size());
-  auto [inserted, data] = d_unique_table.find_or_insert(type, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = std::move(type);
-  }
-  return Node(data);
+  return find_or_insert_value(
+      mk_fp_type(value.get_exponent_size(), value.get_significand_size()),
+      value);
 }
 
 Node
 NodeManager::mk_value(const Type& t, const std::string& value)
 {
-  auto [inserted, data] = d_unique_table.find_or_insert(t, value);
-  if (inserted)
-  {
-    init_id(data);
-    data->d_type = t;
-  }
-  return Node(data);
+  return find_or_insert_value(t, value);
 }
 
 Node
 NodeManager::mk_node(Kind kind,
-                     const std::vector<Node>& children,
-                     const std::vector<uint64_t>& indices)
+                     util::Span<Node> children,
+                     util::Span<uint64_t> indices)
 {
   assert(kind != Kind::CONSTANT);
   assert(kind != Kind::CONST_ARRAY);
@@ -160,8 +128,34 @@ NodeManager::mk_node(Kind kind,
     return c.nm() == this;
   }));
 
-  NodeData* data = find_or_insert_node(kind, Type(), children, indices);
-  return Node(data);
+  return find_or_insert_node(kind, Type(), children, indices);
+}
+
+Node
+NodeManager::mk_node(Kind kind, const Node& child0)
+{
+  return mk_node(kind, util::Span<Node>(&child0, 1));
+}
+
+Node
+NodeManager::mk_node(Kind kind, const Node& child0, const Node& child1)
+{
+  assert(child0.nm() == this && child1.nm() == this);
+  std::array<ConstNodeRef, 2> children{child0, child1};
+  return find_or_insert_node(
+      kind, Type(), util::Span<ConstNodeRef>(children), {});
+}
+
+Node
+NodeManager::mk_node(Kind kind,
+                     const Node& child0,
+                     const Node& child1,
+                     const Node& child2)
+{
+  assert(child0.nm() == this && child1.nm() == this && child2.nm() == this);
+  std::array<ConstNodeRef, 3> children{child0, child1, child2};
+  return find_or_insert_node(
+      kind, Type(), util::Span<ConstNodeRef>(children), {});
 }
 
 Node
@@ -171,9 +165,9 @@ NodeManager::invert_node(const Node& node)
   assert(node.nm() == this);
   if (node.type().is_bool())
   {
-    return mk_node(node::Kind::NOT, {node});
+    return mk_node(node::Kind::NOT, node);
   }
-  return mk_node(node::Kind::BV_NOT, {node});
+  return mk_node(node::Kind::BV_NOT, node);
 }
 
 Type
@@ -220,8 +214,8 @@ NodeManager::mk_uninterpreted_type(const std::optional<std::string>& symbol)
 
 Type
 NodeManager::compute_type(Kind kind,
-                          const std::vector<Node>& children,
-                          const std::vector<uint64_t>& indices)
+                          util::Span<Node> children,
+                          util::Span<uint64_t> indices)
 {
   assert(check_type(kind, children, indices).first);
 
@@ -383,8 +377,8 @@ NodeManager::compute_type(Kind kind,
 
 std::pair<bool, std::string>
 NodeManager::check_type(Kind kind,
-                        const std::vector<Node>& children,
-                        const std::vector<uint64_t>& indices)
+                        util::Span<Node> children,
+                        util::Span<uint64_t> indices)
 {
   std::stringstream ss;
 
@@ -805,52 +799,151 @@ NodeManager::check_type(Kind kind,
   return std::make_pair(true, "");
 }
 
+bv::BitblastCache&
+NodeManager::bitblast_cache()
+{
+  std::call_once(d_bitblast_cache_init, [this]() {
+    d_bitblast_cache.reset(new bv::BitblastCache());
+    d_has_bitblast_cache.store(true, std::memory_order_release);
+  });
+  return *d_bitblast_cache;
+}
+
 /* --- NodeManager private ------------------------------------------------- */
 
+NodeManager::Shard&
+NodeManager::shard(size_t hash)
+{
+  if (d_shards.size() == 1)
+  {
+    return *d_shards[0];
+  }
+  // Fibonacci hashing, determines the shard based on the upper bits of the
+  // scrambled hash value since the unique table of the shard uses the lower
+  // bits of the hash value.
+  uint64_t h = static_cast<uint64_t>(hash) * UINT64_C(0x9e3779b97f4a7c15);
+  return *d_shards[h >> (64 - s_log2_num_shards)];
+}
+
+std::unique_lock<std::mutex>
+NodeManager::lock(std::mutex& mutex)
+{
+  if (d_thread_safe)
+  {
+    return std::unique_lock<std::mutex>(mutex);
+  }
+  return std::unique_lock<std::mutex>();
+}
+
+Node
+NodeManager::mk_node_from_data(NodeData* data, bool inserted)
+{
+  if (d_thread_safe && !inserted)
+  {
+    Node res;
+    res.d_data = data;
+    return res;
+  }
+  return Node(data);
+}
+
+template <class T>
+Node
+NodeManager::find_or_insert_value(Type type, const T& value)
+{
+  size_t hash = NodeUniqueTable::hash_value(value);
+  Shard& s    = shard(hash);
+  auto lock   = this->lock(s.d_mutex);
+  auto [inserted, data] = s.d_unique_table.find_or_insert(type, value, hash);
+  if (inserted)
+  {
+    init_id(data);
+    data->d_type = std::move(type);
+  }
+  // Note: In thread-safe mode, the node must be created while holding the
+  //       lock to make sure that new node data is referenced before it can be
+  //       found by other threads.
+  return mk_node_from_data(data, inserted);
+}
+
+Node
+NodeManager::mk_symbol(Kind kind,
+                       const Type& t,
+                       const std::optional<std::string>& symbol)
+{
+  assert(kind == Kind::CONSTANT || kind == Kind::VARIABLE);
+  assert(!t.is_null());
+  assert(t.tm() == &d_tm);
+  Shard& s       = *d_shards[0];
+  auto lock      = this->lock(s.d_mutex);
+  NodeData* data = NodeData::alloc(s.d_arena, kind, symbol);
+  data->d_type   = t;
+  init_id(data);
+  d_alloc_nodes.emplace(data);
+  return Node(data);
+}
+
 void
 NodeManager::init_id(NodeData* data)
 {
-  assert(d_node_id_counter < UINT64_MAX);
   assert(data != nullptr);
   assert(data->d_id == 0);
-  data->d_id = d_node_id_counter++;
-  data->d_nm = this;
-  ++d_stats.d_num_node_data;
+  data->d_id = d_node_id_counter.fetch_add(1, std::memory_order_relaxed);
+  assert(data->d_id < UINT64_MAX);
+  data->d_nm          = this;
+  data->d_thread_safe = d_thread_safe;
+  d_stats.d_num_node_data.fetch_add(1, std::memory_order_relaxed);
 }
 
-NodeData*
+template <class T>
+Node
 NodeManager::find_or_insert_node(node::Kind kind,
                                  const Type& type,
-                                 const std::vector<Node>& children,
-                                 const std::vector<uint64_t>& indices)
+                                 util::Span<T> children,
+                                 util::Span<uint64_t> indices)
 {
-  auto [inserted, data] =
-      d_unique_table.find_or_insert(kind, type, children, indices);
-  if (inserted)
+  size_t hash    = NodeUniqueTable::hash(kind, children, indices);
+  Shard& s       = shard(hash);
+  auto lock      = this->lock(s.d_mutex);
+  NodeData* data = s.d_unique_table.find(kind, type, children, indices, hash);
+  if (data)
+  {
+    return mk_node_from_data(data, false);
+  }
+
+  // Initialize new node
+  if constexpr (std::is_same_v<T, Node>)
   {
-    // Initialize new node
+    data = s.d_unique_table.insert(kind, children, indices, hash);
     init_id(data);
-    if (type.is_null())
-    {
-      data->d_type = compute_type(kind, children, indices);
-    }
-    else
-    {
-      data->d_type = type;
-    }
+    data->d_type =
+        type.is_null() ? compute_type(kind, children, indices) : type;
+  }
+  else
+  {
+    std::vector<Node> nodes(children.begin(), children.end());
+    data = s.d_unique_table.insert(kind, nodes, indices, hash);
+    init_id(data);
+    data->d_type = type.is_null() ? compute_type(kind, nodes, indices) : type;
   }
-  return data;
+  return mk_node_from_data(data, true);
 }
 
 void
 NodeManager::garbage_collect(NodeData* data)
 {
   assert(data->d_refs == 0);
-  assert(!d_in_gc_mode);
+  assert(d_thread_safe || !d_in_gc_mode);
 
-  d_in_gc_mode = true;
+  if (!d_thread_safe)
+  {
+    d_in_gc_mode = true;
+  }
 
   std::deque<NodeData*> visit{data};
+  // Ids of collected nodes, erased from the bit-blast cache.
+  bool erase_cached = d_has_bitblast_cache.load(std::memory_order_acquire);
+  std::vector<uint64_t> erased_ids;
 
   NodeData* cur;
   do
@@ -858,13 +951,23 @@ NodeManager::garbage_collect(NodeData* data)
     cur = visit.front();
     visit.pop_front();
 
+    if (erase_cached)
+    {
+      erased_ids.push_back(cur->get_id());
+    }
+
     size_t num_children = cur->get_num_children();
     Kind kind           = cur->get_kind();
+    bool is_symbol      = kind == Kind::CONSTANT || kind == Kind::VARIABLE;
+
+    // Constants and variables are allocated from the first shard.
+    Shard& s  = is_symbol ? *d_shards[0] : shard(NodeUniqueTable::hash(cur));
+    auto lock = this->lock(s.d_mutex);
 
     // Erase node data before we modify children.
     if (num_children > 0 || kind == Kind::VALUE)
     {
-      d_unique_table.erase(cur);
+      s.d_unique_table.erase(cur);
     }
 
     if (num_children > 0)
@@ -878,24 +981,31 @@ NodeManager::garbage_collect(NodeData* data)
         // Manually decrement reference count to not trigger decrement of
         // NodeData reference. This will avoid recursive calls to
         // garbage_collect().
-        --d->d_refs;
         child.d_data = nullptr;
-        if (d->d_refs == 0)
+        if (d->release())
         {
           visit.push_back(d);
         }
       }
     }
-    else if (kind == Kind::CONSTANT || kind == Kind::VARIABLE)
+    else if (is_symbol)
     {
       d_alloc_nodes.erase(cur);
     }
-    NodeData::dealloc(cur);
-    --d_stats.d_num_node_data;
-    ++d_stats.d_num_node_data_dealloc;
+    NodeData::dealloc(s.d_arena, cur);
+    d_stats.d_num_node_data.fetch_sub(1, std::memory_order_relaxed);
+    d_stats.d_num_node_data_dealloc.fetch_add(1, std::memory_order_relaxed);
   } while (!visit.empty());
 
-  d_in_gc_mode = false;
+  if (erase_cached)
+  {
+    d_bitblast_cache->erase(erased_ids);
+  }
+
+  if (!d_thread_safe)
+  {
+    d_in_gc_mode = false;
+  }
 }
 
 const std::optional<std::reference_wrapper<const std::string>>
@@ -11,7 +11,11 @@
 #ifndef BZLA_NODE_NODE_MANAGER_H_INCLUDED
 #define BZLA_NODE_NODE_MANAGER_H_INCLUDED
 
+#include <atomic>
 #include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -19,8 +23,10 @@
 
 #include "node/node.h"
 #include "node/node_data.h"
+#include "node/node_data_arena.h"
 #include "node/node_unique_table.h"
 #include "type/type_manager.h"
+#include "util/span.h"
 
 namespace bzla {
 
@@ -28,18 +34,43 @@ class BitVector;
 class FloatingPoint;
 enum class RoundingMode;
 
+namespace bv {
+class BitblastCache;
+}
+
+/**
+ * Node manager, creates and owns all nodes and types.
+ *
+ * By default, node managers are not thread-safe. A node manager constructed in
+ * thread-safe mode supports concurrent node and type creation from several
+ * threads, e.g., to share one node manager between solver instances that run
+ * on different threads. In this mode, the unique table is split into
+ * s_num_shards independently locked shards, each with its own node data
+ * arena, reference counts of nodes and types are modified atomically, and
+ * type creation is synchronized (see type::TypeManager).
+ *
+ * @note Nodes may be shared between threads, but a single Node object must
+ *       not be modified concurrently.
+ */
 class NodeManager
 {
   friend node::NodeData;
 
  public:
-  NodeManager() = default;
+  /**
+   * Constructor.
+   * @param thread_safe True to support concurrent node and type creation.
+   */
+  NodeManager(bool thread_safe = false);
   ~NodeManager();
   NodeManager(const NodeManager&)            = delete;
   NodeManager& operator=(const NodeManager&) = delete;
 
   type::TypeManager* tm();
 
+  /** @return True if this node manager is thread-safe. */
+  bool thread_safe() const { return d_thread_safe; }
+
   /* --- Node interface ---------------------------------------------------- */
 
   /**
@@ -115,14 +146,56 @@ class NodeManager
   /**
    * Create node of kind `kind` with given children and indices.
    *
+   * @note Children and indices are only copied if the node does not exist
+   *       yet, vectors and arrays can be passed without conversion.
+   *
+   * @param kind Node kind.
+   * @param children The children of the node.
+   * @param indices The indices if kind is indexed.
+   * @return Node of kind `kind`.
+   */
+  Node mk_node(node::Kind kind,
+               util::Span<Node> children,
+               util::Span<uint64_t> indices = {});
+
+  /**
+   * Create node of kind `kind` with given children and indices.
+   *
+   * Overload for braced lists of children, which takes precedence over the
+   * fixed-arity overloads below for calls of the form
+   * `mk_node(kind, {child}, {index})`.
+   *
    * @param kind Node kind.
    * @param children The children of the node.
    * @param indices The indices if kind is indexed.
    * @return Node of kind `kind`.
    */
   Node mk_node(node::Kind kind,
-               const std::vector<Node>& children,
-               const std::vector<uint64_t>& indices = {});
+               std::initializer_list<Node> children,
+               std::initializer_list<uint64_t> indices = {})
+  {
+    return mk_node(kind,
+                   util::Span<Node>(children),
+                   util::Span<uint64_t>(indices));
+  }
+
+  /**
+   * Create non-indexed node of kind `kind` with one, two or three children.
+   *
+   * Fast path that does not copy the children if the node already exists.
+   *
+   * @param kind Node kind.
+   * @param child0 The first child.
+   * @param child1 The second child.
+   * @param child2 The third child.
+   * @return Node of kind `kind`.
+   */
+  Node mk_node(node::Kind kind, const Node& child0);
+  Node mk_node(node::Kind kind, const Node& child0, const Node& child1);
+  Node mk_node(node::Kind kind,
+               const Node& child0,
+               const Node& child1,
+               const Node& child2);
 
   /**
    * Helper to create an inverted Boolean or bit-vector node.
@@ -187,19 +260,95 @@ class NodeManager
       const std::optional<std::string>& symbol = std::nullopt);
 
   /** Type checking of children and indices based on kind. */
-  std::pair<bool, std::string> check_type(
-      node::Kind kind,
-      const std::vector<Node>& children,
-      const std::vector<uint64_t>& indices = {});
+  std::pair<bool, std::string> check_type(node::Kind kind,
+                                          util::Span<Node> children,
+                                          util::Span<uint64_t> indices = {});
 
 #ifndef NDEBUG
   /** @return Current maximum node id. */
-  uint64_t max_node_id() const { return d_node_id_counter; }
+  uint64_t max_node_id() const { return d_node_id_counter.load(); }
 #endif
 
   const auto& statistics() const { return d_stats; }
 
+  /**
+   * Get the bit-blast cache shared between all solver instances that use this
+   * node manager (see option::Option::SHARED_BITBLAST_CACHE). The cache is
+   * created on first request, entries of garbage collected nodes are erased
+   * from the cache.
+   * @return The shared bit-blast cache.
+   */
+  bv::BitblastCache& bitblast_cache();
+
  private:
+  /** Log2 of the number of unique table shards in thread-safe mode. */
+  static constexpr size_t s_log2_num_shards = 6;
+  /** The number of unique table shards in thread-safe mode. */
+  static constexpr size_t s_num_shards = size_t(1) << s_log2_num_shards;
+
+  /**
+   * Unique table shard, guarded by a mutex in thread-safe mode. Aligned to
+   * avoid false sharing between threads that access different shards.
+   */
+  struct alignas(64) Shard
+  {
+    Shard(bool thread_safe) : d_unique_table(d_arena, thread_safe) {}
+
+    /** Guards all other members of this shard in thread-safe mode. */
+    std::mutex d_mutex;
+    /**
+     * Arena for node data objects.
+     * @note Must be declared before all members that hold node data.
+     */
+    node::NodeDataArena d_arena;
+    /** Lookup data structure for hash consing of node data. */
+    node::NodeUniqueTable d_unique_table;
+  };
+
+  /**
+   * Get the unique table shard responsible for given hash value.
+   * @param hash The hash value of the node lookup data, see
+   *             node::NodeUniqueTable::hash().
+   * @return The shard.
+   */
+  Shard& shard(size_t hash);
+
+  /**
+   * Lock given mutex in thread-safe mode.
+   * @return The lock, which does not own a mutex if not in thread-safe mode.
+   */
+  std::unique_lock<std::mutex> lock(std::mutex& mutex);
+
+  /**
+   * Create node from node data found or inserted by a unique table while
+   * holding the lock of its shard. In thread-safe mode, the reference
+   * acquired by the unique table on lookup is adopted.
+   * @param data     The node data.
+   * @param inserted True if the node data was inserted.
+   * @return The node.
+   */
+  Node mk_node_from_data(node::NodeData* data, bool inserted);
+
+  /**
+   * Find or insert value node data.
+   * @param type  The type of the value.
+   * @param value The value.
+   * @return The value node.
+   */
+  template <class T>
+  Node find_or_insert_value(Type type, const T& value);
+
+  /**
+   * Create constant or variable.
+   * @param kind   Kind::CONSTANT or Kind::VARIABLE.
+   * @param t      The type of the node.
+   * @param symbol The symbol of the node.
+   * @return The constant or variable.
+   */
+  Node mk_symbol(node::Kind kind,
+                 const Type& t,
+                 const std::optional<std::string>& symbol);
+
   /**
    * Initialize node data.
    *
@@ -213,21 +362,24 @@ class NodeManager
   /**
    * Find or insert new node data based on given criteria.
    *
+   * @tparam T Node or ConstNodeRef. Children are only copied if the node data
+   *           is inserted.
    * @param kind The node kind.
    * @param type The node type (needed for CONST_ARRAY).
    * @param children The node children.
    * @param indices The indices for indexed nodes.
-   * @return The node data pointer.
+   * @return The node.
    */
-  node::NodeData* find_or_insert_node(node::Kind kind,
-                                      const Type& type,
-                                      const std::vector<Node>& children,
-                                      const std::vector<uint64_t>& indices);
+  template <class T>
+  Node find_or_insert_node(node::Kind kind,
+                           const Type& type,
+                           util::Span<T> children,
+                           util::Span<uint64_t> indices);
 
   /** Compute type for a node. */
   Type compute_type(node::Kind kind,
-                    const std::vector<Node>& children,
-                    const std::vector<uint64_t>& indices = {});
+                    util::Span<Node> children,
+                    util::Span<uint64_t> indices = {});
 
   /**
    * Garbage collect node data.
@@ -242,25 +394,44 @@ class NodeManager
   const std::optional<std::reference_wrapper<const std::string>> get_symbol(
       const node::NodeData* d) const;
 
+  /** True if this node manager is thread-safe. */
+  const bool d_thread_safe;
+
   /** Type manager. */
   type::TypeManager d_tm;
 
   /** Node id counter. */
-  uint64_t d_node_id_counter = 1;
+  std::atomic<uint64_t> d_node_id_counter = 1;
 
-  /** Indicates whether node manager is in garbage collection mode. */
+  /**
+   * Indicates whether node manager is in garbage collection mode. Not used in
+   * thread-safe mode, where several threads may garbage collect at once.
+   */
   bool d_in_gc_mode = false;
 
-  /** Stores allocated node data objects for constants and variables. */
+  /**
+   * Stores allocated node data objects for constants and variables, which are
+   * allocated from the arena of the first shard and guarded by its mutex.
+   */
   std::unordered_set<node::NodeData*> d_alloc_nodes;
 
-  /** Lookup data structure for hash consing of node data. */
-  node::NodeUniqueTable d_unique_table;
+  /**
+   * The unique table shards, a single shard if not in thread-safe mode.
+   * @note Must be declared after d_tm since node data holds types.
+   */
+  std::vector<std::unique_ptr<Shard>> d_shards;
+
+  /** Shared bit-blast cache, created on first request. */
+  std::unique_ptr<bv::BitblastCache> d_bitblast_cache;
+  /** Guards creation of d_bitblast_cache. */
+  std::once_flag d_bitblast_cache_init;
+  /** True if d_bitblast_cache was created, checked in garbage_collect(). */
+  std::atomic<bool> d_has_bitblast_cache = false;
 
   struct Statistics
   {
-    uint64_t d_num_node_data = 0;
-    uint64_t d_num_node_data_dealloc = 0;
+    std::atomic<uint64_t> d_num_node_data         = 0;
+    std::atomic<uint64_t> d_num_node_data_dealloc = 0;
   } d_stats;
 };
 
@@ -0,0 +1,152 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_MAP_H_INCLUDED
+#define BZLA_NODE_NODE_MAP_H_INCLUDED
+
+#include <stdexcept>
+#include <tuple>
+
+#include "node/node.h"
+#include "node/node_id_table.h"
+
+namespace bzla::node {
+
+/**
+ * Map from nodes to values of type T, stored densely by node id.
+ *
+ * Drop-in replacement for std::unordered_map<Node, T> in hot paths, which
+ * avoids hashing and bucket chains (see NodeIdTable). Iteration is in
+ * ascending order of node ids. References to entries stay valid on insertion.
+ *
+ * All keys must belong to the same node manager. Map NodeMap<T, Node> keeps
+ * its keys alive, map NodeMap<T, ConstNodeRef> (see NodeRefMap) does not
+ * reference its keys, which must outlive their entries.
+ */
+template <class T, class Key = Node>
+class NodeMap
+{
+  static_assert(std::is_same_v<Key, Node> || std::is_same_v<Key, ConstNodeRef>,
+                "key must be Node or ConstNodeRef");
+
+  using Table = NodeIdTable<std::pair<const Key, T>>;
+
+ public:
+  using key_type       = Key;
+  using mapped_type    = T;
+  using value_type     = std::pair<const Key, T>;
+  using iterator       = typename Table::iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  /**
+   * Insert entry if there is none for given key.
+   * @param key  The key.
+   * @param args The arguments of the value constructor.
+   * @return A pair of an iterator to the entry of `key` and a flag that
+   *         indicates whether the entry was inserted.
+   */
+  template <class... Args>
+  std::pair<iterator, bool> emplace(const Node& key, Args&&... args)
+  {
+    assert(!key.is_null());
+    uint64_t id   = key.id();
+    bool inserted = d_table
+                        .emplace(id,
+                                 std::piecewise_construct,
+                                 std::forward_as_tuple(key),
+                                 std::forward_as_tuple(
+                                     std::forward<Args>(args)...))
+                        .second;
+    return {d_table.find(id), inserted};
+  }
+
+  /** Insert entry if there is none for the key of given pair. */
+  std::pair<iterator, bool> insert(const value_type& value)
+  {
+    return emplace(value.first, value.second);
+  }
+
+  /**
+   * Insert default constructed value if there is no entry for given key.
+   * @return A reference to the value of `key`.
+   */
+  T& operator[](const Node& key)
+  {
+    assert(!key.is_null());
+    return d_table
+        .emplace(key.id(),
+                 std::piecewise_construct,
+                 std::forward_as_tuple(key),
+                 std::forward_as_tuple())
+        .first.second;
+  }
+
+  /** @return A reference to the value of given key, which must exist. */
+  T& at(const Node& key)
+  {
+    value_type* e = d_table.lookup(key.id());
+    if (!e)
+    {
+      throw std::out_of_range("node not in NodeMap");
+    }
+    return e->second;
+  }
+  const T& at(const Node& key) const
+  {
+    const value_type* e = d_table.lookup(key.id());
+    if (!e)
+    {
+      throw std::out_of_range("node not in NodeMap");
+    }
+    return e->second;
+  }
+
+  /** @return An iterator to the entry of given key, end() if there is none. */
+  iterator find(const Node& key) { return d_table.find(key.id()); }
+  const_iterator find(const Node& key) const { return d_table.find(key.id()); }
+
+  /** @return True if there is an entry for given key. */
+  bool contains(const Node& key) const
+  {
+    return d_table.lookup(key.id()) != nullptr;
+  }
+  /** @return 1 if there is an entry for given key, and 0 otherwise. */
+  size_t count(const Node& key) const { return contains(key) ? 1 : 0; }
+
+  /**
+   * Remove entry of given key.
+   * @return The number of removed entries.
+   */
+  size_t erase(const Node& key) { return d_table.erase(key.id()) ? 1 : 0; }
+  /** Remove all entries. */
+  void clear() { d_table.clear(); }
+
+  /** @return The number of entries. */
+  size_t size() const { return d_table.size(); }
+  /** @return True if the map is empty. */
+  bool empty() const { return d_table.empty(); }
+
+  iterator begin() { return d_table.begin(); }
+  iterator end() { return d_table.end(); }
+  const_iterator begin() const { return d_table.begin(); }
+  const_iterator end() const { return d_table.end(); }
+
+ private:
+  /** The entries. */
+  Table d_table;
+};
+
+/** Map from nodes to values that does not reference its keys. */
+template <class T>
+using NodeRefMap = NodeMap<T, ConstNodeRef>;
+
+}  // namespace bzla::node
+
+#endif
@@ -0,0 +1,94 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_SET_H_INCLUDED
+#define BZLA_NODE_NODE_SET_H_INCLUDED
+
+#include "node/node.h"
+#include "node/node_id_table.h"
+
+namespace bzla::node {
+
+/**
+ * Set of nodes, stored densely by node id.
+ *
+ * Drop-in replacement for std::unordered_set<Node> in hot paths (see
+ * NodeIdTable). Iteration is in ascending order of node ids.
+ *
+ * All nodes must belong to the same node manager. Set NodeSet<Node> keeps its
+ * nodes alive, set NodeSet<ConstNodeRef> (see NodeRefSet) does not reference
+ * its nodes, which must outlive their entries.
+ */
+template <class Key = Node>
+class NodeSet
+{
+  static_assert(std::is_same_v<Key, Node> || std::is_same_v<Key, ConstNodeRef>,
+                "key must be Node or ConstNodeRef");
+
+  using Table = NodeIdTable<const Key>;
+
+ public:
+  using key_type       = Key;
+  using value_type     = Key;
+  using iterator       = typename Table::const_iterator;
+  using const_iterator = typename Table::const_iterator;
+
+  /**
+   * Insert node.
+   * @param node The node.
+   * @return A pair of an iterator to `node` and a flag that indicates whether
+   *         `node` was inserted.
+   */
+  std::pair<iterator, bool> insert(const Node& node)
+  {
+    assert(!node.is_null());
+    uint64_t id   = node.id();
+    bool inserted = d_table.emplace(id, node).second;
+    return {d_table.find(id), inserted};
+  }
+
+  /** @return An iterator to given node, end() if it is not in the set. */
+  iterator find(const Node& node) const { return d_table.find(node.id()); }
+
+  /** @return True if given node is in the set. */
+  bool contains(const Node& node) const
+  {
+    return d_table.lookup(node.id()) != nullptr;
+  }
+  /** @return 1 if given node is in the set, and 0 otherwise. */
+  size_t count(const Node& node) const { return contains(node) ? 1 : 0; }
+
+  /**
+   * Remove given node.
+   * @return The number of removed nodes.
+   */
+  size_t erase(const Node& node) { return d_table.erase(node.id()) ? 1 : 0; }
+  /** Remove all nodes. */
+  void clear() { d_table.clear(); }
+
+  /** @return The number of nodes. */
+  size_t size() const { return d_table.size(); }
+  /** @return True if the set is empty. */
+  bool empty() const { return d_table.empty(); }
+
+  iterator begin() const { return d_table.begin(); }
+  iterator end() const { return d_table.end(); }
+
+ private:
+  /** The nodes. */
+  Table d_table;
+};
+
+/** Set of nodes that does not reference its nodes. */
+using NodeRefSet = NodeSet<ConstNodeRef>;
+
+}  // namespace bzla::node
+
+#endif
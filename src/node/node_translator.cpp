@@ -0,0 +1,175 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_translator.h"
+
+#include "bv/bitvector.h"
+#include "node/node_manager.h"
+#include "solver/fp/floating_point.h"
+#include "solver/fp/rounding_mode.h"
+#include "solver/fp/symfpu_nm.h"
+
+namespace bzla::node {
+
+/* --- NodeTranslator public ----------------------------------------------- */
+
+NodeTranslator::NodeTranslator(NodeManager& nm) : d_nm(nm) {}
+
+Node
+NodeTranslator::translate(const Node& node)
+{
+  assert(!node.is_null());
+  std::vector<ConstNodeRef> visit{node};
+  do
+  {
+    const Node& cur = visit.back();
+    auto [it, inserted] = d_cache.emplace(cur, Node());
+    if (inserted)
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    else if (it->second.is_null())
+    {
+      it->second = translate_node(cur);
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return d_cache.at(node);
+}
+
+Type
+NodeTranslator::translate(const Type& type)
+{
+  assert(!type.is_null());
+  auto it = d_type_cache.find(type);
+  if (it != d_type_cache.end())
+  {
+    return it->second;
+  }
+
+  Type res;
+  if (type.is_bool())
+  {
+    res = d_nm.mk_bool_type();
+  }
+  else if (type.is_bv())
+  {
+    res = d_nm.mk_bv_type(type.bv_size());
+  }
+  else if (type.is_fp())
+  {
+    res = d_nm.mk_fp_type(type.fp_exp_size(), type.fp_sig_size());
+  }
+  else if (type.is_rm())
+  {
+    res = d_nm.mk_rm_type();
+  }
+  else if (type.is_array())
+  {
+    res = d_nm.mk_array_type(translate(type.array_index()),
+                             translate(type.array_element()));
+  }
+  else if (type.is_fun())
+  {
+    std::vector<Type> types;
+    for (const Type& t : type.fun_types())
+    {
+      types.push_back(translate(t));
+    }
+    res = d_nm.mk_fun_type(types);
+  }
+  else
+  {
+    assert(type.is_uninterpreted());
+    res = d_nm.mk_uninterpreted_type(type.uninterpreted_symbol());
+  }
+  d_type_cache.emplace(type, res);
+  return res;
+}
+
+void
+NodeTranslator::add(const Node& from, const Node& to)
+{
+  assert(to.nm() == &d_nm);
+  d_cache[from] = to;
+}
+
+void
+NodeTranslator::add(const Type& from, const Type& to)
+{
+  assert(to.tm() == d_nm.tm());
+  d_type_cache[from] = to;
+}
+
+/* --- NodeTranslator private ---------------------------------------------- */
+
+Node
+NodeTranslator::translate_node(const Node& node)
+{
+  Kind k = node.kind();
+
+  if (k == Kind::CONSTANT || k == Kind::VARIABLE)
+  {
+    std::optional<std::string> symbol;
+    auto sym = node.symbol();
+    if (sym)
+    {
+      symbol = sym->get();
+    }
+    Type type = translate(node.type());
+    return k == Kind::CONSTANT ? d_nm.mk_const(type, symbol)
+                               : d_nm.mk_var(type, symbol);
+  }
+
+  if (k == Kind::VALUE)
+  {
+    const Type& type = node.type();
+    if (type.is_bool())
+    {
+      return d_nm.mk_value(node.value<bool>());
+    }
+    if (type.is_bv())
+    {
+      return d_nm.mk_value(node.value<BitVector>());
+    }
+    if (type.is_rm())
+    {
+      return d_nm.mk_value(node.value<RoundingMode>());
+    }
+    if (type.is_fp())
+    {
+      // Floating-point values store their type, hence we have to recreate
+      // them from their IEEE-754 representation in the target node manager.
+      fp::SymFpuNM snm(d_nm);
+      return d_nm.mk_value(FloatingPoint(
+          translate(type), node.value<FloatingPoint>().as_bv()));
+    }
+    assert(type.is_uninterpreted());
+    return d_nm.mk_value(translate(type), node.value<std::string>());
+  }
+
+  if (k == Kind::CONST_ARRAY)
+  {
+    return d_nm.mk_const_array(translate(node.type()), d_cache.at(node[0]));
+  }
+
+  std::vector<Node> children;
+  for (const Node& child : node)
+  {
+    auto it = d_cache.find(child);
+    assert(it != d_cache.end());
+    assert(!it->second.is_null());
+    children.push_back(it->second);
+  }
+  return d_nm.mk_node(k, children, node.indices());
+}
+
+}  // namespace bzla::node
@@ -0,0 +1,95 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_NODE_NODE_TRANSLATOR_H_INCLUDED
+#define BZLA_NODE_NODE_TRANSLATOR_H_INCLUDED
+
+#include <unordered_map>
+
+#include "node/node.h"
+#include "type/type.h"
+
+namespace bzla {
+
+class NodeManager;
+
+namespace node {
+
+/**
+ * Translates nodes and types created by one node manager into structurally
+ * equivalent nodes and types of another node manager.
+ *
+ * Constants, variables and uninterpreted types are mapped one-to-one, i.e.,
+ * translating the same constant twice yields the same constant. The mapping
+ * can be pre-seeded via add() to translate back into the source node manager.
+ */
+class NodeTranslator
+{
+ public:
+  /**
+   * Constructor.
+   * @param nm The node manager to translate nodes into.
+   */
+  NodeTranslator(NodeManager& nm);
+
+  /**
+   * Translate given node into the target node manager.
+   * @param node The node to translate.
+   * @return The translated node.
+   */
+  Node translate(const Node& node);
+
+  /**
+   * Translate given type into the target node manager.
+   * @param type The type to translate.
+   * @return The translated type.
+   */
+  Type translate(const Type& type);
+
+  /**
+   * Explicitly map node `from` to node `to` of the target node manager.
+   * @param from The node to map.
+   * @param to   The node it is translated to.
+   */
+  void add(const Node& from, const Node& to);
+
+  /**
+   * Explicitly map type `from` to type `to` of the target node manager.
+   * @param from The type to map.
+   * @param to   The type it is translated to.
+   */
+  void add(const Type& from, const Type& to);
+
+  /** @return The node cache, maps source nodes to translated nodes. */
+  const std::unordered_map<Node, Node>& node_map() const { return d_cache; }
+  /** @return The type cache, maps source types to translated types. */
+  const std::unordered_map<Type, Type>& type_map() const
+  {
+    return d_type_cache;
+  }
+
+ private:
+  /**
+   * Translate given node, all of its children have already been translated.
+   */
+  Node translate_node(const Node& node);
+
+  /** The target node manager. */
+  NodeManager& d_nm;
+  /** Node translation cache. */
+  std::unordered_map<Node, Node> d_cache;
+  /** Type translation cache. */
+  std::unordered_map<Type, Type> d_type_cache;
+};
+
+}  // namespace node
+}  // namespace bzla
+
+#endif
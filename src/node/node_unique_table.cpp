@@ -6,7 +6,11 @@ namespace bzla::node {
 
 /* --- NodeUniqueTable public ----------------------------------------------- */
 
-NodeUniqueTable::NodeUniqueTable() { d_buckets.resize(16, nullptr); }
+NodeUniqueTable::NodeUniqueTable(NodeDataArena& arena, bool thread_safe)
+    : d_arena(arena), d_thread_safe(thread_safe)
+{
+  d_buckets.resize(16, nullptr);
+}
 
 NodeUniqueTable::~NodeUniqueTable()
 {
@@ -30,7 +34,7 @@ NodeUniqueTable::~NodeUniqueTable()
           payload.d_children[j].d_data = nullptr;
         }
       }
-      NodeData::dealloc(cur);
+      NodeData::dealloc(d_arena, cur);
       cur = next;
     }
   }
@@ -39,39 +43,39 @@ NodeUniqueTable::~NodeUniqueTable()
 std::pair<bool, NodeData*>
 NodeUniqueTable::find_or_insert(Kind kind,
                                 const Type& type,
-                                const std::vector<Node>& children,
-                                const std::vector<uint64_t>& indices)
+                                util::Span<Node> children,
+                                util::Span<uint64_t> indices)
 {
-  assert(kind != Kind::VALUE);
-
-  size_t hd     = hash(kind, children, indices);
-  size_t h      = bucket_hash(hd);
-  NodeData* cur = d_buckets[h];
-
-  // Check collision chain.
-  while (cur)
+  size_t hd   = hash(kind, children, indices);
+  NodeData* d = find(kind, type, children, indices, hd);
+  if (d)
   {
-    // Found existing node
-    if (equals(*cur, kind, type, children, indices))
-    {
-      return std::make_pair(false, cur);
-    }
-    cur = cur->d_next;
+    return std::make_pair(false, d);
   }
+  return std::make_pair(true, insert(kind, children, indices, hd));
+}
+
+NodeData*
+NodeUniqueTable::insert(Kind kind,
+                        util::Span<Node> children,
+                        util::Span<uint64_t> indices,
+                        size_t hash)
+{
+  assert(kind != Kind::VALUE);
 
   // Create new node and insert
-  NodeData* d = NodeData::alloc(kind, children, indices);
+  NodeData* d = NodeData::alloc(d_arena, kind, children, indices);
   if (needs_resize())
   {
     resize();
-    h = bucket_hash(hd);
   }
+  size_t h = bucket_hash(hash);
   assert(d->d_next == nullptr);
   d->d_next    = d_buckets[h];
   d_buckets[h] = d;
 
   ++d_num_elements;
-  return std::make_pair(true, d);
+  return d;
 }
 
 void
@@ -107,33 +111,8 @@ NodeUniqueTable::erase(const NodeData* d)
   --d_num_elements;
 }
 
-/* --- NodeUniqueTable private ---------------------------------------------- */
-
-void
-NodeUniqueTable::resize()
-{
-  size_t new_size = d_buckets.capacity() * 2;
-  std::vector<NodeData*> buckets(new_size, nullptr);
-
-  // Rehash elements.
-  size_t mask = new_size - 1;
-  for (auto cur : d_buckets)
-  {
-    while (cur)
-    {
-      size_t h     = bucket_hash(hash(cur), mask);
-      auto next    = cur->d_next;
-      cur->d_next  = buckets[h];
-      buckets[h]   = cur;
-      cur          = next;
-    }
-  }
-
-  d_buckets = std::move(buckets);
-}
-
 size_t
-NodeUniqueTable::hash(const NodeData* d) const
+NodeUniqueTable::hash(const NodeData* d)
 {
   size_t hash = static_cast<size_t>(d->get_kind());
 
@@ -186,87 +165,29 @@ NodeUniqueTable::hash(const NodeData* d) const
   return hash;
 }
 
-size_t
-NodeUniqueTable::hash(Kind kind,
-                      const std::vector<Node>& children,
-                      const std::vector<uint64_t>& indices) const
-{
-  assert(!children.empty());
-
-  size_t hash = static_cast<size_t>(kind);
-
-  hash = hash_children(hash, children.size(), children.data());
-  if (!indices.empty())
-  {
-    hash = hash_indices(hash, indices.size(), indices.data());
-  }
-
-  return hash;
-}
+/* --- NodeUniqueTable private ---------------------------------------------- */
 
-bool
-NodeUniqueTable::equals(const NodeData& data,
-                        Kind kind,
-                        const Type& type,
-                        const std::vector<Node>& children,
-                        const std::vector<uint64_t>& indices) const
+void
+NodeUniqueTable::resize()
 {
-  assert(kind != Kind::VALUE);
-
-  if (data.d_kind != kind)
-  {
-    return false;
-  }
-
-  if (!children.empty())
-  {
-    assert(data.has_children());
-    const auto& payload = data.payload_children();
-
-    size_t num_children = payload.d_num_children;
-    if (num_children != children.size())
-    {
-      return false;
-    }
-
-    for (size_t i = 0; i < num_children; ++i)
-    {
-      if (payload.d_children[i] != children[i])
-      {
-        return false;
-      }
-    }
-
-    // Constant arrays are a special case since they require the type info.
-    if (kind == Kind::CONST_ARRAY)
-    {
-      assert(!data.get_type().is_null());
-      assert(!type.is_null());
-      return data.get_type() == type;
-    }
-  }
+  size_t new_size = d_buckets.capacity() * 2;
+  std::vector<NodeData*> buckets(new_size, nullptr);
 
-  if (!indices.empty())
+  // Rehash elements.
+  size_t mask = new_size - 1;
+  for (auto cur : d_buckets)
   {
-    assert(data.is_indexed());
-    const auto& payload = data.payload_indexed();
-
-    size_t num_indices = payload.d_num_indices;
-    if (num_indices != indices.size())
-    {
-      return false;
-    }
-
-    for (size_t i = 0; i < num_indices; ++i)
+    while (cur)
     {
-      if (payload.d_indices[i] != indices[i])
-      {
-        return false;
-      }
+      size_t h     = bucket_hash(hash(cur), mask);
+      auto next    = cur->d_next;
+      cur->d_next  = buckets[h];
+      buckets[h]   = cur;
+      cur          = next;
     }
   }
 
-  return true;
+  d_buckets = std::move(buckets);
 }
 
 }  // namespace bzla::node
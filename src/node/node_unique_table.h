@@ -17,30 +17,119 @@
 
 namespace bzla::node {
 
+/**
+ * Unique table for hash consing of node data.
+ *
+ * The table itself is not synchronized, thread-safe node managers guard each
+ * of their unique table shards with a mutex. In thread-safe mode, lookups
+ * acquire a reference to the node data they find while the lock is held and
+ * skip node data whose reference count dropped to zero, which is about to be
+ * garbage collected by another thread. This guarantees that node data is
+ * never revived during garbage collection, and that there is at most one
+ * referenced node data per node in the table.
+ */
 class NodeUniqueTable
 {
  public:
-  NodeUniqueTable();
+  /**
+   * Constructor.
+   * @param arena       The arena to allocate node data from.
+   * @param thread_safe True if the table belongs to a thread-safe node
+   *                    manager.
+   */
+  NodeUniqueTable(NodeDataArena& arena, bool thread_safe = false);
   ~NodeUniqueTable();
 
   /**
    * Find node with specified criteria. If node does not exist yet, allocates
    * new node data.
    */
-  std::pair<bool, NodeData*> find_or_insert(
-      Kind kind,
-      const Type& type,
-      const std::vector<Node>& children,
-      const std::vector<uint64_t>& indices);
+  std::pair<bool, NodeData*> find_or_insert(Kind kind,
+                                            const Type& type,
+                                            util::Span<Node> children,
+                                            util::Span<uint64_t> indices);
+
+  /**
+   * Compute hash value of node lookup data.
+   * @tparam T Node or ConstNodeRef.
+   */
+  template <class T>
+  static size_t hash(Kind kind,
+                     util::Span<T> children,
+                     util::Span<uint64_t> indices)
+  {
+    assert(!children.empty());
+    size_t hash = static_cast<size_t>(kind);
+    hash        = hash_children(hash, children.size(), children.data());
+    if (!indices.empty())
+    {
+      hash = hash_indices(hash, indices.size(), indices.data());
+    }
+    return hash;
+  }
+
+  /** Compute hash value of value node lookup data. */
+  template <class T>
+  static size_t hash_value(const T& value)
+  {
+    return static_cast<size_t>(Kind::VALUE) + std::hash<T>{}(value);
+  }
+
+  /** Compute hash value of node data, see hash() and hash_value(). */
+  static size_t hash(const NodeData* d);
+
+  /**
+   * Find node with specified criteria without allocating new node data.
+   * @tparam T Node or ConstNodeRef, which allows to look up nodes without
+   *           copying the children.
+   * @param hash The hash value of the lookup data, see hash().
+   * @return The node data, nullptr if the node does not exist. In thread-safe
+   *         mode, a reference to the node data is acquired.
+   */
+  template <class T>
+  NodeData* find(Kind kind,
+                 const Type& type,
+                 util::Span<T> children,
+                 util::Span<uint64_t> indices,
+                 size_t hash) const
+  {
+    assert(kind != Kind::VALUE);
+    NodeData* cur = d_buckets[bucket_hash(hash)];
+    while (cur)
+    {
+      if (equals(*cur, kind, type, children, indices) && acquire(cur))
+      {
+        return cur;
+      }
+      cur = cur->d_next;
+    }
+    return nullptr;
+  }
+
+  /**
+   * Allocate and insert new node data, which must not exist yet.
+   * @param hash The hash value of the lookup data, see hash().
+   * @return The new node data.
+   */
+  NodeData* insert(Kind kind,
+                   util::Span<Node> children,
+                   util::Span<uint64_t> indices,
+                   size_t hash);
 
   /**
    * Find value with specified criteria. If node does not exist yet, allocates
    * new node data.
+   * @param hd The hash value of the value, see hash_value().
+   * @return A pair of a flag that indicates whether the node data was
+   *         inserted, and the node data. In thread-safe mode, a reference to
+   *         found node data is acquired.
    */
   template <class T>
-  std::pair<bool, NodeData*> find_or_insert(const Type& type, const T& value)
+  std::pair<bool, NodeData*> find_or_insert(const Type& type,
+                                            const T& value,
+                                            size_t hd)
   {
-    size_t hd     = hash_value(value);
+    assert(hd == hash_value(value));
     size_t h      = bucket_hash(hd);
     NodeData* cur = d_buckets[h];
 
@@ -50,7 +139,7 @@ class NodeUniqueTable
       if (cur->d_kind == Kind::VALUE && cur->get_type() == type)
       {
         const auto& payload = cur->payload_value<T>();
-        if (payload.d_value == value)
+        if (payload.d_value == value && acquire(cur))
         {
           return std::make_pair(false, cur);
         }
@@ -59,7 +148,7 @@ class NodeUniqueTable
     }
 
     // Create new node and insert
-    NodeData* d = NodeData::alloc(value);
+    NodeData* d = NodeData::alloc(d_arena, value);
     if (needs_resize())
     {
       resize();
@@ -86,20 +175,77 @@ class NodeUniqueTable
   /** Resizes unique table and rehashes node data. */
   void resize();
 
-  /** Hash node data. */
-  size_t hash(const NodeData* d) const;
-
-  /** Compute hash value of node lookup data. */
-  size_t hash(Kind kind,
-              const std::vector<Node>& children,
-              const std::vector<uint64_t>& indices) const;
+  /**
+   * Acquire a reference to found node data in thread-safe mode.
+   * @return False if the node data is being garbage collected.
+   */
+  bool acquire(NodeData* d) const { return !d_thread_safe || d->try_inc_ref(); }
 
   /** Compare node data against node lookup data. */
+  template <class T>
   bool equals(const NodeData& data,
               Kind kind,
               const Type& type,
-              const std::vector<Node>& children,
-              const std::vector<uint64_t>& indices) const;
+              util::Span<T> children,
+              util::Span<uint64_t> indices) const
+  {
+    assert(kind != Kind::VALUE);
+
+    if (data.d_kind != kind)
+    {
+      return false;
+    }
+
+    if (!children.empty())
+    {
+      assert(data.has_children());
+      const auto& payload = data.payload_children();
+
+      size_t num_children = payload.d_num_children;
+      if (num_children != children.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < num_children; ++i)
+      {
+        if (payload.d_children[i] != static_cast<const Node&>(children[i]))
+        {
+          return false;
+        }
+      }
+
+      // Constant arrays are a special case since they require the type info.
+      if (kind == Kind::CONST_ARRAY)
+      {
+        assert(!data.get_type().is_null());
+        assert(!type.is_null());
+        return data.get_type() == type;
+      }
+    }
+
+    if (!indices.empty())
+    {
+      assert(data.is_indexed());
+      const auto& payload = data.payload_indexed();
+
+      size_t num_indices = payload.d_num_indices;
+      if (num_indices != indices.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0; i < num_indices; ++i)
+      {
+        if (payload.d_indices[i] != indices[i])
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
 
   /** Compute position in d_buckets based on hash value. */
   size_t bucket_hash(size_t hash, size_t mask = 0) const
@@ -111,27 +257,20 @@ class NodeUniqueTable
     return hash & mask;
   }
 
-  /** Compute has value of value node lookup data. */
   template <class T>
-  size_t hash_value(const T& value)
-  {
-    return static_cast<size_t>(Kind::VALUE) + std::hash<T>{}(value);
-  }
-
-  inline size_t hash_children(size_t hash,
-                              size_t size,
-                              const Node* children) const
+  static size_t hash_children(size_t hash, size_t size, const T* children)
   {
     for (size_t i = 0; i < size; ++i)
     {
-      hash += s_primes[i % s_primes.size()] * children[i].id();
+      const Node& child = children[i];
+      hash += s_primes[i % s_primes.size()] * child.id();
     }
     return hash;
   }
 
-  inline size_t hash_indices(size_t hash,
+  static size_t hash_indices(size_t hash,
                              size_t size,
-                             const uint64_t* indices) const
+                             const uint64_t* indices)
   {
     for (size_t i = 0; i < size; ++i)
     {
@@ -140,6 +279,10 @@ class NodeUniqueTable
     return hash;
   }
 
+  /** The arena to allocate node data from. */
+  NodeDataArena& d_arena;
+  /** True if the table belongs to a thread-safe node manager. */
+  bool d_thread_safe;
   /** Number of nodes stored in unique table. */
   size_t d_num_elements = 0;
   /** Hash table buckets. */
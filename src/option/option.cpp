@@ -164,8 +164,8 @@ Options::Options()
           1,
           1,
           UINT64_MAX,
-          "set number of threads to utilize in parallel (currently, this only "
-          "configures parallel threads in the CryptoMiniSat back end)",
+          "set number of threads to utilize in parallel (values > 1 enable "
+          "the parallel portfolio mode)",
           "nthreads",
           "j"),
       relevant_terms(this,
@@ -200,6 +200,56 @@ Options::Options()
                     "rewrite level",
                     "rewrite-level",
                     "rwl"),
+      rewrite_cache_limit(this,
+                          Option::REWRITE_CACHE_LIMIT,
+                          256,
+                          0,
+                          UINT64_MAX,
+                          "memory limit in MB for the rewriter cache (0 for "
+                          "no limit)",
+                          "rewrite-cache-limit"),
+      lemmas_in_search(this,
+                       Option::LEMMAS_IN_SEARCH,
+                       false,
+                       "check theory lemmas on partial and complete "
+                       "assignments during SAT search (requires CaDiCaL)",
+                       "lemmas-in-search"),
+      cube_depth(this,
+                 Option::CUBE_DEPTH,
+                 0,
+                 0,
+                 16,
+                 "number of splitting variables for cube-and-conquer in the "
+                 "bit-blasting solver (0 disables cube-and-conquer, cubes are "
+                 "solved with nthreads threads)",
+                 "cube-depth"),
+      shared_bitblast_cache(this,
+                            Option::SHARED_BITBLAST_CACHE,
+                            false,
+                            "share bit-blasted terms between solver instances "
+                            "that use the same term manager",
+                            "shared-bitblast-cache"),
+      fraig(this,
+            Option::FRAIG,
+            false,
+            "merge equivalent AIG nodes via simulation and SAT sweeping "
+            "before CNF encoding",
+            "fraig"),
+      scoped_bitblast(this,
+                      Option::SCOPED_BITBLAST,
+                      false,
+                      "release bit-blasted terms and disable their CNF "
+                      "encoding when popping the scope they were bit-blasted "
+                      "in",
+                      "scoped-bitblast"),
+      mbqi_nthreads(this,
+                    Option::MBQI_NTHREADS,
+                    1,
+                    1,
+                    64,
+                    "number of threads used for checking the MBQI instances "
+                    "of quantifiers in parallel",
+                    "mbqi-nthreads"),
       // BV: propagation-based local search engine
       prop_nprops(this,
                   Option::PROP_NPROPS,
@@ -209,6 +259,15 @@ Options::Options()
                   "number of propagation steps used as a limit for "
                   "propagation-based local search engine",
                   "prop-nprops"),
+      prop_nthreads(this,
+                    Option::PROP_NTHREADS,
+                    1,
+                    1,
+                    64,
+                    "number of differently configured local search workers "
+                    "run in parallel by the propagation-based local search "
+                    "engine",
+                    "prop-nthreads"),
       prop_nupdates(this,
                     Option::PROP_NUPDATES,
                     0,
@@ -736,8 +795,16 @@ Options::data(Option opt)
 
     case Option::BV_SOLVER: return &bv_solver;
     case Option::REWRITE_LEVEL: return &rewrite_level;
+    case Option::REWRITE_CACHE_LIMIT: return &rewrite_cache_limit;
+    case Option::LEMMAS_IN_SEARCH: return &lemmas_in_search;
+    case Option::CUBE_DEPTH: return &cube_depth;
+    case Option::SHARED_BITBLAST_CACHE: return &shared_bitblast_cache;
+    case Option::FRAIG: return &fraig;
+    case Option::SCOPED_BITBLAST: return &scoped_bitblast;
+    case Option::MBQI_NTHREADS: return &mbqi_nthreads;
 
     case Option::PROP_NPROPS: return &prop_nprops;
+    case Option::PROP_NTHREADS: return &prop_nthreads;
     case Option::PROP_NUPDATES: return &prop_nupdates;
     case Option::PROP_PATH_SEL: return &prop_path_sel;
     case Option::PROP_PROB_PICK_INV_VALUE: return &prop_prob_pick_inv_value;
@@ -33,11 +33,19 @@ enum class Option
   NTHREADS,                   // numeric
   RELEVANT_TERMS,             // bool
 
-  BV_SOLVER,      // enum
-  REWRITE_LEVEL,  // numeric
-  SAT_SOLVER,     // enum
+  BV_SOLVER,              // enum
+  REWRITE_LEVEL,          // numeric
+  REWRITE_CACHE_LIMIT,    // numeric
+  SAT_SOLVER,             // enum
+  LEMMAS_IN_SEARCH,       // bool
+  CUBE_DEPTH,             // numeric
+  SHARED_BITBLAST_CACHE,  // bool
+  FRAIG,                  // bool
+  SCOPED_BITBLAST,        // bool
+  MBQI_NTHREADS,          // numeric
 
   PROP_NPROPS,                  // numeric
+  PROP_NTHREADS,                // numeric
   PROP_NUPDATES,                // numeric
   PROP_PATH_SEL,                // enum
   PROP_PROB_PICK_INV_VALUE,     // numeric
@@ -167,6 +175,8 @@ class OptionBase
   const char* lng() const { return d_long; }
   /** @return The short name of this option. */
   const char* shrt() const { return d_short; }
+  /** @return True if this option was configured from outside. */
+  bool is_user_set() const { return d_is_user_set; }
 
  protected:
   /** The option description. */
@@ -418,6 +428,17 @@ class OptionModeT : public OptionMode
   }
   OptionModeT() = delete;
 
+  /**
+   * Set the current mode of an option with modes.
+   * @param value       The current mode.
+   * @param is_user_set True if this option was configured from outside.
+   */
+  void set(T value, bool is_user_set = false)
+  {
+    d_value       = value;
+    d_is_user_set = is_user_set;
+  }
+
   const T& operator()() const { return d_value; }
 
   /** @return The default value of this option. */
@@ -479,9 +500,17 @@ class Options
   OptionModeT<BvSolver> bv_solver;
   OptionModeT<SatSolver> sat_solver;
   OptionNumeric rewrite_level;
+  OptionNumeric rewrite_cache_limit;
+  OptionBool lemmas_in_search;
+  OptionNumeric cube_depth;
+  OptionBool shared_bitblast_cache;
+  OptionBool fraig;
+  OptionBool scoped_bitblast;
+  OptionNumeric mbqi_nthreads;
 
   // BV: propagation-based local search engine
   OptionNumeric prop_nprops;
+  OptionNumeric prop_nthreads;
   OptionNumeric prop_nupdates;
   OptionModeT<PropPathSelection> prop_path_sel;
   OptionNumeric prop_prob_pick_inv_value;
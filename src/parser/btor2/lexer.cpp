@@ -23,7 +23,26 @@ void
 Lexer::init(std::istream* input)
 {
   assert(input);
-  d_input = input;
+  d_input           = input;
+  d_buffer.resize(s_buf_size);
+  d_data            = d_buffer.data();
+  d_size            = 0;
+  d_pos             = 0;
+  d_coo             = {1, 1};
+  d_cur_coo         = {1, 1};
+  d_last_coo        = {1, 1};
+  d_last_coo_nl_col = 1;
+  d_saved           = false;
+  d_saved_char      = 0;
+}
+
+void
+Lexer::init(const char* data, size_t size)
+{
+  d_input           = nullptr;
+  d_data            = data;
+  d_size            = size;
+  d_pos             = 0;
   d_coo             = {1, 1};
   d_cur_coo         = {1, 1};
   d_last_coo        = {1, 1};
@@ -55,11 +74,26 @@ Lexer::error_msg() const
 
 /* Lexer private ------------------------------------------------------------ */
 
+bool
+Lexer::fill_buffer()
+{
+  if (d_input == nullptr)
+  {
+    return false;
+  }
+  d_input->read(d_buffer.data(), s_buf_size);
+  d_data = d_buffer.data();
+  d_size = d_input->gcount();
+  d_pos  = 0;
+  return d_size > 0;
+}
+
 Token
 Lexer::next_token_aux(Token expected)
 {
   int32_t ch;
   d_token.clear();
+  d_token_size = 0;
 
   // skip leading whitespaces and comments
   do
@@ -67,7 +101,7 @@ Lexer::next_token_aux(Token expected)
     d_coo = d_cur_coo;
     if ((ch = next_char()) == EOF)
     {
-      d_token.push_back(0);
+      end_token();
       return Token::ENDOFFILE;
     }
     if (ch == ';')
@@ -76,7 +110,7 @@ Lexer::next_token_aux(Token expected)
       {
         if (ch == EOF)
         {
-          d_token.push_back(0);
+          end_token();
           return error(ch, "unexpected end of file in comment");
         }
       }
@@ -91,11 +125,11 @@ Lexer::next_token_aux(Token expected)
       ch = next_char();
     }
     save_char(ch);
-    if (d_token.empty())
+    if (d_token_size == 0)
     {
       return error(ch, "expected binary number");
     }
-    d_token.push_back(0);
+    end_token();
     return expected;
   }
   else if (expected == Token::NUMBER_DEC)
@@ -106,11 +140,11 @@ Lexer::next_token_aux(Token expected)
       ch = next_char();
     }
     save_char(ch);
-    if (d_token.empty())
+    if (d_token_size == 0)
     {
       return error(ch, "expected decimal number");
     }
-    d_token.push_back(0);
+    end_token();
     return expected;
   }
   else if (expected == Token::NUMBER_HEX)
@@ -121,11 +155,11 @@ Lexer::next_token_aux(Token expected)
       ch = next_char();
     }
     save_char(ch);
-    if (d_token.empty())
+    if (d_token_size == 0)
     {
       return error(ch, "expected hex number");
     }
-    d_token.push_back(0);
+    end_token();
     return expected;
   }
   else if (is_char_class(ch, CharacterClass::SYMBOL))
@@ -141,15 +175,15 @@ Lexer::next_token_aux(Token expected)
       push_char(ch);
     }
     save_char(ch);
-    d_token.push_back(0);
-    auto it = d_str2token.find(d_token.data());
+    end_token();
+    auto it = d_str2token.find(std::string(token_view()));
     if (it != d_str2token.end())
     {
       return it->second;
     }
     return Token::SYMBOL;
   }
-  d_token.push_back(0);
+  end_token();
   if (is_printable(ch))
   {
     return error(ch, "illegal " + err_char(ch));
@@ -14,6 +14,7 @@
 #include <array>
 #include <cassert>
 #include <cstring>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -42,6 +43,14 @@ class Lexer
    * @param input The input stream.
    */
   void init(std::istream* input);
+  /**
+   * Initialize lexer to read from given character data (e.g., a memory-mapped
+   * input file). The data is read in place and must remain valid until the
+   * lexer is reinitialized.
+   * @param data The input data.
+   * @param size The size of the input data.
+   */
+  void init(const char* data, size_t size);
   /** @return The next token. */
   Token next_token(Token expected = Token::SYMBOL);
   /**
@@ -49,14 +58,37 @@ class Lexer
    *         representation (e.g., symbols, attributes, binary values, etc.).
    *         This string representation can then be queried via token().
    */
-  bool has_token() const { return !d_token.empty(); }
+  bool has_token() const { return d_token_size > 0; }
   /**
    * Get a string representation of the last parsed token. Empty if
    * !has_token(), i.e., if token has a unique string representation (e.g.,
    * left/right parenthesis, underscore, etc.).
+   *
+   * @note Tokens of in-memory data are copied on the first call, use
+   *       token_view() to avoid the copy.
+   * @return The 0-terminated string representation of the token.
+   */
+  const char* token() const
+  {
+    if (d_input == nullptr && d_token.empty())
+    {
+      d_token.assign(d_data + d_token_begin,
+                     d_data + d_token_begin + d_token_size);
+      d_token.push_back(0);
+    }
+    return d_token.data();
+  }
+  /**
+   * Get a view of the string representation of the last parsed token, see
+   * token(). For in-memory data, this is a view into the data.
    * @return The string representation of the token.
    */
-  const char* token() const { return d_token.data(); }
+  std::string_view token_view() const
+  {
+    return std::string_view(
+        d_input == nullptr ? d_data + d_token_begin : d_token.data(),
+        d_token_size);
+  }
   /** @return True if lexer encountered an error. */
   bool error() const;
   /** @return The error message, empty if !error(). */
@@ -122,7 +154,7 @@ class Lexer
       {"nego", Token::NEGO},       {"next", Token::NEXT},
       {"nor", Token::NOR},         {"not", Token::NOT},
       {"one", Token::ONE},         {"ones", Token::ONES},
-      {"or", Token::OR},           {"outpu", Token::OUTPUT},
+      {"or", Token::OR},           {"output", Token::OUTPUT},
       {"read", Token::READ},       {"redand", Token::REDAND},
       {"redor", Token::REDOR},     {"redxor", Token::REDXOR},
       {"rol", Token::ROL},         {"ror", Token::ROR},
@@ -184,9 +216,13 @@ class Lexer
       res     = d_saved_char;
       d_saved = false;
     }
+    else if (d_pos < d_size || fill_buffer())
+    {
+      res = static_cast<unsigned char>(d_data[d_pos++]);
+    }
     else
     {
-      res = d_input->get();
+      res = EOF;
     }
     if (res == '\n')
     {
@@ -203,6 +239,12 @@ class Lexer
     return res;
   }
 
+  /**
+   * Read the next chunk of the input stream into the read buffer.
+   * @return False if no more characters are available.
+   */
+  bool fill_buffer();
+
   /**
    * Push given character onto the token stack.
    * @note implemented here for inlining
@@ -211,7 +253,35 @@ class Lexer
   {
     assert(ch != EOF);
     assert(ch >= 0 && ch < 256);
-    d_token.push_back(static_cast<char>(ch));
+    if (d_input == nullptr)
+    {
+      // Tokens are contiguous in the data and referenced in place, the last
+      // character read is at d_pos - 1.
+      if (d_token_size == 0)
+      {
+        d_token_begin = d_pos - 1;
+      }
+      assert(d_data[d_token_begin + d_token_size] == static_cast<char>(ch));
+    }
+    else
+    {
+      d_token.push_back(static_cast<char>(ch));
+    }
+    d_token_size += 1;
+  }
+
+  /**
+   * Terminate the current token. Tokens read from an input stream are
+   * 0-terminated in d_token, tokens of in-memory data are only copied to
+   * d_token on demand (see token()).
+   * @note implemented here for inlining
+   */
+  void end_token()
+  {
+    if (d_input != nullptr)
+    {
+      d_token.push_back(0);
+    }
   }
 
   /**
@@ -260,8 +330,19 @@ class Lexer
    */
   Token error(int32_t ch, const std::string& error_msg);
 
-  /** The input stream. */
+  /** The size of the chunks read from the input stream into d_buffer. */
+  static constexpr size_t s_buf_size = 1 << 16;
+
+  /** The input stream, nullptr if reading from in-memory data. */
   std::istream* d_input = nullptr;
+  /** The read buffer, unused when reading from in-memory data. */
+  std::vector<char> d_buffer;
+  /** The data currently read from, either d_buffer or in-memory input. */
+  const char* d_data = nullptr;
+  /** The size of d_data. */
+  size_t d_size = 0;
+  /** The index of the next character to be read from d_data. */
+  size_t d_pos = 0;
   /** The character classes. */
   std::array<uint8_t, 256> d_char_classes{};  // value-initialized to 0
   /** The coordinate of the current token. */
@@ -274,9 +355,14 @@ class Lexer
   uint64_t d_last_coo_nl_col = 1;
   /**
    * The string representation of the current token (if not a token with unique
-   * representation, e.g., (, ), _, ...).
+   * representation, e.g., (, ), _, ...). Filled on demand by token() when
+   * reading from in-memory data.
    */
-  std::vector<char> d_token;
+  mutable std::vector<char> d_token;
+  /** The index of the first character of the current token in d_data. */
+  size_t d_token_begin = 0;
+  /** The number of characters of the current token. */
+  size_t d_token_size = 0;
   /** True if we have a saved character that has not been consumed yet. */
   bool d_saved = false;
   /** The saved character. */
@@ -10,7 +10,10 @@
 
 #include "parser/btor2/parser.h"
 
+#include <charconv>
+
 #include "bv/bitvector.h"
+#include "util/mapped_file.h"
 
 namespace bzla {
 namespace parser::btor2 {
@@ -48,11 +51,19 @@ Parser::parse(const std::string& input, bool parse_only, bool parse_file)
   std::istream* instream = &std::cin;
   std::ifstream infile;
   std::stringstream instring;
+  util::MappedFile mapped;
 
   if (parse_file)
   {
     if (input != "<stdin>")
     {
+      if (mapped.open(input))
+      {
+        // Lex regular files in place, without copying them into a read
+        // buffer.
+        d_lexer->init(mapped.data(), mapped.size());
+        return parse_input(input, parse_only);
+      }
       infile.open(input, std::ifstream::in);
       if (!infile)
       {
@@ -80,6 +91,13 @@ bool
 Parser::parse(const std::string& infile_name,
               std::istream& input,
               bool parse_only)
+{
+  d_lexer->init(&input);
+  return parse_input(infile_name, parse_only);
+}
+
+bool
+Parser::parse_input(const std::string& infile_name, bool parse_only)
 {
   d_parse_only = parse_only;
 
@@ -87,7 +105,6 @@ Parser::parse(const std::string& infile_name,
   Log(2) << "parse " << d_infile_name;
 
   d_infile_name = infile_name;
-  d_lexer->init(&input);
 
   if (!d_error.empty())
   {
@@ -105,6 +122,10 @@ Parser::parse(const std::string& infile_name,
   {
     if (!d_parse_only)
     {
+      if (!d_states.empty() || !d_justice_properties.empty())
+      {
+        return bmc();
+      }
       if (d_bad_properties.empty())
       {
         // If no safety properties checked, do one check-sat call.
@@ -218,50 +239,361 @@ Parser::print_model()
   std::stringstream ss;
   for (const auto& [id, input] : d_inputs)
   {
-    auto value  = d_bitwuzla->get_value(input);
     auto symbol = input.symbol();
-    if (input.sort().is_bv())
+    print_value(ss, id, input, symbol ? symbol->get() : "");
+  }
+  (*d_out) << ss.str();
+  d_out->flush();
+  return true;
+}
+
+void
+Parser::print_value(std::stringstream& ss,
+                    int64_t id,
+                    const bitwuzla::Term& term,
+                    const std::string& symbol,
+                    bool witness)
+{
+  auto value = d_bitwuzla->get_value(term);
+  if (term.sort().is_bv())
+  {
+    ss << id << " " << value.value<std::string>(2);
+    if (!symbol.empty())
     {
-      ss << id << " " << value.value<std::string>(2);
-      if (symbol)
+      ss << " " << symbol;
+    }
+    ss << std::endl;
+  }
+  else if (term.sort().is_array())
+  {
+    bitwuzla::Term cur = value;
+    while (cur.kind() == bitwuzla::Kind::ARRAY_STORE)
+    {
+      auto index   = d_bitwuzla->get_value(cur[1]);
+      auto element = d_bitwuzla->get_value(cur[2]);
+      ss << id << (witness ? " [" : "[") << index.value<std::string>(2)
+         << "]";
+      ss << " " << element.value<std::string>(2);
+      cur = cur[0];
+      if (!symbol.empty())
       {
-        ss << " " << symbol->get();
+        ss << " " << symbol;
       }
       ss << std::endl;
     }
-    else if (input.sort().is_array())
+    if (cur.kind() == bitwuzla::Kind::CONST_ARRAY && !witness)
+    {
+      ss << id << "[*]";
+      ss << " " << cur[0].value<std::string>(2);
+      if (!symbol.empty())
+      {
+        ss << " " << symbol;
+      }
+      ss << std::endl;
+    }
+  }
+}
+
+bool
+Parser::print_witness(uint64_t bound, char kind, size_t index)
+{
+  if (!d_options.get(bitwuzla::Option::PRODUCE_MODELS))
+  {
+    d_error = "model generation is not enabled";
+    return false;
+  }
+
+  std::stringstream ss;
+  ss << "sat" << std::endl;
+  ss << kind << index << std::endl;
+  ss << "#0" << std::endl;
+  for (size_t i = 0, n = d_states.size(); i < n; ++i)
+  {
+    const bitwuzla::Term& state = d_states[i].d_state;
+    auto symbol                 = state.symbol();
+    print_value(ss, i, state, symbol ? symbol->get() + "#0" : "", true);
+  }
+  for (uint64_t k = 0; k <= bound; ++k)
+  {
+    ss << "@" << k << std::endl;
+    for (size_t i = 0, n = d_inputs.size(); i < n; ++i)
+    {
+      const bitwuzla::Term& input = d_inputs[i].second;
+      auto symbol                 = input.symbol();
+      print_value(ss,
+                  i,
+                  instantiate(input, k),
+                  symbol ? symbol->get() + "@" + std::to_string(k) : "",
+                  true);
+    }
+  }
+  ss << "." << std::endl;
+  (*d_out) << ss.str();
+  d_out->flush();
+  return true;
+}
+
+void
+Parser::print_bmc_result(const std::string& kind,
+                         int64_t id,
+                         const std::string& symbol,
+                         const std::string& result)
+{
+  if (d_auto_print_model)
+  {
+    (*d_out) << "; ";
+  }
+  (*d_out) << kind << " property " << id;
+  if (!symbol.empty())
+  {
+    (*d_out) << " (" << symbol << ")";
+  }
+  (*d_out) << " " << result << "." << std::endl;
+}
+
+bool
+Parser::bmc()
+{
+  std::vector<bool> bad_done(d_bad_properties.size(), false);
+  std::vector<bool> justice_done(d_justice_properties.size(), false);
+  size_t num_open = bad_done.size() + justice_done.size();
+  // True if checking bound k was not completed due to the terminator or a
+  // resource limit.
+  bool unknown = false;
+
+  uint64_t k = 0;
+  for (;; ++k)
+  {
+    Msg(1) << "bmc: checking bound " << k;
+    unroll(k);
+
+    for (size_t i = 0, n = d_bad_properties.size(); !unknown && i < n; ++i)
     {
-      bitwuzla::Term cur = value;
-      while (cur.kind() == bitwuzla::Kind::ARRAY_STORE)
-      {
-        auto index   = d_bitwuzla->get_value(cur[1]);
-        auto element = d_bitwuzla->get_value(cur[2]);
-        ss << id << "[" << index.value<std::string>(2) << "]";
-        ss << " " << element.value<std::string>(2);
-        cur = cur[0];
-        if (symbol)
+      if (bad_done[i])
+      {
+        continue;
+      }
+      const auto& [bad, id, symbol] = d_bad_properties[i];
+      bitwuzla::Result res = d_bitwuzla->check_sat({instantiate(bad, k)});
+      if (res == bitwuzla::Result::UNKNOWN)
+      {
+        unknown = true;
+      }
+      else if (res == bitwuzla::Result::SAT)
+      {
+        bad_done[i] = true;
+        --num_open;
+        if (d_auto_print_model)
         {
-          ss << " " << symbol->get();
+          if (!print_witness(k, 'b', i))
+          {
+            return false;
+          }
+        }
+        else
+        {
+          print_bmc_result(
+              "Bad", id, symbol, "satisfiable at bound " + std::to_string(k));
         }
-        ss << std::endl;
       }
-      if (cur.kind() == bitwuzla::Kind::CONST_ARRAY)
+    }
+
+    // A lasso requires at least one transition.
+    for (size_t i = 0, n = d_justice_properties.size();
+         !unknown && k > 0 && i < n;
+         ++i)
+    {
+      if (justice_done[i])
+      {
+        continue;
+      }
+      const Justice& justice = d_justice_properties[i];
+      d_bitwuzla->push(1);
+      d_bitwuzla->assert_formula(mk_lasso(justice, k));
+      bitwuzla::Result res = d_bitwuzla->check_sat();
+      if (res == bitwuzla::Result::UNKNOWN)
       {
-        ss << id << "[*]";
-        ss << " " << cur[0].value<std::string>(2);
-        if (symbol)
+        unknown = true;
+      }
+      else if (res == bitwuzla::Result::SAT)
+      {
+        justice_done[i] = true;
+        --num_open;
+        if (d_auto_print_model)
+        {
+          if (!print_witness(k, 'j', i))
+          {
+            d_bitwuzla->pop(1);
+            return false;
+          }
+        }
+        else
         {
-          ss << " " << symbol->get();
+          print_bmc_result("Justice",
+                           justice.d_id,
+                           justice.d_symbol,
+                           "satisfiable at bound " + std::to_string(k));
         }
-        ss << std::endl;
       }
+      d_bitwuzla->pop(1);
+    }
+
+    if (num_open == 0 || k == d_bmc_bound || unknown)
+    {
+      break;
+    }
+    if (terminate())
+    {
+      // Bound k was completed, the next bound is not checked.
+      unknown = true;
+      ++k;
+      break;
     }
   }
-  (*d_out) << ss.str();
-  d_out->flush();
+
+  // Properties are only known to be unsatisfiable up to a bound if all
+  // checks up to this bound were completed.
+  std::string result = unknown
+                           ? "unknown at bound " + std::to_string(k)
+                           : "unsatisfiable up to bound " + std::to_string(k);
+  for (size_t i = 0, n = d_bad_properties.size(); i < n; ++i)
+  {
+    if (!bad_done[i])
+    {
+      const auto& [bad, id, symbol] = d_bad_properties[i];
+      print_bmc_result("Bad", id, symbol, result);
+    }
+  }
+  for (size_t i = 0, n = d_justice_properties.size(); i < n; ++i)
+  {
+    if (!justice_done[i])
+    {
+      const Justice& justice = d_justice_properties[i];
+      print_bmc_result("Justice", justice.d_id, justice.d_symbol, result);
+    }
+  }
+  d_bad_properties.clear();
+  d_justice_properties.clear();
   return true;
 }
 
+void
+Parser::unroll(uint64_t bound)
+{
+  assert(bound == d_frames.size());
+  auto& frame = d_frames.emplace_back();
+
+  if (bound == 0)
+  {
+    // States and inputs at bound 0 are represented by their original terms.
+    // Constraints were already asserted while parsing.
+    for (const State& state : d_states)
+    {
+      if (!state.d_init.is_null())
+      {
+        d_bitwuzla->assert_formula(d_tm.mk_term(bitwuzla::Kind::EQUAL,
+                                                {state.d_state, state.d_init}));
+      }
+    }
+    return;
+  }
+
+  std::string suffix = "@" + std::to_string(bound);
+  for (const State& state : d_states)
+  {
+    auto symbol = state.d_state.symbol();
+    frame.emplace(state.d_state,
+                  symbol ? d_tm.mk_const(state.d_state.sort(),
+                                         symbol->get() + suffix)
+                         : d_tm.mk_const(state.d_state.sort()));
+  }
+  for (const auto& [id, input] : d_inputs)
+  {
+    auto symbol = input.symbol();
+    frame.emplace(input,
+                  symbol ? d_tm.mk_const(input.sort(), symbol->get() + suffix)
+                         : d_tm.mk_const(input.sort()));
+  }
+
+  for (const State& state : d_states)
+  {
+    if (!state.d_next.is_null())
+    {
+      d_bitwuzla->assert_formula(
+          d_tm.mk_term(bitwuzla::Kind::EQUAL,
+                       {frame.at(state.d_state),
+                        instantiate(state.d_next, bound - 1)}));
+    }
+  }
+  for (const bitwuzla::Term& constraint : d_constraints)
+  {
+    d_bitwuzla->assert_formula(instantiate(constraint, bound));
+  }
+}
+
+bitwuzla::Term
+Parser::instantiate(const bitwuzla::Term& term, uint64_t bound)
+{
+  assert(bound < d_frames.size());
+  if (bound == 0)
+  {
+    return term;
+  }
+  return d_tm.substitute_term(term, d_frames[bound]);
+}
+
+bitwuzla::Term
+Parser::mk_lasso(const Justice& justice, uint64_t bound)
+{
+  assert(bound > 0);
+  // For some l < bound, the state at `bound` equals the state at l and each
+  // justice condition and fairness constraint holds at least once within the
+  // loop from l to bound - 1.
+  std::vector<bitwuzla::Term> conds = justice.d_conditions;
+  conds.insert(conds.end(),
+               d_fairness_constraints.begin(),
+               d_fairness_constraints.end());
+
+  std::vector<bitwuzla::Term> loops;
+  for (uint64_t l = 0; l < bound; ++l)
+  {
+    std::vector<bitwuzla::Term> conj;
+    for (const State& state : d_states)
+    {
+      conj.push_back(
+          d_tm.mk_term(bitwuzla::Kind::EQUAL,
+                       {instantiate(state.d_state, bound),
+                        instantiate(state.d_state, l)}));
+    }
+    for (const bitwuzla::Term& cond : conds)
+    {
+      std::vector<bitwuzla::Term> disj;
+      for (uint64_t j = l; j < bound; ++j)
+      {
+        disj.push_back(instantiate(cond, j));
+      }
+      conj.push_back(mk_nary(bitwuzla::Kind::OR, disj));
+    }
+    loops.push_back(mk_nary(bitwuzla::Kind::AND, conj));
+  }
+  return mk_nary(bitwuzla::Kind::OR, loops);
+}
+
+bitwuzla::Term
+Parser::mk_nary(bitwuzla::Kind kind, const std::vector<bitwuzla::Term>& args)
+{
+  assert(kind == bitwuzla::Kind::AND || kind == bitwuzla::Kind::OR);
+  if (args.empty())
+  {
+    return kind == bitwuzla::Kind::AND ? d_tm.mk_true() : d_tm.mk_false();
+  }
+  if (args.size() == 1)
+  {
+    return args[0];
+  }
+  return d_tm.mk_term(kind, args);
+}
+
 std::vector<bitwuzla::Sort>
 Parser::get_declared_sorts() const
 {
@@ -366,14 +698,25 @@ Parser::parse_line(ParsedKind* pkind, int64_t* id)
     case Token::ONE:
     case Token::ONES:
     case Token::ZERO:
-    case Token::INPUT: break;
+    case Token::INIT:
+    case Token::NEXT:
+      if (pkind)
+      {
+        *pkind = ParsedKind::CONSTRAINT;
+      }
+      break;
+
+    case Token::INPUT:
+    case Token::STATE: break;
 
     case Token::CONSTRAINT:
       if (!parse_term(term))
       {
         return false;
       }
-      d_bitwuzla->assert_formula(bv1_term_to_bool(term));
+      term = bv1_term_to_bool(term);
+      d_bitwuzla->assert_formula(term);
+      d_constraints.push_back(term);
       if (pkind)
       {
         *pkind = ParsedKind::CONSTRAINT;
@@ -452,14 +795,75 @@ Parser::parse_line(ParsedKind* pkind, int64_t* id)
       return true;
     }
 
-    case Token::FAIR:
-    case Token::INIT:
-    case Token::JUSTICE:
-    case Token::NEXT:
+    case Token::FAIR: {
+      if (!parse_term(term))
+      {
+        return false;
+      }
+      term = bv1_term_to_bool(term);
+      if (!term.sort().is_bool())
+      {
+        return error("expected bit-vector term of size 1");
+      }
+      if (pkind)
+      {
+        *pkind = ParsedKind::CONSTRAINT;
+      }
+      d_fairness_constraints.push_back(term);
+      // Symbol not used
+      parse_opt_symbol();
+      return true;
+    }
+
+    case Token::JUSTICE: {
+      int64_t num = 0;
+      if (!parse_number(false, num))
+      {
+        return false;
+      }
+      if (num == 0)
+      {
+        return error("expected at least one justice condition");
+      }
+      Justice justice{line_id, {}, ""};
+      for (int64_t i = 0; i < num; ++i)
+      {
+        if (!parse_term(term))
+        {
+          return false;
+        }
+        term = bv1_term_to_bool(term);
+        if (!term.sort().is_bool())
+        {
+          return error("expected bit-vector term of size 1");
+        }
+        justice.d_conditions.push_back(term);
+      }
+      const char* symbol = parse_opt_symbol();
+      if (symbol)
+      {
+        justice.d_symbol = symbol;
+      }
+      if (pkind)
+      {
+        *pkind = ParsedKind::CONSTRAINT;
+      }
+      d_justice_properties.push_back(std::move(justice));
+      return true;
+    }
+
     case Token::OUTPUT:
-    case Token::STATE:
-      return error("unsupported operator '" + std::to_string(op)
-                   + "', model checking extensions not supported");
+      if (!parse_term(term))
+      {
+        return false;
+      }
+      if (pkind)
+      {
+        *pkind = ParsedKind::CONSTRAINT;
+      }
+      // Outputs are not relevant for checking properties, symbol not used
+      parse_opt_symbol();
+      return true;
 
     default:
       return error("expected operator, got '" + std::string(d_lexer->token())
@@ -505,7 +909,7 @@ Parser::parse_line(ParsedKind* pkind, int64_t* id)
       {
         return false;
       }
-      std::string val = d_lexer->token();
+      std::string val(d_lexer->token_view());
       if (!sort.is_bv())
       {
         return error("expected bit-vector sort", sort_coo);
@@ -535,6 +939,84 @@ Parser::parse_line(ParsedKind* pkind, int64_t* id)
     }
     break;
 
+    case Token::STATE: {
+      const char* symbol = parse_opt_symbol();
+      if (symbol)
+      {
+        term = d_tm.mk_const(sort, symbol);
+      }
+      else
+      {
+        term = d_tm.mk_const(sort);
+      }
+      d_state_ids.emplace(line_id, d_states.size());
+      d_states.emplace_back(line_id, term);
+    }
+    break;
+
+    case Token::INIT:
+    case Token::NEXT: {
+      int64_t state_id = 0;
+      if (!parse_number(false, state_id))
+      {
+        return false;
+      }
+      auto sit = d_state_ids.find(state_id);
+      if (sit == d_state_ids.end())
+      {
+        return error("expected state, got '" + std::to_string(state_id) + "'");
+      }
+      State& state = d_states[sit->second];
+      if (state.d_state.sort() != sort)
+      {
+        return error("state with id " + std::to_string(state_id)
+                         + " does not match sort '" + std::to_string(sort_id)
+                         + "'",
+                     sort_coo);
+      }
+      if (!parse_term(term))
+      {
+        return false;
+      }
+      if (sort.is_bv())
+      {
+        term = bool_term_to_bv1(term);
+      }
+      if (op == Token::INIT && sort.is_array() && term.sort().is_bv()
+          && term.sort() == sort.array_element())
+      {
+        // Arrays may be initialized with a constant element value.
+        term = d_tm.mk_const_array(sort, term);
+      }
+      if (term.sort() != sort)
+      {
+        return error("term with id " + std::to_string(line_id)
+                     + " does not match sort '" + std::to_string(sort_id)
+                     + "'");
+      }
+      if (op == Token::INIT)
+      {
+        if (!state.d_init.is_null())
+        {
+          return error("state with id " + std::to_string(state_id)
+                       + " already initialized");
+        }
+        state.d_init = term;
+      }
+      else
+      {
+        if (!state.d_next.is_null())
+        {
+          return error("next state function of state with id "
+                       + std::to_string(state_id) + " already defined");
+        }
+        state.d_next = term;
+      }
+      // Init and next do not define a term
+      term = bitwuzla::Term();
+    }
+    break;
+
     case Token::ONE:
       if (!sort.is_bv())
       {
@@ -869,22 +1351,18 @@ Parser::parse_number(bool sign, int64_t& res, bool look_ahead, Token la)
                  + "'");
   }
   assert(d_lexer->has_token());
-  try
+  std::string_view str = d_lexer->token_view();
+  if (std::from_chars(str.data(), str.data() + str.size(), res).ec
+      != std::errc())
   {
-    res = std::stoll(d_lexer->token());
-    if (!sign && res < 0)
-    {
-      return error("expected non-negative integer, got '"
-                   + std::string(d_lexer->token()) + "'");
-    }
-    return true;
+    return error("invalid 64 bit integer '" + std::string(str) + "'");
   }
-  catch (...)
+  if (!sign && res < 0)
   {
-    return error("invalid 64 bit integer '" + std::string(d_lexer->token())
+    return error("expected non-negative integer, got '" + std::string(str)
                  + "'");
   }
-  return error("expected 64 bit integer");
+  return true;
 }
 
 const char*
@@ -52,10 +52,125 @@ class Parser : public bzla::parser::Parser
     TERM,
   };
 
+  /** A state of a sequential model. */
+  struct State
+  {
+    State(int64_t id, const bitwuzla::Term& state) : d_id(id), d_state(state)
+    {
+    }
+    /** The line id of the state. */
+    int64_t d_id;
+    /** The state term, represents the state at bound 0. */
+    bitwuzla::Term d_state;
+    /** The initial value, null if uninitialized. */
+    bitwuzla::Term d_init;
+    /** The next state function, null if undefined. */
+    bitwuzla::Term d_next;
+  };
+
+  /** A justice property. */
+  struct Justice
+  {
+    /** The line id of the justice property. */
+    int64_t d_id;
+    /** The justice conditions, each must hold infinitely often. */
+    std::vector<bitwuzla::Term> d_conditions;
+    /** The symbol of the justice property. */
+    std::string d_symbol;
+  };
+
   bool print_model();
+  /**
+   * Helper to print the model value of given input or state.
+   * @param ss      The output stream.
+   * @param id      The line id of the input or state, or its index if
+   *                `witness` is true.
+   * @param term    The term to print the value for.
+   * @param symbol  The symbol to print, empty if none.
+   * @param witness True to print array values in BTOR2 witness format, which
+   *                does not support default values of arrays.
+   */
+  void print_value(std::stringstream& ss,
+                   int64_t id,
+                   const bitwuzla::Term& term,
+                   const std::string& symbol,
+                   bool witness = false);
+  /**
+   * Print witness for a property violated at given bound in BTOR2 witness
+   * format. States and inputs are identified by their index in the order of
+   * declaration.
+   * @param bound The bound.
+   * @param kind  The kind of the property, 'b' for bad state properties and
+   *              'j' for justice properties.
+   * @param index The index of the property in the order of declaration of
+   *              properties of its kind.
+   * @return False on error.
+   */
+  bool print_witness(uint64_t bound, char kind, size_t index);
+  /**
+   * Print result of bounded model checking for a property. If witnesses are
+   * printed, the result is printed as a comment in BTOR2 witness format.
+   * @param kind   The kind of the property, "Bad" or "Justice".
+   * @param id     The line id of the property.
+   * @param symbol The symbol of the property, empty if none.
+   * @param result The result.
+   */
+  void print_bmc_result(const std::string& kind,
+                        int64_t id,
+                        const std::string& symbol,
+                        const std::string& result);
+
+  /**
+   * Incremental bounded model checking of sequential models.
+   *
+   * The transition relation is unrolled on the Bitwuzla instance of the
+   * parser, one step per bound. Bad state properties are checked via
+   * assumptions, justice properties (lasso-shaped counterexamples) within a
+   * push/pop scope. Hence, terms and learned clauses of previous bounds are
+   * reused.
+   *
+   * @return False on error.
+   */
+  bool bmc();
+  /**
+   * Unroll transition relation for given bound.
+   * @param bound The bound to unroll.
+   */
+  void unroll(uint64_t bound);
+  /**
+   * Instantiate a term of the sequential model (in terms of states and inputs
+   * at bound 0) at given bound.
+   * @param term  The term to instantiate.
+   * @param bound The bound, must be already unrolled.
+   * @return The instantiated term.
+   */
+  bitwuzla::Term instantiate(const bitwuzla::Term& term, uint64_t bound);
+  /**
+   * Create term that encodes a lasso-shaped path of length `bound` that
+   * satisfies given justice property and all fairness constraints.
+   * @param justice The justice property.
+   * @param bound   The bound.
+   * @return The term encoding the lasso.
+   */
+  bitwuzla::Term mk_lasso(const Justice& justice, uint64_t bound);
+  /**
+   * Helper to create n-ary boolean term.
+   * @param kind The kind of the term, either AND or OR.
+   * @param args The arguments.
+   * @return The resulting term, the neutral element if `args` is empty.
+   */
+  bitwuzla::Term mk_nary(bitwuzla::Kind kind,
+                         const std::vector<bitwuzla::Term>& args);
 
   /** Reset parser for new parse call. */
   void reset();
+  /**
+   * Parse the input the lexer has been initialized with.
+   * @param infile_name The name of the input file.
+   * @param parse_only  True to only parse without executing check-sat calls.
+   * @return False on error.
+   */
+  bool parse_input(const std::string& infile_name, bool parse_only);
 
   /** Helper to convert boolean term to bit-vector term of size 1. */
   bitwuzla::Term bool_term_to_bv1(const bitwuzla::Term& term) const;
@@ -150,6 +265,23 @@ class Parser : public bzla::parser::Parser
   std::unordered_map<int64_t, bitwuzla::Term> d_term_map;
   std::vector<std::pair<int64_t, bitwuzla::Term>> d_inputs;
 
+  /** The states of a sequential model. */
+  std::vector<State> d_states;
+  /** Map line id of state to index in d_states. */
+  std::unordered_map<int64_t, size_t> d_state_ids;
+  /** The constraints, instantiated at each bound of a sequential model. */
+  std::vector<bitwuzla::Term> d_constraints;
+  /** The justice properties of a sequential model. */
+  std::vector<Justice> d_justice_properties;
+  /** The fairness constraints of a sequential model. */
+  std::vector<bitwuzla::Term> d_fairness_constraints;
+  /**
+   * Map states and inputs to their instances at a bound, indexed by bound.
+   * The map for bound 0 is empty since the state and input terms represent
+   * the states and inputs at bound 0.
+   */
+  std::vector<std::unordered_map<bitwuzla::Term, bitwuzla::Term>> d_frames;
+
   /** Term representing bit-vector one of size 1 (true). */
   bitwuzla::Term d_bv1_one;
   /** Term representing bit-vector one of size 1 (false). */
@@ -66,6 +66,14 @@ class Parser
    */
   void configure_auto_print_model(bool value) { d_auto_print_model = value; }
 
+  /**
+   * Configure the maximum bound for bounded model checking of sequential
+   * BTOR2 models.
+   * @note Ignored for SMT-LIB2 input.
+   * @param bound The maximum bound.
+   */
+  void configure_bmc_bound(uint64_t bound) { d_bmc_bound = bound; }
+
   /**
    * Parse input, either from a file or from a string.
    * @param input      The name of the input file if `parse_file` is true,
@@ -195,6 +203,9 @@ class Parser
    */
   bool d_auto_print_model = false;
 
+  /** The maximum bound for bounded model checking of BTOR2 input. */
+  uint64_t d_bmc_bound = 20;
+
   /** True if parser is done parsing. */
   bool d_done = false;
 
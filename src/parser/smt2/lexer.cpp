@@ -79,8 +79,24 @@ void
 Lexer::init(std::istream* input)
 {
   assert(input);
-  d_input = input;
-  d_buf_idx = d_buf_size;
+  d_input           = input;
+  d_data            = d_buffer.data();
+  d_size            = 0;
+  d_pos             = 0;
+  d_saved           = false;
+  d_coo             = {1, 1};
+  d_cur_coo         = {1, 1};
+  d_last_coo        = {1, 1};
+  d_last_coo_nl_col = 1;
+}
+
+void
+Lexer::init(const char* data, size_t size)
+{
+  d_input           = nullptr;
+  d_data            = data;
+  d_size            = size;
+  d_pos             = 0;
   d_saved           = false;
   d_coo             = {1, 1};
   d_cur_coo         = {1, 1};
@@ -92,8 +108,10 @@ void
 Lexer::configure_buffer(size_t buf_size)
 {
   d_buf_size = buf_size;
-  d_buf_idx  = d_buf_size;
-  d_buffer   = std::vector<signed char>(d_buf_size, 0);
+  d_buffer   = std::vector<char>(d_buf_size, 0);
+  d_data     = d_buffer.data();
+  d_size     = 0;
+  d_pos      = 0;
 }
 
 Token
@@ -147,11 +165,26 @@ Lexer::is_valid_quoted_symbol(const std::string& s)
 
 /* Lexer private ------------------------------------------------------------ */
 
+bool
+Lexer::fill_buffer()
+{
+  if (d_input == nullptr)
+  {
+    return false;
+  }
+  d_input->read(d_buffer.data(), d_buf_size);
+  d_data = d_buffer.data();
+  d_size = d_input->gcount();
+  d_pos  = 0;
+  return d_size > 0;
+}
+
 Token
 Lexer::next_token_aux()
 {
   int32_t ch;
   d_token.clear();
+  d_token_size = 0;
 
   // skip whitespace and comments
   for (;;)
@@ -161,7 +194,7 @@ Lexer::next_token_aux()
       d_coo = d_cur_coo;
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return Token::ENDOFFILE;
       }
     } while (CharacterClasses::is_printable(ch) && std::isspace(ch));
@@ -174,7 +207,7 @@ Lexer::next_token_aux()
     {
       if (ch == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "unexpected end of file in comment");
       }
     }
@@ -183,13 +216,13 @@ Lexer::next_token_aux()
   if (ch == '(')
   {
     push_char(ch);
-    d_token.push_back(0);
+    end_token();
     return Token::LPAR;
   }
   if (ch == ')')
   {
     push_char(ch);
-    d_token.push_back(0);
+    end_token();
     return Token::RPAR;
   }
   if (ch == '#')
@@ -197,7 +230,7 @@ Lexer::next_token_aux()
     push_char(ch);
     if ((ch = next_char()) == EOF)
     {
-      d_token.push_back(0);
+      end_token();
       return error(ch, "unexpected end of file after '#'");
     }
     if (ch == 'b')
@@ -205,12 +238,12 @@ Lexer::next_token_aux()
       push_char(ch);
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "unexpected end of file after '#b'");
       }
       if (ch != '0' && ch != '1')
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "expected '0' or '1' after '#b'");
       }
       push_char(ch);
@@ -221,7 +254,7 @@ Lexer::next_token_aux()
         push_char(ch);
       }
       save_char(ch);
-      d_token.push_back(0);
+      end_token();
       return Token::BINARY_VALUE;
     }
     if (ch == 'x')
@@ -229,13 +262,13 @@ Lexer::next_token_aux()
       push_char(ch);
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "unexpected end of file after '#x'");
       }
       if (!CharacterClasses::is_in_class(
               ch, CharacterClasses::CharacterClass::HEXADECIMAL_DIGIT))
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "expected hexa-decimal digit after '#x'");
       }
       push_char(ch);
@@ -250,10 +283,10 @@ Lexer::next_token_aux()
         push_char(ch);
       }
       save_char(ch);
-      d_token.push_back(0);
+      end_token();
       return Token::HEXADECIMAL_VALUE;
     }
-    d_token.push_back(0);
+    end_token();
     return error(ch, "expected 'x' or 'b' after '#'");
   }
   if (ch == '"')
@@ -263,7 +296,7 @@ Lexer::next_token_aux()
     {
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "unexpected end of file in string");
       }
       if (ch == '"')
@@ -273,7 +306,7 @@ Lexer::next_token_aux()
         if (ch != '"')
         {
           save_char(ch);
-          d_token.push_back(0);
+          end_token();
           return Token::STRING_VALUE;
         }
       }
@@ -282,10 +315,10 @@ Lexer::next_token_aux()
       {
         if (CharacterClasses::is_printable(ch))
         {
-          d_token.push_back(0);
+          end_token();
           return error(ch, "illegal " + err_char(ch) + " in string");
         }
-        d_token.push_back(0);
+        end_token();
         return error(ch,
                      "illegal (non-printable) character (code "
                          + std::to_string(static_cast<unsigned char>(ch))
@@ -301,13 +334,13 @@ Lexer::next_token_aux()
     {
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "unexpected end of file in quoted symbol");
       }
       push_char(ch);
       if (ch == '|')
       {
-        d_token.push_back(0);
+        end_token();
         return Token::SYMBOL;
       }
     }
@@ -317,13 +350,13 @@ Lexer::next_token_aux()
     push_char(ch);
     if ((ch = next_char()) == EOF)
     {
-      d_token.push_back(0);
+      end_token();
       return error(ch, "unexpected end of file after ':'");
     }
     if (!CharacterClasses::is_in_class(
             ch, CharacterClasses::CharacterClass::KEYWORD))
     {
-      d_token.push_back(0);
+      end_token();
       return error(ch, "unexpected " + err_char(ch) + " after ':'");
     }
     push_char(ch);
@@ -339,7 +372,7 @@ Lexer::next_token_aux()
       push_char(ch);
     }
     save_char(ch);
-    d_token.push_back(0);
+    end_token();
     return Token::ATTRIBUTE;
   }
   else if (ch == '0')
@@ -353,13 +386,13 @@ Lexer::next_token_aux()
       push_char(ch);
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "unexpected end of file after '0.'");
       }
       if (!CharacterClasses::is_in_class(
               ch, CharacterClasses::CharacterClass::DECIMAL_DIGIT))
       {
-        d_token.push_back(0);
+        end_token();
         return error(ch, "expected decimal digit after '0.'");
       }
       push_char(ch);
@@ -375,7 +408,7 @@ Lexer::next_token_aux()
       }
     }
     save_char(ch);
-    d_token.push_back(0);
+    end_token();
     return res;
   }
   else if (CharacterClasses::is_in_class(
@@ -399,7 +432,7 @@ Lexer::next_token_aux()
       push_char(ch);
       if ((ch = next_char()) == EOF)
       {
-        d_token.push_back(0);
+        end_token();
         return error(
             ch, "unexpected end of file after '" + std::string(token()) + "'");
       }
@@ -416,7 +449,7 @@ Lexer::next_token_aux()
       }
     }
     save_char(ch);
-    d_token.push_back(0);
+    end_token();
     return res;
   }
   else if (CharacterClasses::is_in_class(
@@ -434,14 +467,14 @@ Lexer::next_token_aux()
       push_char(ch);
     }
     save_char(ch);
-    d_token.push_back(0);
-    if (d_token[0] == '_' && d_token[1] == 0)
+    end_token();
+    if (token_view() == "_")
     {
       return Token::UNDERSCORE;
     }
     return Token::SYMBOL;
   }
-  d_token.push_back(0);
+  end_token();
   if (CharacterClasses::is_printable(ch))
   {
     return error(ch, "illegal " + err_char(ch));
@@ -15,6 +15,7 @@
 #include <cassert>
 #include <cstring>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 #include "parser/smt2/token.h"
@@ -140,7 +141,7 @@ class Lexer
    * Constructor.
    * @param infile The input file.
    */
-  Lexer() { d_buffer = std::vector<signed char>(d_buf_size, 0); }
+  Lexer() { d_buffer = std::vector<char>(d_buf_size, 0); }
   /** @return The next token. */
   Token next_token();
   /**
@@ -148,14 +149,37 @@ class Lexer
    *         representation (e.g., symbols, attributes, binary values, etc.).
    *         This string representation can then be queried via token().
    */
-  bool has_token() const { return !d_token.empty(); }
+  bool has_token() const { return d_token_size > 0; }
   /**
    * Get a string representation of the last parsed token. Empty if
    * !has_token(), i.e., if token has a unique string representation (e.g.,
    * left/right parenthesis, underscore, etc.).
+   *
+   * @note Tokens of in-memory data are copied on the first call, use
+   *       token_view() to avoid the copy.
+   * @return The 0-terminated string representation of the token.
+   */
+  const char* token() const
+  {
+    if (d_input == nullptr && d_token.empty())
+    {
+      d_token.assign(d_data + d_token_begin,
+                     d_data + d_token_begin + d_token_size);
+      d_token.push_back(0);
+    }
+    return d_token.data();
+  }
+  /**
+   * Get a view of the string representation of the last parsed token, see
+   * token(). For in-memory data, this is a view into the data.
    * @return The string representation of the token.
    */
-  const char* token() const { return d_token.data(); }
+  std::string_view token_view() const
+  {
+    return std::string_view(
+        d_input == nullptr ? d_data + d_token_begin : d_token.data(),
+        d_token_size);
+  }
   /** @return True if lexer encountered an error. */
   bool error() const;
   /** @return The error message, empty if !error(). */
@@ -173,6 +197,14 @@ class Lexer
    * @param input The input stream.
    */
   void init(std::istream* input);
+  /**
+   * Initialize lexer to read from given character data (e.g., a memory-mapped
+   * input file). The data is read in place and must remain valid until the
+   * lexer is reinitialized.
+   * @param data The input data.
+   * @param size The size of the input data.
+   */
+  void init(const char* data, size_t size);
 
   /**
    * Configure read buffer.
@@ -182,8 +214,6 @@ class Lexer
 
   /** The size of the chunks to be read into the input file buffer d_buffer. */
   size_t d_buf_size = 1024;
-  /** The index of the next character to be read from the buffer. */
-  size_t d_buf_idx = d_buf_size;
 
  private:
   /** Helper for next_token(). */
@@ -195,19 +225,19 @@ class Lexer
    */
   int32_t next_char()
   {
-    if (d_buf_idx == d_buf_size)
+    int32_t res;
+    d_saved = false;
+    if (d_pos < d_size || fill_buffer())
     {
-      assert(!d_saved);
-      d_input->read(reinterpret_cast<char*>(d_buffer.data()), d_buf_size);
-      size_t cnt = d_input->gcount();
-      if (d_input->eof())
-      {
-        d_buffer[cnt] = EOF;
-      }
-      d_buf_idx = 0;
+      res = static_cast<signed char>(d_data[d_pos++]);
+    }
+    else
+    {
+      // A position past the end of the data indicates EOF, save_char() then
+      // steps back to the end of the data.
+      d_pos = d_size + 1;
+      res   = EOF;
     }
-    d_saved     = false;
-    int32_t res = d_buffer[d_buf_idx++];
     if (res == '\n')
     {
       d_cur_coo.line += 1;
@@ -234,7 +264,35 @@ class Lexer
     // standard and abuse the set-info command with keyword `:source` for
     // adding, e.g., author information that is not sanitized.
     // assert(ch >= 0 && ch < 256);
-    d_token.push_back(static_cast<char>(ch));
+    if (d_input == nullptr)
+    {
+      // Tokens are contiguous in the data and referenced in place, the last
+      // character read is at d_pos - 1.
+      if (d_token_size == 0)
+      {
+        d_token_begin = d_pos - 1;
+      }
+      assert(d_data[d_token_begin + d_token_size] == static_cast<char>(ch));
+    }
+    else
+    {
+      d_token.push_back(static_cast<char>(ch));
+    }
+    d_token_size += 1;
+  }
+
+  /**
+   * Terminate the current token. Tokens read from an input stream are
+   * 0-terminated in d_token, tokens of in-memory data are only copied to
+   * d_token on demand (see token()).
+   * @note implemented here for inlining
+   */
+  void end_token()
+  {
+    if (d_input != nullptr)
+    {
+      d_token.push_back(0);
+    }
   }
 
   /**
@@ -244,10 +302,11 @@ class Lexer
   void save_char(int32_t ch)
   {
     assert(!d_saved);
-    assert(d_buf_idx > 0);
+    assert(d_pos > 0);
     d_saved = true;
-    d_buf_idx -= 1;
-    assert(d_buffer[d_buf_idx] == ch);
+    d_pos -= 1;
+    assert(d_pos == d_size ? ch == EOF
+                           : static_cast<signed char>(d_data[d_pos]) == ch);
     if (ch == '\n')
     {
       assert(d_cur_coo.line > 1);
@@ -261,6 +320,12 @@ class Lexer
     }
   }
 
+  /**
+   * Read the next chunk of the input stream into the read buffer.
+   * @return False if no more characters are available.
+   */
+  bool fill_buffer();
+
   /**
    * Helper for error().
    * @return String "character '<ch>'".
@@ -276,7 +341,7 @@ class Lexer
    */
   Token error(int32_t ch, const std::string& error_msg);
 
-  /** The input stream. */
+  /** The input stream, nullptr if reading from in-memory data. */
   std::istream* d_input = nullptr;
   /** The coordinate of the current token. */
   Coordinate d_coo{1, 1};
@@ -289,16 +354,28 @@ class Lexer
 
   /**
    * The string representation of the current token (if not a token with unique
-   * representation, e.g., (, ), _, ...).
+   * representation, e.g., (, ), _, ...). Filled on demand by token() when
+   * reading from in-memory data.
    */
-  std::vector<char> d_token;
+  mutable std::vector<char> d_token;
+  /** The index of the first character of the current token in d_data. */
+  size_t d_token_begin = 0;
+  /** The number of characters of the current token. */
+  size_t d_token_size = 0;
 
   /**
    * The read buffer.
-   * Characters are read from the input file into the buffer in d_buf_size
+   * Characters are read from the input stream into the buffer in d_buf_size
    * chunks, and next_char() then reads character by character from the buffer.
+   * Unused when reading from in-memory data.
    */
-  std::vector<signed char> d_buffer;  // value-initialized to 0
+  std::vector<char> d_buffer;  // value-initialized to 0
+  /** The data currently read from, either d_buffer or in-memory input. */
+  const char* d_data = nullptr;
+  /** The size of d_data. */
+  size_t d_size = 0;
+  /** The index of the next character to be read from d_data. */
+  size_t d_pos = 0;
   /** True if we saved a character that has not been consumed yet. */
   bool d_saved = false;
 
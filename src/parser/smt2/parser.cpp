@@ -13,6 +13,8 @@
 #include <algorithm>
 #include <iostream>
 
+#include "util/mapped_file.h"
+
 namespace bzla {
 namespace parser::smt2 {
 
@@ -58,6 +60,7 @@ Parser::parse(const std::string& input, bool parse_only, bool parse_file)
   std::istream* instream = &std::cin;
   std::ifstream infile;
   std::stringstream instring;
+  util::MappedFile mapped;
 
   if (parse_file)
   {
@@ -65,6 +68,12 @@ Parser::parse(const std::string& input, bool parse_only, bool parse_file)
     {
       d_lexer->configure_buffer(1);
     }
+    else if (mapped.open(input))
+    {
+      // Lex regular files in place, without copying them into a read buffer.
+      d_lexer->init(mapped.data(), mapped.size());
+      return parse_input(input, parse_only);
+    }
     else
     {
       infile.open(input, std::ifstream::in);
@@ -96,12 +105,18 @@ bool
 Parser::parse(const std::string& infile_name,
               std::istream& input,
               bool parse_only)
+{
+  BITWUZLA_CHECK(input.operator bool()) << "invalid input stream";
+  d_lexer->init(&input);
+  return parse_input(infile_name, parse_only);
+}
+
+bool
+Parser::parse_input(const std::string& infile_name, bool parse_only)
 {
   util::Timer timer(d_statistics.time_parse);
   Log(2) << "parse " << d_infile_name;
 
-  BITWUZLA_CHECK(input.operator bool()) << "invalid input stream";
-
   if (!d_error.empty())
   {
     d_error = "parser in unsafe state after parse error";
@@ -111,7 +126,6 @@ Parser::parse(const std::string& infile_name,
   reset();
 
   d_infile_name = infile_name;
-  d_lexer->init(&input);
 
   while (parse_command(parse_only) && !d_done && !terminate())
     ;
@@ -1414,14 +1428,14 @@ Parser::parse_open_term(Token token)
   else if (token == Token::BINARY_VALUE)
   {
     assert(d_lexer->has_token());
-    std::string val     = d_lexer->token() + 2;
+    std::string val(d_lexer->token_view().substr(2));
     bitwuzla::Sort sort = d_tm.mk_bv_sort(val.size());
     push_item(Token::TERM, d_tm.mk_bv_value(sort, val), d_lexer->coo());
   }
   else if (token == Token::HEXADECIMAL_VALUE)
   {
     assert(d_lexer->has_token());
-    std::string val     = d_lexer->token() + 2;
+    std::string val(d_lexer->token_view().substr(2));
     bitwuzla::Sort sort = d_tm.mk_bv_sort(val.size() * 4);
     push_item(Token::TERM, d_tm.mk_bv_value(sort, val, 16), d_lexer->coo());
   }
@@ -1429,7 +1443,7 @@ Parser::parse_open_term(Token token)
   {
     assert(d_lexer->has_token());
     ParsedItem& item = item_open();
-    item.d_strs.emplace_back(d_lexer->token());
+    item.d_strs.emplace_back(d_lexer->token_view());
     item.d_strs_coo.emplace_back(d_lexer->coo());
   }
   else
@@ -108,6 +108,13 @@ class Parser : public bzla::parser::Parser
 
   /** Reset parser for new parse call. */
   void reset();
+  /**
+   * Parse the input the lexer has been initialized with.
+   * @param infile_name The name of the input file.
+   * @param parse_only  True to only parse without executing check-sat calls.
+   * @return False on error.
+   */
+  bool parse_input(const std::string& infile_name, bool parse_only);
 
   /**
    * Get next token from the lexer and insert new symbols into symbol table.
@@ -124,7 +131,7 @@ class Parser : public bzla::parser::Parser
     if (token == Token::SYMBOL || token == Token::ATTRIBUTE)
     {
       assert(d_lexer->has_token());
-      std::string symbol      = d_lexer->token();
+      std::string symbol(d_lexer->token_view());
       SymbolTable::Node* node = d_table.find(symbol);
       if (!node)
       {
@@ -138,7 +145,7 @@ class Parser : public bzla::parser::Parser
       d_repr +=
           (d_repr.size() && d_repr.back() != '(' && token != Token::RPAR ? " "
                                                                          : "")
-          + std::string(d_lexer->token());
+          + std::string(d_lexer->token_view());
     }
     return token;
   }
@@ -0,0 +1,265 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "portfolio.h"
+
+#include <chrono>
+#include <thread>
+
+#include "env.h"
+#include "solving_context.h"
+
+namespace bzla {
+
+using namespace std::chrono_literals;
+
+/* --- Portfolio public ---------------------------------------------------- */
+
+Portfolio::Portfolio(Env& env)
+    : d_env(env),
+      d_logger(env.logger()),
+      d_done(false),
+      d_stats(env.statistics())
+{
+  d_terminator.reset(new WorkerTerminator(d_done));
+}
+
+Portfolio::~Portfolio() {}
+
+Result
+Portfolio::solve(const std::vector<Node>& assertions)
+{
+  ++d_stats.num_solve;
+  size_t num_workers = d_env.options().nthreads();
+  assert(num_workers > 1);
+
+  {
+    util::Timer timer(d_stats.time_init);
+    init_workers(assertions, num_workers);
+  }
+
+  util::Timer timer(d_stats.time_solve);
+  Msg(1) << "portfolio: starting " << num_workers << " workers";
+
+  d_done        = false;
+  d_winner      = nullptr;
+  d_exception   = nullptr;
+  d_num_running = d_workers.size();
+
+  std::vector<std::thread> threads;
+  for (auto& w : d_workers)
+  {
+    threads.emplace_back(&Portfolio::run, this, std::ref(*w));
+  }
+
+  // Wait for the first definite result. The terminator of the parent context
+  // (user-defined terminator, time and memory limits) is only queried from
+  // this thread and forwarded to the workers via d_done.
+  {
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (d_num_running > 0 && !d_done)
+    {
+      d_cv.wait_for(lock, 10ms);
+      if (d_env.terminate())
+      {
+        d_done = true;
+      }
+    }
+    d_done = true;
+  }
+
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+
+  if (d_exception)
+  {
+    d_workers.clear();
+    d_winner = nullptr;
+    std::rethrow_exception(d_exception);
+  }
+
+  // Free the workers that did not determine the result.
+  for (auto& w : d_workers)
+  {
+    if (w.get() != d_winner)
+    {
+      w.reset();
+    }
+  }
+
+  if (d_winner == nullptr)
+  {
+    Msg(1) << "portfolio: no worker determined a result";
+    return Result::UNKNOWN;
+  }
+  d_stats.winner << d_winner->d_id;
+  Msg(1) << "portfolio: worker " << d_winner->d_id
+         << " determined: " << d_winner->d_result;
+  return d_winner->d_result;
+}
+
+Node
+Portfolio::get_value(const Node& term)
+{
+  assert(d_winner != nullptr);
+  assert(d_winner->d_result == Result::SAT);
+  Node value = d_winner->d_ctx->get_value(d_winner->d_import->translate(term));
+  return d_winner->d_export->translate(value);
+}
+
+std::vector<Node>
+Portfolio::get_unsat_core()
+{
+  assert(d_winner != nullptr);
+  assert(d_winner->d_result == Result::UNSAT);
+  std::vector<Node> res;
+  for (const Node& n : d_winner->d_ctx->get_unsat_core())
+  {
+    res.push_back(d_winner->d_export->translate(n));
+  }
+  return res;
+}
+
+void
+Portfolio::configure_worker(option::Options& options, size_t id)
+{
+  // Resource limits are enforced by the parent context and each worker only
+  // uses a single thread.
+  options.nthreads.set(1);
+  options.time_limit_per.set(0);
+  options.memory_limit.set(0);
+
+  if (id == 0)
+  {
+    return;
+  }
+
+  // Diversify seeds of all but the first worker.
+  options.seed.set((options.seed() + id) % UINT32_MAX);
+
+  // Cycle through configurations, options explicitly configured by the user
+  // are not overwritten.
+  bool bv_solver   = !options.bv_solver.is_user_set();
+  bool abstraction = !options.abstraction.is_user_set();
+  switch ((id - 1) % 4)
+  {
+    case 0:
+      if (bv_solver) options.bv_solver.set(option::BvSolver::PREPROP);
+      break;
+    case 1:
+      if (abstraction) options.abstraction.set(!options.abstraction());
+      break;
+    case 2:
+      if (bv_solver) options.bv_solver.set(option::BvSolver::PREPROP);
+      if (!options.prop_path_sel.is_user_set())
+      {
+        options.prop_path_sel.set(option::PropPathSelection::RANDOM);
+      }
+      break;
+    default:
+      if (abstraction)
+      {
+        options.abstraction.set(!options.abstraction());
+        if (!options.abstraction_eager_refine.is_user_set())
+        {
+          options.abstraction_eager_refine.set(true);
+        }
+      }
+  }
+}
+
+/* --- Portfolio private --------------------------------------------------- */
+
+void
+Portfolio::init_workers(const std::vector<Node>& assertions,
+                        size_t num_workers)
+{
+  d_winner = nullptr;
+  d_workers.clear();
+  for (size_t i = 0; i < num_workers; ++i)
+  {
+    auto& w = d_workers.emplace_back(new Worker(i));
+
+    option::Options options = d_env.options();
+    configure_worker(options, i);
+
+    w->d_nm.reset(new NodeManager());
+    w->d_import.reset(new node::NodeTranslator(*w->d_nm));
+    w->d_export.reset(new node::NodeTranslator(d_env.nm()));
+    w->d_ctx.reset(new SolvingContext(
+        *w->d_nm, options, "portfolio-" + std::to_string(i), true));
+    w->d_ctx->env().configure_terminator(d_terminator.get());
+
+    for (const Node& assertion : assertions)
+    {
+      w->d_ctx->assert_formula(w->d_import->translate(assertion));
+    }
+
+    // Map constants, variables, uninterpreted types and assertions back to
+    // the parent node manager.
+    for (const auto& [from, to] : w->d_import->type_map())
+    {
+      w->d_export->add(to, from);
+    }
+    for (const auto& [from, to] : w->d_import->node_map())
+    {
+      node::Kind k = from.kind();
+      if (k == node::Kind::CONSTANT || k == node::Kind::VARIABLE)
+      {
+        w->d_export->add(to, from);
+      }
+    }
+    for (const Node& assertion : assertions)
+    {
+      w->d_export->add(w->d_import->translate(assertion), assertion);
+    }
+  }
+}
+
+void
+Portfolio::run(Worker& worker)
+{
+  Result res = Result::UNKNOWN;
+  try
+  {
+    res = worker.d_ctx->solve();
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (!d_exception)
+    {
+      d_exception = std::current_exception();
+    }
+    d_done = true;
+  }
+
+  std::lock_guard<std::mutex> lock(d_mutex);
+  worker.d_result = res;
+  if (res != Result::UNKNOWN && d_winner == nullptr && !d_exception)
+  {
+    d_winner = &worker;
+    d_done   = true;
+  }
+  --d_num_running;
+  d_cv.notify_one();
+}
+
+Portfolio::Statistics::Statistics(util::Statistics& stats)
+    : num_solve(stats.new_stat<uint64_t>("portfolio::num_solve")),
+      winner(stats.new_stat<util::HistogramStatistic>("portfolio::winner")),
+      time_init(stats.new_stat<util::TimerStatistic>("portfolio::time_init")),
+      time_solve(stats.new_stat<util::TimerStatistic>("portfolio::time_solve"))
+{
+}
+
+}  // namespace bzla
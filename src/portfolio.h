@@ -0,0 +1,161 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_PORTFOLIO_H_INCLUDED
+#define BZLA_PORTFOLIO_H_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "node/node.h"
+#include "node/node_manager.h"
+#include "node/node_translator.h"
+#include "option/option.h"
+#include "solver/result.h"
+#include "terminator.h"
+#include "util/logger.h"
+#include "util/statistics.h"
+
+namespace bzla {
+
+class Env;
+class SolvingContext;
+
+/**
+ * Parallel portfolio solver.
+ *
+ * Runs a number of differently configured solving contexts on separate
+ * threads over the same set of assertions. The first worker that determines
+ * a definite result (sat or unsat) wins, all other workers are terminated.
+ *
+ * Since node managers are not thread-safe, each worker owns a separate node
+ * manager. Assertions are translated into the worker's node manager before
+ * the worker threads are started. Model values and unsat cores are translated
+ * back into the node manager of the parent context on request.
+ */
+class Portfolio
+{
+ public:
+  /**
+   * Constructor.
+   * @param env The environment of the parent solving context. The number of
+   *            workers is determined by option `nthreads`.
+   */
+  Portfolio(Env& env);
+  ~Portfolio();
+
+  /**
+   * Solve given set of assertions.
+   * @param assertions The original input assertions of the parent context.
+   * @return The result of the first worker that determined a definite result,
+   *         or Result::UNKNOWN if no worker did.
+   */
+  Result solve(const std::vector<Node>& assertions);
+
+  /**
+   * Get model value of given term from the winning worker.
+   * @note Only valid if last solve() call returned Result::SAT.
+   * @param term The term (of the parent node manager) to query.
+   * @return The value, in terms of the parent node manager.
+   */
+  Node get_value(const Node& term);
+
+  /**
+   * Get unsat core from the winning worker.
+   * @note Only valid if last solve() call returned Result::UNSAT.
+   * @return The unsat core in terms of the original assertions of the
+   *         parent context.
+   */
+  std::vector<Node> get_unsat_core();
+
+  /**
+   * Configure options of given worker.
+   * @param options The options to configure.
+   * @param id      The worker id, worker 0 keeps the configuration of the
+   *                parent context.
+   */
+  static void configure_worker(option::Options& options, size_t id);
+
+ private:
+  /** Terminator that signals workers to terminate. */
+  class WorkerTerminator : public Terminator
+  {
+   public:
+    WorkerTerminator(std::atomic<bool>& done) : d_done(done) {}
+    bool terminate() override { return d_done.load(); }
+
+   private:
+    std::atomic<bool>& d_done;
+  };
+
+  struct Worker
+  {
+    Worker(size_t id) : d_id(id) {}
+    /** The worker id. */
+    size_t d_id;
+    /** The worker node manager, must be destroyed last. */
+    std::unique_ptr<NodeManager> d_nm;
+    /** Translates nodes from the parent into the worker node manager. */
+    std::unique_ptr<node::NodeTranslator> d_import;
+    /** Translates nodes from the worker into the parent node manager. */
+    std::unique_ptr<node::NodeTranslator> d_export;
+    /** The worker solving context. */
+    std::unique_ptr<SolvingContext> d_ctx;
+    /** The result of the worker. */
+    Result d_result = Result::UNKNOWN;
+  };
+
+  /** Create and initialize given number of workers. */
+  void init_workers(const std::vector<Node>& assertions, size_t num_workers);
+
+  /** Main function of worker thread. */
+  void run(Worker& worker);
+
+  /** The environment of the parent context. */
+  Env& d_env;
+  /** The logger of the parent context. */
+  util::Logger& d_logger;
+
+  /** The workers of the last solve() call. */
+  std::vector<std::unique_ptr<Worker>> d_workers;
+  /** The worker that determined the result of the last solve() call. */
+  Worker* d_winner = nullptr;
+
+  /** Worker terminator. */
+  std::unique_ptr<WorkerTerminator> d_terminator;
+  /** Indicates whether workers should terminate. */
+  std::atomic<bool> d_done;
+
+  /** Protects d_winner, d_num_running and d_exception. */
+  std::mutex d_mutex;
+  /** Notifies parent thread about terminated workers. */
+  std::condition_variable d_cv;
+  /** Number of currently running workers. */
+  size_t d_num_running = 0;
+  /** Exception thrown by a worker, rethrown in the parent thread. */
+  std::exception_ptr d_exception;
+
+  struct Statistics
+  {
+    Statistics(util::Statistics& stats);
+    uint64_t& num_solve;
+    util::HistogramStatistic& winner;
+    util::TimerStatistic& time_init;
+    util::TimerStatistic& time_solve;
+  } d_stats;
+};
+
+}  // namespace bzla
+
+#endif
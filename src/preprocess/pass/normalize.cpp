@@ -35,9 +35,7 @@ using namespace bzla::node;
 class AigScore
 {
  public:
-  using AigNodeRefSet =
-      std::unordered_set<std::reference_wrapper<const bitblast::AigNode>,
-                         std::hash<bitblast::AigNode>>;
+  using AigNodeSet = std::unordered_set<bitblast::AigNode>;
 
   /** Add term to score. */
   void add(const Node& term) { d_visit.push_back(term); }
@@ -13,6 +13,7 @@
 
 #include <unordered_map>
 
+#include "node/node_map.h"
 #include "preprocess/preprocessing_pass.h"
 #include "rewrite/rewriter.h"
 #include "util/statistics.h"
@@ -204,7 +205,7 @@ class PassNormalize : public PreprocessingPass
    * Cache of processed nodes that maybe shared across substitutions.
    * Clear after a call to process to avoid sharing.
    */
-  std::unordered_map<Node, Node> d_cache;
+  node::NodeMap<Node> d_cache;
 
   std::vector<Node> d_adder_chains;
   std::unordered_map<Node, uint64_t> d_adder_chains_length;
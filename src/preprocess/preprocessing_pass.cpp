@@ -26,16 +26,9 @@ PreprocessingPass::PreprocessingPass(Env& env,
       d_logger(env.logger()),
       d_stats_pass(d_env.statistics(), "preprocess::" + name + "::"),
       d_id(id),
-      d_name(name)
-
-{
-  (void) backtrack_mgr;  // suppress warning, may be needed in the future
-}
-
-void
-PreprocessingPass::clear_cache()
+      d_name(name),
+      d_processed_assertions(backtrack_mgr)
 {
-  d_processed_assertions.clear();
 }
 
 /* --- PreprocessingPass protected ------------------------------------------ */
@@ -14,6 +14,7 @@
 #include <unordered_map>
 
 #include "backtrack/unordered_map.h"
+#include "backtrack/unordered_set.h"
 #include "node/node.h"
 #include "preprocess/assertion_vector.h"
 #include "util/statistics.h"
@@ -60,8 +61,6 @@ class PreprocessingPass
    */
   virtual Node process(const Node& term) { return term; }
 
-  void clear_cache();
-
   const auto& statistics() const { return d_stats_pass; }
 
   const std::string& name() const { return d_name; }
@@ -101,6 +100,8 @@ class PreprocessingPass
 
   /**
    * Mark assertion as processed.
+   * @note Processed assertions are scoped to the current assertion level and
+   *       are kept across preprocessing calls.
    *
    * @param assertion The assertion to cache.
    * @return Whether assertion was added to the cache or not.
@@ -128,7 +129,8 @@ class PreprocessingPass
   const std::string d_id;
   /** Pass name used for printing statistics. */
   const std::string d_name;
-  std::unordered_set<Node> d_processed_assertions;
+  /** The set of processed assertions, scoped to the assertion level. */
+  backtrack::unordered_set<Node> d_processed_assertions;
 };
 
 }  // namespace preprocess
@@ -117,19 +117,9 @@ Preprocessor::preprocess()
     print_statistics("**");
   }
 
-  // Clear rewriter and preprocessing pass caches
-  d_env.rewriter().clear_cache();
-  d_pass_rewrite.clear_cache();
-  d_pass_contr_ands.clear_cache();
-  d_pass_elim_lambda.clear_cache();
-  d_pass_elim_bvudiv.clear_cache();
-  d_pass_elim_uninterpreted.clear_cache();
-  d_pass_embedded_constraints.clear_cache();
-  d_pass_variable_substitution.clear_cache();
-  d_pass_flatten_and.clear_cache();
-  d_pass_skeleton_preproc.clear_cache();
-  d_pass_normalize.clear_cache();
-  d_pass_elim_extract.clear_cache();
+  // Rewriter and preprocessing pass caches are kept for subsequent calls.
+  // The caches of processed assertions are scoped to the assertion level,
+  // the rewriter cache is bounded by option rewrite_cache_limit.
 
   if (d_assertions.is_inconsistent())
   {
@@ -0,0 +1,185 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "rewrite/rewrite_cache.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+
+namespace bzla {
+
+RewriteCache::RewriteCache(util::Statistics& stats,
+                           const std::string& prefix,
+                           uint64_t max_bytes)
+    : d_slots(MIN_CAPACITY), d_max_bytes(max_bytes), d_stats(stats, prefix)
+{
+  if (d_max_bytes)
+  {
+    d_max_capacity = MIN_CAPACITY;
+    while (d_max_capacity * 2 * sizeof(Slot) <= d_max_bytes)
+    {
+      d_max_capacity *= 2;
+    }
+    d_gen_size = std::max<uint64_t>(
+        1, max_load(d_max_capacity) / NUM_GENERATIONS);
+  }
+}
+
+Node*
+RewriteCache::find(const Node& node)
+{
+  assert(!node.is_null());
+  Slot& slot = d_slots[index(node.id())];
+  if (slot.d_id == 0)
+  {
+    ++d_stats.num_misses;
+    return nullptr;
+  }
+  if (!slot.d_result.is_null())
+  {
+    ++d_stats.num_hits;
+  }
+  slot.d_gen = d_gen;
+  return &slot.d_result;
+}
+
+Node&
+RewriteCache::at(const Node& node)
+{
+  assert(!node.is_null());
+  Slot& slot = d_slots[index(node.id())];
+  assert(slot.d_id == node.id());
+  return slot.d_result;
+}
+
+Node&
+RewriteCache::insert(const Node& node, const Node& result)
+{
+  assert(!node.is_null());
+  uint64_t id  = node.id();
+  uint64_t idx = index(id);
+  if (d_slots[idx].d_id == 0)
+  {
+    if (d_size + 1 > max_load(d_slots.size()))
+    {
+      // Grow beyond the memory limit if necessary, entries are evicted on
+      // the next call to limit().
+      rehash(d_slots.size() * 2);
+      idx = index(id);
+    }
+    d_slots[idx].d_id = id;
+    d_size += 1;
+    if (++d_gen_inserts >= d_gen_size)
+    {
+      d_gen += 1;
+      d_gen_inserts = 0;
+    }
+  }
+  Slot& slot    = d_slots[idx];
+  slot.d_gen    = d_gen;
+  slot.d_result = result;
+  return slot.d_result;
+}
+
+void
+RewriteCache::clear()
+{
+  std::vector<Slot>(MIN_CAPACITY).swap(d_slots);
+  d_size        = 0;
+  d_gen_inserts = 0;
+}
+
+uint64_t
+RewriteCache::limit()
+{
+  if (d_max_bytes == 0 || memory() <= d_max_bytes)
+  {
+    return 0;
+  }
+  ++d_stats.num_limits;
+
+  // Keep the most recently used generations that fit into half of the
+  // maximum number of entries.
+  std::map<uint64_t, uint64_t> gens;
+  for (const Slot& slot : d_slots)
+  {
+    if (slot.d_id && !slot.d_result.is_null())
+    {
+      gens[slot.d_gen] += 1;
+    }
+  }
+  uint64_t target  = max_load(d_max_capacity) / 2;
+  uint64_t min_gen = d_gen + 1;
+  uint64_t kept    = 0;
+  for (auto it = gens.rbegin(); it != gens.rend(); ++it)
+  {
+    if (kept + it->second > target)
+    {
+      break;
+    }
+    kept += it->second;
+    min_gen = it->first;
+  }
+
+  uint64_t size = d_size;
+  rehash(d_max_capacity, true, min_gen);
+  assert(d_size == kept);
+  d_stats.num_evictions += size - d_size;
+  d_gen += 1;
+  d_gen_inserts = 0;
+  return size - d_size;
+}
+
+uint64_t
+RewriteCache::index(uint64_t id) const
+{
+  assert(id > 0);
+  uint64_t mask = d_slots.size() - 1;
+  // Fibonacci hashing
+  uint64_t idx = (id * UINT64_C(0x9e3779b97f4a7c15)) & mask;
+  while (d_slots[idx].d_id != 0 && d_slots[idx].d_id != id)
+  {
+    idx = (idx + 1) & mask;
+  }
+  return idx;
+}
+
+void
+RewriteCache::rehash(uint64_t capacity, bool evict, uint64_t min_gen)
+{
+  assert((capacity & (capacity - 1)) == 0);
+  std::vector<Slot> slots(capacity);
+  d_slots.swap(slots);
+  d_size = 0;
+  for (Slot& slot : slots)
+  {
+    if (slot.d_id == 0
+        || (evict && (slot.d_gen < min_gen || slot.d_result.is_null())))
+    {
+      continue;
+    }
+    uint64_t idx = index(slot.d_id);
+    assert(d_slots[idx].d_id == 0);
+    d_slots[idx] = std::move(slot);
+    d_size += 1;
+  }
+}
+
+RewriteCache::Statistics::Statistics(util::Statistics& stats,
+                                     const std::string& prefix)
+    : num_hits(stats.new_stat<uint64_t>(prefix + "num_hits")),
+      num_misses(stats.new_stat<uint64_t>(prefix + "num_misses")),
+      num_evictions(stats.new_stat<uint64_t>(prefix + "num_evictions")),
+      num_limits(stats.new_stat<uint64_t>(prefix + "num_limits"))
+{
+}
+
+}  // namespace bzla
@@ -0,0 +1,157 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_REWRITE_REWRITE_CACHE_H_INCLUDED
+#define BZLA_REWRITE_REWRITE_CACHE_H_INCLUDED
+
+#include <cstdint>
+#include <vector>
+
+#include "node/node.h"
+#include "util/statistics.h"
+
+namespace bzla {
+
+/* -------------------------------------------------------------------------- */
+
+/**
+ * Bounded cache that maps nodes to their rewritten form.
+ *
+ * The cache is an open-addressing hash table with linear probing, keyed by
+ * node id. Keys are not referenced, i.e., the cache does not keep rewritten
+ * nodes alive (node ids are never reused). Cached results are referenced
+ * until they are evicted.
+ *
+ * Entries are tagged with the generation in which they were last used. A new
+ * generation starts after a fixed number of insertions (a fraction of the
+ * maximum number of entries). If the table exceeds the configured memory
+ * limit, limit() evicts the least recently used generations.
+ */
+class RewriteCache
+{
+ public:
+  /**
+   * Constructor.
+   * @param stats     The associated statistics object.
+   * @param prefix    The prefix for statistics.
+   * @param max_bytes The memory limit in bytes, 0 for no limit.
+   */
+  RewriteCache(util::Statistics& stats,
+               const std::string& prefix,
+               uint64_t max_bytes = 0);
+
+  /**
+   * Lookup cached result for given node and mark it as used.
+   * @param node The node.
+   * @return A pointer to the cached result, nullptr if `node` is not cached.
+   *         The result is null if `node` was inserted without result. The
+   *         pointer is only valid until the next call to insert().
+   */
+  Node* find(const Node& node);
+
+  /**
+   * Insert or update the cached result for given node.
+   * @param node   The node.
+   * @param result The result, null to mark `node` as visited.
+   * @return A reference to the cached result, only valid until the next call
+   *         to insert().
+   */
+  Node& insert(const Node& node, const Node& result = Node());
+
+  /**
+   * Get cached result for given node, which must be cached. In contrast to
+   * find(), this does not count as cache hit and does not mark the entry as
+   * used.
+   * @param node The node.
+   * @return A reference to the cached result, only valid until the next call
+   *         to insert().
+   */
+  Node& at(const Node& node);
+
+  /** @return The number of cached entries. */
+  uint64_t size() const { return d_size; }
+  /** @return True if the cache is empty. */
+  bool empty() const { return d_size == 0; }
+  /** @return The memory in bytes allocated for the hash table. */
+  uint64_t memory() const { return d_slots.size() * sizeof(Slot); }
+
+  /** Remove all entries. */
+  void clear();
+
+  /**
+   * Evict entries of the least recently used generations if the memory limit
+   * is exceeded. The hash table may grow beyond the memory limit on insert(),
+   * since entries must not be evicted while the caller still refers to them
+   * (e.g., during a traversal). This must be called at a point where this is
+   * not the case.
+   * @return The number of evicted entries.
+   */
+  uint64_t limit();
+
+ private:
+  /** Minimum capacity of the hash table. */
+  static constexpr uint64_t MIN_CAPACITY = 64;
+  /** Number of generations per maximum number of entries. */
+  static constexpr uint64_t NUM_GENERATIONS = 8;
+
+  struct Slot
+  {
+    /** The id of the cached node, 0 if the slot is empty. */
+    uint64_t d_id = 0;
+    /** The generation in which this entry was last used. */
+    uint64_t d_gen = 0;
+    /** The cached result. */
+    Node d_result;
+  };
+
+  /** @return The maximum number of entries for given capacity. */
+  static uint64_t max_load(uint64_t capacity) { return capacity / 4 * 3; }
+  /** @return The index of the slot for given id or the empty slot for it. */
+  uint64_t index(uint64_t id) const;
+  /**
+   * Rehash entries into a hash table with given capacity.
+   * @param capacity The new capacity, must be a power of 2.
+   * @param evict    True to evict entries without result and entries that
+   *                 were last used before generation `min_gen`.
+   * @param min_gen  The minimum generation of entries to keep if `evict` is
+   *                 true.
+   */
+  void rehash(uint64_t capacity, bool evict = false, uint64_t min_gen = 0);
+
+  /** The hash table. */
+  std::vector<Slot> d_slots;
+  /** The number of entries. */
+  uint64_t d_size = 0;
+  /** The memory limit in bytes, 0 for no limit. */
+  uint64_t d_max_bytes;
+  /** The capacity of the hash table if the memory limit is reached. */
+  uint64_t d_max_capacity = 0;
+  /** The current generation. */
+  uint64_t d_gen = 0;
+  /** The number of insertions of new entries in the current generation. */
+  uint64_t d_gen_inserts = 0;
+  /** The number of insertions after which a new generation starts. */
+  uint64_t d_gen_size = UINT64_MAX;
+
+  struct Statistics
+  {
+    Statistics(util::Statistics& stats, const std::string& prefix);
+    uint64_t& num_hits;
+    uint64_t& num_misses;
+    uint64_t& num_evictions;
+    uint64_t& num_limits;
+  } d_stats;
+};
+
+/* -------------------------------------------------------------------------- */
+
+}  // namespace bzla
+
+#endif
@@ -93,8 +93,15 @@ Rewriter::Rewriter(Env& env, uint8_t level, const std::string& id)
     : d_env(env),
       d_logger(env.logger()),
       d_level(level),
+      d_cache(env.statistics(),
+              "rewriter::" + (id.empty() ? "" : "(" + id + ")::") + "cache::",
+              env.options().rewrite_cache_limit() * 1024 * 1024),
       d_eval_cache(env.options().rewrite_level() > 0 ? d_cache
                                                      : d_eval_cache_aux),
+      d_eval_cache_aux(
+          env.statistics(),
+          "rewriter::" + (id.empty() ? "" : "(" + id + ")::") + "eval_cache::",
+          env.options().rewrite_cache_limit() * 1024 * 1024),
       d_stats(env.statistics(),
               "rewriter::" + (id.empty() ? "" : "(" + id + ")::"))
 {
@@ -103,20 +110,24 @@ Rewriter::Rewriter(Env& env, uint8_t level, const std::string& id)
   (void) d_env;  // only used in debug mode
 }
 
-const Node&
+Node
 Rewriter::rewrite(const Node& node)
 {
+  // Not within a traversal, evict cache entries if above memory limit.
+  d_cache.limit();
+
   node::node_ref_vector visit{node};
   do
   {
     const Node& cur = visit.back();
-    auto [it, inserted] = d_cache.emplace(cur, Node());
-    if (inserted)
+    Node* res       = d_cache.find(cur);
+    if (res == nullptr)
     {
+      d_cache.insert(cur);
       visit.insert(visit.end(), cur.begin(), cur.end());
       continue;
     }
-    else if (it->second.is_null())
+    else if (res->is_null())
     {
       if (cur.num_children())
       {
@@ -126,12 +137,13 @@ Rewriter::rewrite(const Node& node)
         // Save current maximum node id
         int64_t max_id = d_env.nm().max_node_id();
 #endif
-        it->second = _rewrite(node::utils::rebuild_node(nm(), cur, d_cache));
+        Node rewritten = _rewrite(rebuild_node(d_cache, cur));
+        d_cache.insert(cur, rewritten);
 #ifndef NDEBUG
         uint64_t thresh = d_env.options().dbg_rw_node_thresh();
         if (thresh > 0 && d_num_nodes > 0)
         {
-          auto [new_nodes, depth] = diff(max_id, it->second);
+          auto [new_nodes, depth] = diff(max_id, rewritten);
           Warn(new_nodes >= thresh) << "_rewrite() introduced " << new_nodes
                                     << " new nodes up to depth " << depth;
         }
@@ -139,48 +151,53 @@ Rewriter::rewrite(const Node& node)
       }
       else
       {
-        it->second = cur;
+        *res = cur;
       }
     }
     visit.pop_back();
   } while (!visit.empty());
-  assert(d_cache.find(node) != d_cache.end());
+  assert(!d_cache.at(node).is_null());
   return d_cache.at(node);
 }
 
 Node
 Rewriter::eval(const Node& node)
 {
+  // Not within a traversal, evict cache entries if above memory limit.
+  d_eval_cache.limit();
+
   node::node_ref_vector visit{node};
   // We use d_eval_cache, a separate cache from the rewriter cache to be able
   // to evaluate nodes even when rewriting is disabled.
   do
   {
-    const Node& cur     = visit.back();
-    auto [it, inserted] = d_eval_cache.emplace(cur, Node());
-    if (inserted)
+    const Node& cur = visit.back();
+    Node* res       = d_eval_cache.find(cur);
+    if (res == nullptr)
     {
+      d_eval_cache.insert(cur);
       visit.insert(visit.end(), cur.begin(), cur.end());
       continue;
     }
-    else if (it->second.is_null())
+    else if (res->is_null())
     {
       if (cur.num_children())
       {
-        it->second = _eval(node::utils::rebuild_node(nm(), cur, d_eval_cache));
+        Node evaluated = _eval(rebuild_node(d_eval_cache, cur));
+        d_eval_cache.insert(cur, evaluated);
       }
       else
       {
-        it->second = cur;
+        *res = cur;
       }
     }
     visit.pop_back();
   } while (!visit.empty());
-  assert(d_eval_cache.find(node) != d_eval_cache.end());
+  assert(!d_eval_cache.at(node).is_null());
   return d_eval_cache.at(node);
 }
 
-const Node&
+Node
 Rewriter::mk_node(node::Kind kind,
                   const std::vector<Node>& children,
                   const std::vector<uint64_t>& indices)
@@ -194,7 +211,7 @@ Rewriter::mk_node(node::Kind kind,
   auto [it, inserted] = d_rec_cache.insert(node);
   assert(inserted);  // Rewrite cycle detected if this fails.
 #endif
-  const Node& res = _rewrite(node);
+  Node res = _rewrite(node);
 #ifndef NDEBUG
   if (res.id() >= max_id)
   {
@@ -206,7 +223,7 @@ Rewriter::mk_node(node::Kind kind,
   return res;
 }
 
-const Node&
+Node
 Rewriter::invert_node(const Node& node)
 {
   assert(node.type().is_bool() || node.type().is_bv());
@@ -217,7 +234,7 @@ Rewriter::invert_node(const Node& node)
   return mk_node(node::Kind::BV_NOT, {node});
 }
 
-const Node&
+Node
 Rewriter::invert_node_if(bool condition, const Node& node)
 {
   assert(node.type().is_bool() || node.type().is_bv());
@@ -400,14 +417,30 @@ Rewriter::configure_parents_count(
 
 /* === Rewriter private ===================================================== */
 
-const Node&
+Node
+Rewriter::rebuild_node(RewriteCache& cache, const Node& node)
+{
+  std::vector<Node> children;
+  for (const Node& child : node)
+  {
+    assert(!cache.at(child).is_null());
+    children.push_back(cache.at(child));
+  }
+  return node::utils::rebuild_node(nm(), node, children);
+}
+
+Node
 Rewriter::_rewrite(const Node& node)
 {
   // Lookup rewrite cache
-  auto [it, inserted] = d_cache.emplace(node, Node());
-  if (!inserted && !it->second.is_null())
+  Node* cached = d_cache.find(node);
+  if (cached == nullptr)
+  {
+    d_cache.insert(node);
+  }
+  else if (!cached->is_null())
   {
-    return it->second;
+    return *cached;
   }
 
   // Limit rewrite recursion depth if we run into rewrite cycles in production
@@ -416,8 +449,7 @@ Rewriter::_rewrite(const Node& node)
   {
     assert(false);
     d_recursion_limit_reached = true;
-    it->second                = node;
-    return it->second;
+    return d_cache.insert(node, node);
   }
 
   // Normalize before rewriting
@@ -551,25 +583,23 @@ Rewriter::_rewrite(const Node& node)
   assert(!res.is_null());
   assert(res.type() == node.type());
 
-  // Get iterator again in case a recursive call changed the size of d_cache
-  // and invalidated the iterator.
-  it = d_cache.find(node);
-  assert(it != d_cache.end());
-  assert(it->second.is_null());
-
-  // Cache result
-  it->second = res;
-
-  return it->second;
+  // Cache result. Lookup again since recursive calls may have changed the
+  // cache.
+  assert(d_cache.at(node).is_null());
+  return d_cache.insert(node, res);
 }
 
-const Node&
+Node
 Rewriter::_eval(const Node& node)
 {
-  auto [it, inserted] = d_eval_cache.emplace(node, Node());
-  if (!inserted && !it->second.is_null())
+  Node* cached = d_eval_cache.find(node);
+  if (cached == nullptr)
+  {
+    d_eval_cache.insert(node);
+  }
+  else if (!cached->is_null())
   {
-    return it->second;
+    return *cached;
   }
 
   Node res;
@@ -960,15 +990,14 @@ Rewriter::_eval(const Node& node)
 
   assert(!res.is_null());
   assert(res.type() == node.type());
-  assert(it == d_eval_cache.find(node));
-  assert(it != d_eval_cache.end());
-  if (it->second.is_null())
+  Node& cached_res = d_eval_cache.at(node);
+  if (cached_res.is_null())
   {
     // cache result
-    it->second = res;
+    cached_res = res;
   }
-  assert(it->second == res);
-  return it->second;
+  assert(cached_res == res);
+  return cached_res;
 }
 
 /* Boolean rewrites --------------------------------------------------------- */
@@ -17,6 +17,7 @@
 #endif
 
 #include "node/node.h"
+#include "rewrite/rewrite_cache.h"
 #include "util/statistics.h"
 
 namespace bzla {
@@ -60,7 +61,7 @@ class Rewriter
    * @param node The node to rewrite.
    * @return The rewritten node or `node` if no rewrites applied.
    */
-  const Node& rewrite(const Node& node);
+  Node rewrite(const Node& node);
   /**
    * Evaluate given node.
    * @note Requires that all leaves of the given node are values.
@@ -76,23 +77,23 @@ class Rewriter
    * @param indices  The indices of the node to create.
    * @return The created, rewritten node.
    */
-  const Node& mk_node(node::Kind kind,
-                      const std::vector<Node>& children,
-                      const std::vector<uint64_t>& indices = {});
+  Node mk_node(node::Kind kind,
+               const std::vector<Node>& children,
+               const std::vector<uint64_t>& indices = {});
 
   /**
    * Helper to create an inverted Boolean or bit-vector node.
    * @param node The node to invert.
    * @return The inverted node.
    */
-  const Node& invert_node(const Node& node);
+  Node invert_node(const Node& node);
   /**
    * Helper to conditionally create an inverted Boolean or bit-vector node.
    * @param condition True to invert the given node.
    * @param node The node to invert.
    * @return The inverted node.
    */
-  const Node& invert_node_if(bool condition, const Node& node);
+  Node invert_node_if(bool condition, const Node& node);
 
   /**
    * @return True if given node corresponds to a (rewritten) OR node.
@@ -161,9 +162,16 @@ class Rewriter
   static constexpr uint64_t RECURSION_LIMIT = 4096;
 
   /** Helper for rewrite(). */
-  const Node& _rewrite(const Node& node);
+  Node _rewrite(const Node& node);
   /** Helper for eval(). */
-  const Node& _eval(const Node& node);
+  Node _eval(const Node& node);
+  /**
+   * Helper to rebuild given node with the cached results of its children.
+   * @param cache The cache, must contain results for all children of `node`.
+   * @param node  The node to rebuild.
+   * @return The rebuilt node.
+   */
+  Node rebuild_node(RewriteCache& cache, const Node& node);
 
   /* Core ---------------------------------------- */
   Node rewrite_eq(const Node& node);
@@ -286,7 +294,7 @@ class Rewriter
   /** True to enable rewriting, false to only enable operator elimination. */
   uint8_t d_level;
   /** Cache nodes rewritten during rewrite(), maps node to rewritten form. */
-  std::unordered_map<Node, Node> d_cache;
+  RewriteCache d_cache;
   /**
    * Cache nodes rewritten during eval(), maps node to rewritten form.
    * This points to the general rewriter cache (d_cache) if the rewrite level
@@ -295,7 +303,7 @@ class Rewriter
    *       duplicate eval work (and duplicate nodes between the 2 caches) for
    *       rwl >= 1.
    */
-  std::unordered_map<Node, Node>& d_eval_cache;
+  RewriteCache& d_eval_cache;
   /**
    * The actual eval cache.
    * This cache is only utilized if the rewrite level = 0 to avoid duplicate
@@ -303,7 +311,7 @@ class Rewriter
    * @note We need a separate cache from the rewriter cache for eval() to be
    *       able to evaluate nodes in case level 1 rewriting is disabled.
    */
-  std::unordered_map<Node, Node> d_eval_cache_aux;
+  RewriteCache d_eval_cache_aux;
 #ifndef NDEBUG
   /** Cache for detecting rewrite cycles in debug mode. */
   std::unordered_set<Node> d_rec_cache;
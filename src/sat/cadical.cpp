@@ -10,6 +10,8 @@
 
 #include "sat/cadical.h"
 
+#include <cassert>
+
 namespace bzla::sat {
 
 /* CadicalTerminator public ------------------------------------------------- */
@@ -26,6 +28,50 @@ CadicalTerminator::terminate()
   return d_terminator->terminate();
 }
 
+/* CadicalPropagator public ------------------------------------------------- */
+
+CadicalPropagator::CadicalPropagator(Propagator* propagator)
+    : CaDiCaL::ExternalPropagator(), d_propagator(propagator)
+{
+  is_lazy = propagator->is_lazy();
+}
+
+void
+CadicalPropagator::notify_assignment(int lit, bool is_fixed)
+{
+  d_propagator->notify_assignment(lit, is_fixed);
+}
+
+void
+CadicalPropagator::notify_new_decision_level()
+{
+  d_propagator->notify_new_decision_level();
+}
+
+void
+CadicalPropagator::notify_backtrack(size_t new_level)
+{
+  d_propagator->notify_backtrack(new_level);
+}
+
+bool
+CadicalPropagator::cb_check_found_model(const std::vector<int>& model)
+{
+  return d_propagator->check_model(model);
+}
+
+bool
+CadicalPropagator::cb_has_external_clause()
+{
+  return d_propagator->has_clause();
+}
+
+int
+CadicalPropagator::cb_add_external_clause_lit()
+{
+  return d_propagator->next_clause_lit();
+}
+
 /* Cadical public ----------------------------------------------------------- */
 
 Cadical::Cadical()
@@ -91,6 +137,28 @@ Cadical::configure_terminator(Terminator* terminator)
   }
 }
 
+void
+Cadical::connect_propagator(Propagator* propagator)
+{
+  if (propagator)
+  {
+    d_prop.reset(new CadicalPropagator(propagator));
+    d_solver->connect_external_propagator(d_prop.get());
+  }
+  else
+  {
+    d_solver->disconnect_external_propagator();
+    d_prop.reset();
+  }
+}
+
+void
+Cadical::add_observed_var(int32_t var)
+{
+  assert(d_prop);
+  d_solver->add_observed_var(var);
+}
+
 const char *
 Cadical::get_version() const
 {
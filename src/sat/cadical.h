@@ -30,6 +30,23 @@ class CadicalTerminator : public CaDiCaL::Terminator
   bzla::Terminator* d_terminator = nullptr;
 };
 
+class CadicalPropagator : public CaDiCaL::ExternalPropagator
+{
+ public:
+  CadicalPropagator(Propagator* propagator);
+  ~CadicalPropagator() {}
+
+  void notify_assignment(int lit, bool is_fixed) override;
+  void notify_new_decision_level() override;
+  void notify_backtrack(size_t new_level) override;
+  bool cb_check_found_model(const std::vector<int>& model) override;
+  bool cb_has_external_clause() override;
+  int cb_add_external_clause_lit() override;
+
+ private:
+  Propagator* d_propagator = nullptr;
+};
+
 class Cadical : public SatSolver
 {
  public:
@@ -42,12 +59,16 @@ class Cadical : public SatSolver
   int32_t fixed(int32_t lit) override;
   Result solve() override;
   void configure_terminator(Terminator* terminator) override;
+  bool supports_propagator() const override { return true; }
+  void connect_propagator(Propagator* propagator) override;
+  void add_observed_var(int32_t var) override;
   const char *get_name() const override { return "CaDiCaL"; }
   const char *get_version() const override;
 
  private:
   std::unique_ptr<CaDiCaL::Solver> d_solver   = nullptr;
   std::unique_ptr<CaDiCaL::Terminator> d_term = nullptr;
+  std::unique_ptr<CadicalPropagator> d_prop   = nullptr;
 };
 
 }  // namespace bzla::sat
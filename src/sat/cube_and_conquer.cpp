@@ -0,0 +1,328 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "sat/cube_and_conquer.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+#include "sat/sat_solver_factory.h"
+#include "util/exceptions.h"
+
+namespace bzla::sat {
+
+using namespace std::chrono_literals;
+
+/* --- CubeAndConquer public ----------------------------------------------- */
+
+CubeAndConquer::CubeAndConquer(const option::Options& options)
+    : d_options(options), d_num_threads(options.nthreads()), d_done(false)
+{
+  assert(d_num_threads > 0);
+  d_worker_terminator.reset(new WorkerTerminator(d_done));
+  // The first worker is always created, it provides fixed() and the version.
+  new_worker();
+}
+
+CubeAndConquer::~CubeAndConquer() {}
+
+void
+CubeAndConquer::add(int32_t lit)
+{
+  size_t var = std::abs(lit);
+  if (var >= d_vars.size())
+  {
+    d_vars.resize(var + 1, false);
+  }
+  d_vars[var] = true;
+  d_clauses.push_back(lit);
+}
+
+void
+CubeAndConquer::assume(int32_t lit)
+{
+  d_assumptions.push_back(lit);
+}
+
+int32_t
+CubeAndConquer::value(int32_t lit)
+{
+  if (d_winner == nullptr)
+  {
+    return 0;
+  }
+  return d_winner->d_solver->value(lit);
+}
+
+bool
+CubeAndConquer::failed(int32_t lit)
+{
+  return d_failed.find(lit) != d_failed.end();
+}
+
+int32_t
+CubeAndConquer::fixed(int32_t lit)
+{
+  // Literals fixed by any worker are implied by (a subset of) the formula.
+  return d_workers[0]->d_solver->fixed(lit);
+}
+
+Result
+CubeAndConquer::solve()
+{
+  d_last_assumptions = std::move(d_assumptions);
+  d_assumptions.clear();
+  d_winner          = nullptr;
+  d_unsat           = false;
+  d_num_unsat_cubes = 0;
+  d_failed.clear();
+  d_exception = nullptr;
+  d_done      = false;
+
+  uint64_t num_cubes = uint64_t(1) << d_split_vars.size();
+  size_t num_workers = std::min<uint64_t>(d_num_threads, num_cubes);
+  while (d_workers.size() < num_workers)
+  {
+    new_worker();
+  }
+  // Distribute cubes round-robin, work stealing balances the load.
+  for (uint64_t i = 0; i < num_cubes; ++i)
+  {
+    d_workers[i % num_workers]->d_cubes.push_back(i);
+  }
+
+  d_num_active  = num_workers;
+  d_num_running = num_workers;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_workers; ++i)
+  {
+    threads.emplace_back(&CubeAndConquer::run, this, i);
+  }
+
+  // The terminator configured via configure_terminator() is only queried from
+  // this thread and forwarded to the workers via d_done.
+  {
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (d_num_running > 0 && !d_done)
+    {
+      d_cv.wait_for(lock, 10ms);
+      if (d_terminator && d_terminator->terminate())
+      {
+        d_done = true;
+      }
+    }
+    d_done = true;
+  }
+
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+  for (auto& w : d_workers)
+  {
+    w->d_cubes.clear();
+  }
+  d_num_cubes_solved = d_num_unsat_cubes + (d_winner != nullptr ? 1 : 0);
+  d_split_vars.clear();
+
+  if (d_exception)
+  {
+    std::rethrow_exception(d_exception);
+  }
+
+  if (d_winner)
+  {
+    return Result::SAT;
+  }
+  if (d_unsat || d_num_unsat_cubes == num_cubes)
+  {
+    return Result::UNSAT;
+  }
+  return Result::UNKNOWN;
+}
+
+void
+CubeAndConquer::configure_terminator(Terminator* terminator)
+{
+  d_terminator = terminator;
+}
+
+const char*
+CubeAndConquer::get_version() const
+{
+  return d_workers[0]->d_solver->get_version();
+}
+
+void
+CubeAndConquer::set_split_vars(const std::vector<int32_t>& vars)
+{
+  d_split_vars.clear();
+  for (int32_t var : vars)
+  {
+    if (has_var(var))
+    {
+      d_split_vars.push_back(var);
+    }
+  }
+}
+
+bool
+CubeAndConquer::has_var(int32_t var) const
+{
+  assert(var > 0);
+  return static_cast<size_t>(var) < d_vars.size() && d_vars[var];
+}
+
+/* --- CubeAndConquer private ---------------------------------------------- */
+
+void
+CubeAndConquer::new_worker()
+{
+  auto& w = d_workers.emplace_back(new Worker());
+  w->d_solver.reset(new_sat_solver(d_options));
+  try
+  {
+    w->d_solver->configure_terminator(d_worker_terminator.get());
+  }
+  catch (const Unsupported&)
+  {
+    // The worker only checks d_done between cubes.
+  }
+}
+
+void
+CubeAndConquer::run(size_t id)
+{
+  try
+  {
+    solve_cubes(id);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (!d_exception)
+    {
+      d_exception = std::current_exception();
+    }
+    d_done = true;
+  }
+
+  std::lock_guard<std::mutex> lock(d_mutex);
+  --d_num_running;
+  d_cv.notify_one();
+}
+
+void
+CubeAndConquer::solve_cubes(size_t id)
+{
+  Worker& worker = *d_workers[id];
+  SatSolver& solver = *worker.d_solver;
+
+  // Add clauses that were added since the last solve() call.
+  for (size_t size = d_clauses.size(); worker.d_num_synced < size;
+       ++worker.d_num_synced)
+  {
+    solver.add(d_clauses[worker.d_num_synced]);
+  }
+
+  uint64_t cube;
+  while (!d_done && next_cube(id, cube))
+  {
+    std::vector<int32_t> lits;
+    for (size_t i = 0, n = d_split_vars.size(); i < n; ++i)
+    {
+      lits.push_back((cube >> i) & 1 ? d_split_vars[i] : -d_split_vars[i]);
+    }
+    for (int32_t lit : d_last_assumptions)
+    {
+      solver.assume(lit);
+    }
+    for (int32_t lit : lits)
+    {
+      solver.assume(lit);
+    }
+
+    Result res = solver.solve();
+    if (res == Result::UNKNOWN)
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (res == Result::SAT)
+    {
+      if (d_winner == nullptr)
+      {
+        d_winner = &worker;
+      }
+      d_done = true;
+      return;
+    }
+
+    ++d_num_unsat_cubes;
+    for (int32_t lit : d_last_assumptions)
+    {
+      if (solver.failed(lit))
+      {
+        d_failed.insert(lit);
+      }
+    }
+    bool cube_failed = false;
+    for (int32_t lit : lits)
+    {
+      if (solver.failed(lit))
+      {
+        cube_failed = true;
+        break;
+      }
+    }
+    if (!cube_failed)
+    {
+      // The cube was not needed to derive unsatisfiability, hence all other
+      // cubes are unsatisfiable, too.
+      d_unsat = true;
+      d_done  = true;
+      return;
+    }
+  }
+}
+
+bool
+CubeAndConquer::next_cube(size_t id, uint64_t& cube)
+{
+  // Pop from the back of the own queue.
+  {
+    Worker& worker = *d_workers[id];
+    std::lock_guard<std::mutex> lock(worker.d_mutex);
+    if (!worker.d_cubes.empty())
+    {
+      cube = worker.d_cubes.back();
+      worker.d_cubes.pop_back();
+      return true;
+    }
+  }
+  // Steal from the front of the other queues.
+  for (size_t i = 1; i < d_num_active; ++i)
+  {
+    Worker& victim = *d_workers[(id + i) % d_num_active];
+    std::lock_guard<std::mutex> lock(victim.d_mutex);
+    if (!victim.d_cubes.empty())
+    {
+      cube = victim.d_cubes.front();
+      victim.d_cubes.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace bzla::sat
@@ -0,0 +1,174 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_SAT_CUBE_AND_CONQUER_H_INCLUDED
+#define BZLA_SAT_CUBE_AND_CONQUER_H_INCLUDED
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "option/option.h"
+#include "sat/sat_solver.h"
+#include "terminator.h"
+
+namespace bzla::sat {
+
+/**
+ * Cube-and-conquer SAT solver.
+ *
+ * Splits the search space into 2^n cubes over n configured splitting
+ * variables (see set_split_vars()) and solves each cube as a set of
+ * assumptions. Cubes are solved on a pool of threads, each of which owns an
+ * incremental SAT solver instance of the configured SAT solver (see
+ * new_sat_solver()) that is kept across solve() calls. Each thread has its
+ * own queue of cubes, idle threads steal cubes from the queues of other
+ * threads. SAT solvers that do not support terminators finish their current
+ * cube when another thread determined the result.
+ *
+ * The formula is recorded on add() and replayed into the thread-local SAT
+ * solvers on the next solve() call.
+ */
+class CubeAndConquer : public SatSolver
+{
+ public:
+  /**
+   * Constructor.
+   * @param options The options, determines the SAT solver of each thread and
+   *                the number of threads (option nthreads).
+   */
+  CubeAndConquer(const option::Options& options);
+  ~CubeAndConquer();
+
+  void add(int32_t lit) override;
+  void assume(int32_t lit) override;
+  int32_t value(int32_t lit) override;
+  bool failed(int32_t lit) override;
+  int32_t fixed(int32_t lit) override;
+  Result solve() override;
+  void configure_terminator(Terminator* terminator) override;
+  const char* get_name() const override { return "CubeAndConquer"; }
+  const char* get_version() const override;
+
+  /**
+   * Set the splitting variables for the next solve() call.
+   * @param vars The variables to split on, variables that do not occur in
+   *             the formula are ignored.
+   */
+  void set_split_vars(const std::vector<int32_t>& vars);
+
+  /**
+   * Determine whether given variable occurs in the formula.
+   * @param var The variable.
+   * @return True if `var` occurs in an added clause.
+   */
+  bool has_var(int32_t var) const;
+
+  /** @return The number of cubes solved in the last solve() call. */
+  uint64_t num_cubes_solved() const { return d_num_cubes_solved; }
+
+ private:
+  /** Terminator for the SAT solvers of the workers. */
+  class WorkerTerminator : public Terminator
+  {
+   public:
+    WorkerTerminator(std::atomic<bool>& done) : d_done(done) {}
+    bool terminate() override { return d_done.load(); }
+
+   private:
+    std::atomic<bool>& d_done;
+  };
+
+  struct Worker
+  {
+    /** The SAT solver of this worker. */
+    std::unique_ptr<SatSolver> d_solver;
+    /** The number of literals of d_clauses added to d_solver. */
+    size_t d_num_synced = 0;
+    /** The queue of cubes, given as cube indices. */
+    std::deque<uint64_t> d_cubes;
+    /** Protects d_cubes. */
+    std::mutex d_mutex;
+  };
+
+  /** Create a new worker with a SAT solver configured via d_options. */
+  void new_worker();
+  /** Main function of worker thread, calls solve_cubes(). */
+  void run(size_t id);
+  /**
+   * Solve cubes of given worker until all cubes are solved or the result is
+   * determined.
+   * @param id The worker id.
+   */
+  void solve_cubes(size_t id);
+  /**
+   * Get next cube for given worker, steal from other workers if the queue of
+   * the worker is empty.
+   * @param id   The worker id.
+   * @param cube Output parameter for the cube index.
+   * @return False if all queues are empty.
+   */
+  bool next_cube(size_t id, uint64_t& cube);
+
+  /** The options. */
+  const option::Options& d_options;
+  /** The number of threads. */
+  size_t d_num_threads;
+  /** The workers, kept across solve() calls. */
+  std::vector<std::unique_ptr<Worker>> d_workers;
+  /** The number of workers used in the current solve() call. */
+  size_t d_num_active = 0;
+
+  /** The clauses of the formula, 0-terminated. */
+  std::vector<int32_t> d_clauses;
+  /** Indicates whether a variable occurs in d_clauses. */
+  std::vector<bool> d_vars;
+  /** The assumptions for the next solve() call. */
+  std::vector<int32_t> d_assumptions;
+  /** The assumptions of the last solve() call. */
+  std::vector<int32_t> d_last_assumptions;
+  /** The splitting variables for the next solve() call. */
+  std::vector<int32_t> d_split_vars;
+
+  /** The terminator configured via configure_terminator(). */
+  Terminator* d_terminator = nullptr;
+  /** Terminator for the SAT solvers of the workers. */
+  std::unique_ptr<WorkerTerminator> d_worker_terminator;
+  /** Indicates whether workers should terminate. */
+  std::atomic<bool> d_done;
+
+  /** Protects d_num_running and the result members below. */
+  std::mutex d_mutex;
+  /** Notifies the main thread about terminated workers. */
+  std::condition_variable d_cv;
+  /** The number of currently running workers. */
+  size_t d_num_running = 0;
+  /** The worker that found a satisfying assignment. */
+  Worker* d_winner = nullptr;
+  /** True if a worker proved unsatisfiability independent of its cube. */
+  bool d_unsat = false;
+  /** The number of cubes shown to be unsatisfiable. */
+  uint64_t d_num_unsat_cubes = 0;
+  /** The number of cubes solved in the last solve() call. */
+  uint64_t d_num_cubes_solved = 0;
+  /** The union of failed assumptions over all unsatisfiable cubes. */
+  std::unordered_set<int32_t> d_failed;
+  /** The first exception thrown by a worker, rethrown by solve(). */
+  std::exception_ptr d_exception;
+};
+
+}  // namespace bzla::sat
+
+#endif
@@ -11,13 +11,66 @@
 #ifndef BZLA_SAT_SAT_SOLVER_H_INCLUDED
 #define BZLA_SAT_SAT_SOLVER_H_INCLUDED
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 #include "solver/result.h"
 #include "terminator.h"
 
 namespace bzla::sat {
 
+/**
+ * Interface for external propagators that observe the search of a SAT solver
+ * and lazily add clauses during search (CDCL(T)-style).
+ *
+ * Callbacks are only issued for variables registered via
+ * SatSolver::add_observed_var().
+ */
+class Propagator
+{
+ public:
+  virtual ~Propagator(){};
+
+  /**
+   * @return True if the propagator only checks complete assignments via
+   *         check_model(), i.e., does not require notifications about partial
+   *         assignments.
+   */
+  virtual bool is_lazy() const { return false; }
+
+  /**
+   * Notification that an observed literal was assigned.
+   * @param lit   The assigned literal.
+   * @param fixed True if the literal is assigned at decision level 0.
+   */
+  virtual void notify_assignment(int32_t lit, bool fixed)
+  {
+    (void) lit;
+    (void) fixed;
+  }
+  /** Notification that a new decision level was opened. */
+  virtual void notify_new_decision_level() {}
+  /**
+   * Notification that the SAT solver backtracked.
+   * @param level The decision level the solver backtracked to.
+   */
+  virtual void notify_backtrack(size_t level) { (void) level; }
+
+  /**
+   * Check complete assignment found by the SAT solver.
+   * @param model The assignment of all observed variables, given as literals.
+   * @return False if the assignment is rejected, in which case at least one
+   *         clause must be provided via has_clause() and next_clause_lit().
+   */
+  virtual bool check_model(const std::vector<int32_t>& model) = 0;
+
+  /** @return True if the propagator has a clause to add. */
+  virtual bool has_clause() = 0;
+  /** @return The next literal of the current clause, 0 terminates it. */
+  virtual int32_t next_clause_lit() = 0;
+};
+
 class SatSolver
 {
  public:
@@ -67,6 +120,24 @@ class SatSolver
    */
   virtual void configure_terminator(Terminator *terminator) = 0;
 
+  /**
+   * Determine whether this SAT solver supports external propagators.
+   * @return True if connect_propagator() is supported.
+   */
+  virtual bool supports_propagator() const { return false; }
+  /**
+   * Connect an external propagator.
+   * @note Only supported if supports_propagator() is true.
+   * @param propagator The propagator, nullptr to disconnect.
+   */
+  virtual void connect_propagator(Propagator *propagator) { (void) propagator; }
+  /**
+   * Register variable to be observed by the connected propagator.
+   * @note Requires a connected propagator.
+   * @param var The variable to observe.
+   */
+  virtual void add_observed_var(int32_t var) { (void) var; }
+
   // virtual int32_t repr(int32_t) = 0;
 
   /**
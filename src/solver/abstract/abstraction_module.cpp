@@ -210,6 +210,8 @@ AbstractionModule::check()
 
   d_added_lemma = false;
 
+  simulate_lemmas();
+
   // New abstraction may be added while checking
   for (size_t i = 0; i < d_active_abstractions.size(); ++i)
   {
@@ -248,6 +250,7 @@ AbstractionModule::check()
     }
   }
   d_lemma_buffer.clear();
+  d_lemma_sim.clear();
 }
 
 const Node&
@@ -444,6 +447,149 @@ AbstractionModule::check_lemma(const AbstractionLemma* lem,
   return false;
 }
 
+const AbstractionModule::LemmaCircuits&
+AbstractionModule::lemma_circuits(Kind kind, uint64_t bv_size)
+{
+  auto [it, inserted] = d_lemma_circuits.try_emplace(
+      std::make_pair(static_cast<uint64_t>(kind), bv_size));
+  if (inserted)
+  {
+    if (d_lemma_bitblaster == nullptr)
+    {
+      d_lemma_bitblaster.reset(new bv::AigBitblaster());
+    }
+    NodeManager& nm   = d_env.nm();
+    Type type         = nm.mk_bv_type(bv_size);
+    Node x            = nm.mk_const(type);
+    Node s            = nm.mk_const(type);
+    Node t            = nm.mk_const(type);
+    LemmaCircuits& lc = it->second;
+    for (const Node& input : {x, s, t})
+    {
+      d_lemma_bitblaster->bitblast(input);
+      lc.d_inputs.push_back(d_lemma_bitblaster->bits(input));
+    }
+    // Lemmas without instance are represented as null nodes, which must not
+    // be copied on reallocation.
+    lc.d_lemmas.reserve(d_abstr_lemmas.at(kind).size());
+    for (const auto& lem : d_abstr_lemmas.at(kind))
+    {
+      Node inst = lem->instance(x, s, t);
+      if (inst.is_null())
+      {
+        lc.d_lemmas.emplace_back();
+        continue;
+      }
+      inst = d_rewriter.rewrite(inst);
+      d_lemma_bitblaster->bitblast(inst);
+      assert(d_lemma_bitblaster->bits(inst).size() == 1);
+      lc.d_lemmas.push_back(d_lemma_bitblaster->bits(inst)[0]);
+    }
+  }
+  return it->second;
+}
+
+void
+AbstractionModule::simulate_lemmas()
+{
+  NodeManager& nm = d_env.nm();
+
+  // Collect abstractions with inconsistent assignment, grouped by kind and
+  // bit-width.
+  std::unordered_map<std::pair<uint64_t, uint64_t>, std::vector<Node>> groups;
+  for (size_t i = 0, size = d_active_abstractions.size(); i < size; ++i)
+  {
+    const Node& abstr = d_active_abstractions[i];
+    if (!d_solver_state.is_relevant(abstr))
+    {
+      continue;
+    }
+    auto it = d_abstractions_rev.find(abstr);
+    assert(it != d_abstractions_rev.end());
+    Kind kind = it->second.kind();
+    if (kind == Kind::ITE || d_abstr_lemmas.at(kind).empty())
+    {
+      continue;
+    }
+
+    LemmaSimulation& ls = d_lemma_sim[abstr];
+    ls.d_val_x          = d_solver_state.value(abstr[1]);
+    ls.d_val_s          = d_solver_state.value(abstr[2]);
+    ls.d_val_t          = d_solver_state.value(abstr);
+    ls.d_val_expected =
+        d_rewriter.eval(nm.mk_node(kind, {ls.d_val_x, ls.d_val_s}));
+    if (!d_opt_value_inst_only && ls.d_val_t != ls.d_val_expected)
+    {
+      groups[{static_cast<uint64_t>(kind), abstr.type().bv_size()}]
+          .push_back(abstr);
+    }
+  }
+
+  // Two patterns per abstraction, (x, s, t) and (s, x, t).
+  const size_t batch_size = bitblast::AigSimulator::NUM_PATTERNS / 2;
+  for (const auto& [key, abstrs] : groups)
+  {
+    const LemmaCircuits& lc =
+        lemma_circuits(static_cast<Kind>(key.first), key.second);
+    for (size_t lo = 0, size = abstrs.size(); lo < size; lo += batch_size)
+    {
+      size_t hi = std::min(size, lo + batch_size);
+      std::vector<LemmaSimulation*> batch;
+      for (size_t j = lo; j < hi; ++j)
+      {
+        batch.push_back(&d_lemma_sim.at(abstrs[j]));
+      }
+
+      // Bits are stored with the most significant bit first.
+      for (size_t k = 0; k < 3; ++k)
+      {
+        const auto& bits = lc.d_inputs[k];
+        for (size_t i = 0, n = bits.size(); i < n; ++i)
+        {
+          uint64_t word = 0;
+          for (size_t j = 0; j < batch.size(); ++j)
+          {
+            const Node& val0 = k == 0   ? batch[j]->d_val_x
+                               : k == 1 ? batch[j]->d_val_s
+                                        : batch[j]->d_val_t;
+            const Node& val1 = k == 0   ? batch[j]->d_val_s
+                               : k == 1 ? batch[j]->d_val_x
+                                        : batch[j]->d_val_t;
+            word |= static_cast<uint64_t>(
+                        val0.value<BitVector>().bit(n - 1 - i))
+                    << (2 * j);
+            word |= static_cast<uint64_t>(
+                        val1.value<BitVector>().bit(n - 1 - i))
+                    << (2 * j + 1);
+          }
+          d_lemma_simulator.set(bits[i], word);
+        }
+      }
+
+      for (LemmaSimulation* ls : batch)
+      {
+        ls->d_satisfied.assign(lc.d_lemmas.size(), 0);
+      }
+      for (size_t l = 0, n = lc.d_lemmas.size(); l < n; ++l)
+      {
+        const bitblast::AigNode& lemma = lc.d_lemmas[l];
+        if (lemma.get_id() == 0)
+        {
+          continue;
+        }
+        uint64_t word = d_lemma_simulator.simulate(lemma);
+        for (size_t j = 0; j < batch.size(); ++j)
+        {
+          uint8_t sat = (word >> (2 * j)) & 3;
+          batch[j]->d_satisfied[l] = sat;
+          d_stats.num_sim_checks += 1;
+          d_stats.num_sim_satisfied += sat & 1;
+        }
+      }
+    }
+  }
+}
+
 void
 AbstractionModule::check_term_abstraction(const Node& abstr)
 {
@@ -462,14 +608,29 @@ AbstractionModule::check_term_abstraction(const Node& abstr)
     return;
   }
 
-  NodeManager& nm   = d_env.nm();
-  const Node& x     = abstr[1];
-  const Node& s     = abstr[2];
-  const Node& t     = abstr;
-  Node val_x        = d_solver_state.value(x);
-  Node val_s        = d_solver_state.value(s);
-  Node val_t        = d_solver_state.value(t);
-  Node val_expected = d_rewriter.eval(nm.mk_node(kind, {val_x, val_s}));
+  NodeManager& nm = d_env.nm();
+  const Node& x   = abstr[1];
+  const Node& s   = abstr[2];
+  const Node& t   = abstr;
+  Node val_x, val_s, val_t, val_expected;
+  const std::vector<uint8_t>* satisfied = nullptr;
+
+  auto its = d_lemma_sim.find(abstr);
+  if (its != d_lemma_sim.end())
+  {
+    val_x        = its->second.d_val_x;
+    val_s        = its->second.d_val_s;
+    val_t        = its->second.d_val_t;
+    val_expected = its->second.d_val_expected;
+    satisfied    = &its->second.d_satisfied;
+  }
+  else
+  {
+    val_x        = d_solver_state.value(x);
+    val_s        = d_solver_state.value(s);
+    val_t        = d_solver_state.value(t);
+    val_expected = d_rewriter.eval(nm.mk_node(kind, {val_x, val_s}));
+  }
 
   if (val_t == val_expected)
   {
@@ -490,10 +651,14 @@ AbstractionModule::check_term_abstraction(const Node& abstr)
     auto it = d_abstr_lemmas.find(kind);
     assert(it != d_abstr_lemmas.end());
     const auto& to_check = it->second;
-    for (const auto& lem : to_check)
+    for (size_t i = 0, size = to_check.size(); i < size; ++i)
     {
-      added_lemma = check_lemma(lem.get(), val_x, val_s, val_t, x, s, t);
-      if (!added_lemma && KindInfo::is_commutative(kind))
+      const auto& lem = to_check[i];
+      // Lemmas satisfied under the current model do not need to be checked.
+      uint8_t sat = satisfied && i < satisfied->size() ? (*satisfied)[i] : 0;
+      added_lemma = !(sat & 1)
+                    && check_lemma(lem.get(), val_x, val_s, val_t, x, s, t);
+      if (!added_lemma && KindInfo::is_commutative(kind) && !(sat & 2))
       {
         added_lemma = check_lemma(lem.get(), val_s, val_x, val_t, s, x, t);
       }
@@ -1150,6 +1315,9 @@ AbstractionModule::Statistics::Statistics(util::Statistics& stats,
                                           const std::string& prefix)
     : num_terms(stats.new_stat<uint64_t>(prefix + "terms::total")),
       num_checks(stats.new_stat<uint64_t>(prefix + "num_checks")),
+      num_sim_checks(stats.new_stat<uint64_t>(prefix + "sim::num_checks")),
+      num_sim_satisfied(
+          stats.new_stat<uint64_t>(prefix + "sim::num_satisfied")),
       terms(stats.new_stat<util::HistogramStatistic>(prefix + "terms")),
       lemmas(stats.new_stat<util::HistogramStatistic>(prefix + "lemmas")),
       time_check(stats.new_stat<util::TimerStatistic>(prefix + "time_check"))
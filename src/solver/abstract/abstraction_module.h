@@ -5,10 +5,16 @@
 
 #include "backtrack/unordered_set.h"
 #include "backtrack/vector.h"
+#include "bitblast/aig/aig_simulator.h"
 #include "env.h"
 #include "solver/solver_state.h"
+#include "util/hash_pair.h"
 #include "util/logger.h"
 
+namespace bzla::bv {
+class AigBitblaster;
+}
+
 namespace bzla::abstract {
 
 class AbstractionLemma;
@@ -56,6 +62,36 @@ class AbstractionModule
   /** @return Abstraction UF for given node based on its type and kind. */
   const Node& abstr_uf(const Node& node);
 
+  /** Bit-blasted lemma instances over fresh x, s and t of some bit-width. */
+  struct LemmaCircuits
+  {
+    /** The bits of x, s and t. */
+    std::vector<std::vector<bitblast::AigNode>> d_inputs;
+    /**
+     * The bit-blasted instance of each lemma in d_abstr_lemmas of the
+     * abstracted kind, a null node if the lemma depends on values.
+     */
+    std::vector<bitblast::AigNode> d_lemmas;
+  };
+
+  /**
+   * Get the bit-blasted lemma instances for given kind and bit-width, created
+   * on first request.
+   * @param kind    The kind of the abstracted terms.
+   * @param bv_size The bit-width of the abstracted terms.
+   * @return The lemma circuits.
+   */
+  const LemmaCircuits& lemma_circuits(node::Kind kind, uint64_t bv_size);
+  /**
+   * Compute the values of all relevant abstractions and evaluate the lemmas
+   * of abstractions with inconsistent assignment under the current model.
+   * Lemmas are evaluated by simulating the bit-blasted lemma instances for
+   * up to 32 abstractions (and their commutative variants) in parallel,
+   * which is significantly cheaper than instantiating and evaluating each
+   * lemma separately. Populates d_lemma_sim.
+   */
+  void simulate_lemmas();
+
   /** Check assignment of abstraction and add lemma if needed. */
   void check_term_abstraction(const Node& abstr);
   /** Check assignment of ITE abstraction and lazily expand if needed. */
@@ -126,6 +162,30 @@ class AbstractionModule
   /** Caches lemmas sent to solver engine. */
   backtrack::unordered_set<Node> d_lemma_cache;
 
+  /** Bit-blaster for lemma circuits, created on demand. */
+  std::unique_ptr<bv::AigBitblaster> d_lemma_bitblaster;
+  /** Maps kind and bit-width of abstracted terms to their lemma circuits. */
+  std::unordered_map<std::pair<uint64_t, uint64_t>, LemmaCircuits>
+      d_lemma_circuits;
+  /** Simulator for lemma circuits. */
+  bitblast::AigSimulator d_lemma_simulator;
+  /** Model values of an abstraction and the lemmas satisfied under them. */
+  struct LemmaSimulation
+  {
+    Node d_val_x;
+    Node d_val_s;
+    Node d_val_t;
+    /** The expected value of t, i.e., the value of (kind val_x val_s). */
+    Node d_val_expected;
+    /**
+     * Indexed as the lemmas in d_abstr_lemmas, bit 0 is set if
+     * lemma(x, s, t) is satisfied and bit 1 if lemma(s, x, t) is satisfied.
+     */
+    std::vector<uint8_t> d_satisfied;
+  };
+  /** Maps abstractions to their values in the current check(). */
+  std::unordered_map<Node, LemmaSimulation> d_lemma_sim;
+
   /** Indicates whether lemma was added during check(). */
   bool d_added_lemma;
 
@@ -149,6 +209,8 @@ class AbstractionModule
     Statistics(util::Statistics& stats, const std::string& prefix);
     uint64_t& num_terms;
     uint64_t& num_checks;
+    uint64_t& num_sim_checks;
+    uint64_t& num_sim_satisfied;
     util::HistogramStatistic& terms;
     util::HistogramStatistic& lemmas;
     util::TimerStatistic& time_check;
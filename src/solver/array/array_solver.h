@@ -16,6 +16,7 @@
 
 #include "backtrack/unordered_set.h"
 #include "backtrack/vector.h"
+#include "node/node_map.h"
 #include "solver/solver.h"
 #include "util/logger.h"
 #include "util/statistics.h"
@@ -197,7 +198,7 @@ class ArraySolver : public Solver
    * Maps array terms to their array parents, used for upwards propagation.
    * @note This map is computed in compute_parents().
    */
-  std::unordered_map<Node, std::vector<Node>> d_parents;
+  node::NodeMap<std::vector<Node>> d_parents;
   /** Currently active parents. */
   backtrack::unordered_set<Node> d_active_parents;
   /**
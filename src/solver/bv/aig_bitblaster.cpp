@@ -30,6 +30,10 @@ AigBitblaster::bitblast(const Node& t)
     if (it == d_bitblaster_cache.end())
     {
       d_bitblaster_cache.emplace(cur, bitblast::AigBitblaster::Bits());
+      if (!d_trail_sizes.empty())
+      {
+        d_trail.push_back(cur);
+      }
       if (!BvSolver::is_leaf(cur))
       {
         visit.insert(visit.end(), cur.begin(), cur.end());
@@ -205,10 +209,52 @@ AigBitblaster::bits(const Node& term) const
   return d_bitblaster_cache.at(term);
 }
 
+void
+AigBitblaster::set_bits(const Node& term,
+                        const bitblast::AigBitblaster::Bits& bits)
+{
+  assert(bits.size() == (term.type().is_bool() ? 1 : term.type().bv_size()));
+  auto [it, inserted] = d_bitblaster_cache.emplace(term, bits);
+  assert(inserted || it->second.empty());
+  if (!inserted)
+  {
+    it->second = bits;
+  }
+  else if (!d_trail_sizes.empty())
+  {
+    d_trail.push_back(term);
+  }
+}
+
+void
+AigBitblaster::push()
+{
+  d_trail_sizes.push_back(d_trail.size());
+}
+
+void
+AigBitblaster::pop()
+{
+  assert(!d_trail_sizes.empty());
+  size_t size = d_trail_sizes.back();
+  d_trail_sizes.pop_back();
+  while (d_trail.size() > size)
+  {
+    d_bitblaster_cache.erase(d_trail.back());
+    d_trail.pop_back();
+  }
+}
+
+bitblast::AigNode
+AigBitblaster::mk_true()
+{
+  return d_bitblaster.bv_value(BitVector::mk_true())[0];
+}
+
 uint64_t
-AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
+AigBitblaster::count_aig_ands(const Node& term, AigNodeSet& cache)
 {
-  std::vector<std::reference_wrapper<const bitblast::AigNode>> visit;
+  std::vector<bitblast::AigNode> visit;
   bitblast(term);
   const auto& b = bits(term);
   visit.insert(visit.end(), b.begin(), b.end());
@@ -217,7 +263,7 @@ AigBitblaster::count_aig_ands(const Node& term, AigNodeRefSet& cache)
   uint64_t res = 0;
   do
   {
-    const bitblast::AigNode& cur = visit.back();
+    bitblast::AigNode cur = visit.back();
     visit.pop_back();
 
     if (cache.insert(cur).second)
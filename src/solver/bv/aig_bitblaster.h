@@ -11,20 +11,20 @@
 #ifndef BZLA_SOLVER_BV_AIG_BITBLASTER_H_INCLUDED
 #define BZLA_SOLVER_BV_AIG_BITBLASTER_H_INCLUDED
 
-#include <unordered_set>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "bitblast/aig_bitblaster.h"
 #include "node/node.h"
+#include "node/node_map.h"
 
 namespace bzla::bv {
 
 class AigBitblaster
 {
  public:
-  using AigNodeRefSet =
-      std::unordered_set<std::reference_wrapper<const bitblast::AigNode>,
-                         std::hash<bitblast::AigNode>>;
+  using AigNodeSet = std::unordered_set<bitblast::AigNode>;
 
   /** Recursively bit-blast `term`. */
   void bitblast(const Node& term);
@@ -32,8 +32,38 @@ class AigBitblaster
   /** Return encoded bits associated with bit-blasted term. */
   const bitblast::AigBitblaster::Bits& bits(const Node& term) const;
 
+  /**
+   * Set the encoded bits of a term that was not bit-blasted, e.g., bits
+   * imported from the shared bit-blast cache.
+   */
+  void set_bits(const Node& term, const bitblast::AigBitblaster::Bits& bits);
+
+  /** Open a new scope, terms bit-blasted within are released on pop(). */
+  void push();
+  /**
+   * Release all terms bit-blasted since the matching push(). AIG nodes that
+   * are not referenced anymore are deleted.
+   */
+  void pop();
+
+  /** @return A fresh AIG constant. */
+  bitblast::AigNode mk_const() { return d_bitblaster.bv_constant(1)[0]; }
+  /** @return The AIG node representing true. */
+  bitblast::AigNode mk_true();
+  /** @return The conjunction of given AIG nodes. */
+  bitblast::AigNode mk_and(const bitblast::AigNode& a,
+                           const bitblast::AigNode& b)
+  {
+    return d_bitblaster.bv_and({a}, {b})[0];
+  }
+  /** @return The negation of given AIG node. */
+  bitblast::AigNode mk_not(const bitblast::AigNode& aig)
+  {
+    return d_bitblaster.bv_not({aig})[0];
+  }
+
   /** Count number of AIG nodes in term. */
-  uint64_t count_aig_ands(const Node& term, AigNodeRefSet& cache);
+  uint64_t count_aig_ands(const Node& term, AigNodeSet& cache);
 
   uint64_t num_aig_ands() const { return d_bitblaster.num_aig_ands(); }
   uint64_t num_aig_consts() const { return d_bitblaster.num_aig_consts(); }
@@ -45,7 +75,11 @@ class AigBitblaster
   /** AIG bit-blaster. */
   bitblast::AigBitblaster d_bitblaster;
   /** Cached to store bit-blasted terms and their encoded bits. */
-  std::unordered_map<Node, bitblast::AigBitblaster::Bits> d_bitblaster_cache;
+  node::NodeMap<bitblast::AigBitblaster::Bits> d_bitblaster_cache;
+  /** Terms added to d_bitblaster_cache within an open scope. */
+  std::vector<Node> d_trail;
+  /** The size of d_trail at the start of each open scope. */
+  std::vector<size_t> d_trail_sizes;
 };
 
 }  // namespace bzla::bv
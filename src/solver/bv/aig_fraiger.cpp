@@ -0,0 +1,380 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "solver/bv/aig_fraiger.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <unordered_set>
+
+#include "env.h"
+#include "sat/cadical.h"
+
+namespace bzla::bv {
+
+using namespace bitblast;
+
+/** Sat solver wrapper for AIG encoder. */
+class AigFraiger::FraigSatSolver : public SatInterface
+{
+ public:
+  FraigSatSolver(sat::SatSolver& solver) : d_solver(solver) {}
+
+  void add(int64_t lit) override { d_solver.add(lit); }
+
+  void add_clause(const std::initializer_list<int64_t>& literals) override
+  {
+    for (int64_t lit : literals)
+    {
+      d_solver.add(lit);
+    }
+    d_solver.add(0);
+  }
+
+  bool value(int64_t lit) override { return d_solver.value(lit) == 1; }
+
+ private:
+  sat::SatSolver& d_solver;
+};
+
+/**
+ * Terminator that stops a SAT call after a fixed number of polls, or if the
+ * environment's terminator requests termination.
+ */
+class AigFraiger::FraigTerminator : public Terminator
+{
+ public:
+  FraigTerminator(Terminator* terminator) : d_terminator(terminator) {}
+
+  bool terminate() override
+  {
+    return ++d_num_polls > MAX_SAT_POLLS
+           || (d_terminator && d_terminator->terminate());
+  }
+
+  /** Reset the poll budget before a new SAT call. */
+  void reset() { d_num_polls = 0; }
+
+ private:
+  /** The terminator of the environment, may be nullptr. */
+  Terminator* d_terminator;
+  /** The number of polls since the last reset. */
+  uint64_t d_num_polls = 0;
+};
+
+/* --- AigFraiger public ---------------------------------------------------- */
+
+AigFraiger::AigFraiger(Env& env,
+                       AigBitblaster& bitblaster,
+                       const std::string& prefix)
+    : d_env(env),
+      d_bitblaster(bitblaster),
+      d_rng(env.options().seed()),
+      d_sat_solver(new sat::Cadical()),
+      d_fraig_sat_solver(new FraigSatSolver(*d_sat_solver)),
+      d_cnf_encoder(new AigCnfEncoder(*d_fraig_sat_solver)),
+      d_terminator(new FraigTerminator(env.terminator())),
+      d_stats(env.statistics(), prefix)
+{
+  d_sat_solver->configure_terminator(d_terminator.get());
+}
+
+AigFraiger::~AigFraiger() {}
+
+std::vector<AigNode>
+AigFraiger::fraig(const std::vector<AigNode>& roots)
+{
+  util::Timer timer(d_stats.time_fraig);
+
+  collect(roots);
+
+  d_sims.clear();
+  std::vector<uint64_t> inputs(d_nodes.size(), 0);
+  for (size_t i = 0; i < NUM_RANDOM_WORDS; ++i)
+  {
+    for (size_t pos : d_inputs)
+    {
+      inputs[pos] = d_rng.pick<uint64_t>();
+    }
+    simulate(inputs);
+  }
+  compute_classes();
+  d_cex.assign(d_nodes.size(), 0);
+  d_num_cex = 0;
+
+  auto reduced = [this](const AigNode& aig) {
+    const AigNode& res = d_reduced.at(std::abs(aig.get_id()));
+    return aig.is_negated() ? d_bitblaster.mk_not(res) : res;
+  };
+
+  // Rebuild the AIG in topological order, merge proven equivalent nodes.
+  for (size_t pos = 0, size = d_nodes.size(); pos < size; ++pos)
+  {
+    const AigNode& aig = d_nodes[pos];
+    int64_t id         = aig.get_id();
+    if (d_reduced.find(id) != d_reduced.end())
+    {
+      continue;
+    }
+    if (!aig.is_and())
+    {
+      d_reduced.emplace(id, aig);
+      continue;
+    }
+
+    AigNode res = d_bitblaster.mk_and(reduced(aig[0]), reduced(aig[1]));
+    size_t repr = d_repr[pos];
+    if (repr != pos)
+    {
+      AigNode other = d_reduced.at(d_nodes[repr].get_id());
+      if (phase(pos) != phase(repr))
+      {
+        other = d_bitblaster.mk_not(other);
+      }
+      if (!(res == other) && !d_env.terminate()
+          && check_equiv(res, other) == Result::UNSAT)
+      {
+        res = other;
+        ++d_stats.num_merges;
+      }
+      // Refine candidate classes with a full word of counterexamples.
+      if (d_num_cex == 64
+          && d_sims.size() < NUM_RANDOM_WORDS + MAX_CEX_WORDS)
+      {
+        ++d_stats.num_refinements;
+        simulate(d_cex);
+        compute_classes();
+        d_cex.assign(d_nodes.size(), 0);
+        d_num_cex = 0;
+      }
+    }
+    d_reduced.emplace(id, res);
+  }
+
+  std::vector<AigNode> res;
+  for (const AigNode& root : roots)
+  {
+    res.push_back(reduced(root));
+  }
+  return res;
+}
+
+void
+AigFraiger::garbage_collect()
+{
+  d_nodes.clear();
+  d_pos.clear();
+  d_inputs.clear();
+  d_sims.clear();
+  d_repr.clear();
+  d_cex.clear();
+  d_num_cex = 0;
+
+  // Group the entries of d_reduced by reduced node, in descending order of
+  // node ids, i.e., parents before their children. A reduced node is only
+  // referenced by the fraiger if its reference count is the number of its
+  // entries. Releasing a node decrements the reference counts of its
+  // children, which are processed afterwards.
+  std::vector<std::pair<int64_t, int64_t>> entries;
+  for (const auto& [id, aig] : d_reduced)
+  {
+    entries.emplace_back(std::abs(aig.get_id()), id);
+  }
+  std::sort(entries.begin(), entries.end(), std::greater<>());
+  for (size_t i = 0, size = entries.size(); i < size;)
+  {
+    size_t j = i + 1;
+    while (j < size && entries[j].first == entries[i].first)
+    {
+      ++j;
+    }
+    if (d_reduced.at(entries[i].second).get_refs() == j - i)
+    {
+      for (; i < j; ++i)
+      {
+        d_reduced.erase(entries[i].second);
+      }
+    }
+    i = j;
+  }
+}
+
+/* --- AigFraiger private --------------------------------------------------- */
+
+void
+AigFraiger::collect(const std::vector<AigNode>& roots)
+{
+  d_nodes.clear();
+  d_pos.clear();
+  d_inputs.clear();
+
+  AigNode true_aig = d_bitblaster.mk_true();
+  d_pos.emplace(true_aig.get_id(), 0);
+  d_nodes.push_back(true_aig);
+
+  std::unordered_set<int64_t> visited;
+  std::vector<AigNode> visit;
+  for (const AigNode& root : roots)
+  {
+    visit.push_back(root.is_negated() ? d_bitblaster.mk_not(root) : root);
+  }
+  while (!visit.empty())
+  {
+    AigNode cur = visit.back();
+    int64_t id  = cur.get_id();
+    assert(id > 0);
+    if (d_pos.find(id) != d_pos.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (cur.is_and() && visited.insert(id).second)
+    {
+      for (size_t i = 0; i < 2; ++i)
+      {
+        AigNode child = cur[i];
+        visit.push_back(child.is_negated() ? d_bitblaster.mk_not(child)
+                                           : child);
+      }
+      continue;
+    }
+    visit.pop_back();
+    if (!cur.is_and())
+    {
+      d_inputs.push_back(d_nodes.size());
+    }
+    d_pos.emplace(id, d_nodes.size());
+    d_nodes.push_back(cur);
+  }
+}
+
+void
+AigFraiger::simulate(const std::vector<uint64_t>& inputs)
+{
+  for (size_t pos : d_inputs)
+  {
+    d_simulator.set(d_nodes[pos], inputs[pos]);
+  }
+  std::vector<uint64_t>& sim = d_sims.emplace_back(d_nodes.size(), 0);
+  for (size_t pos = 0, size = d_nodes.size(); pos < size; ++pos)
+  {
+    sim[pos] = d_simulator.simulate(d_nodes[pos]);
+  }
+}
+
+void
+AigFraiger::compute_classes()
+{
+  // Maps the hash of a normalized signature to the positions of the
+  // representatives of all classes with this hash.
+  std::unordered_map<uint64_t, std::vector<size_t>> classes;
+  d_repr.resize(d_nodes.size());
+
+  auto equal = [this](size_t a, size_t b) {
+    uint64_t mask = phase(a) == phase(b) ? 0 : ~UINT64_C(0);
+    for (const auto& sim : d_sims)
+    {
+      if (sim[a] != (sim[b] ^ mask))
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  for (size_t pos = 0, size = d_nodes.size(); pos < size; ++pos)
+  {
+    uint64_t mask = phase(pos) ? ~UINT64_C(0) : 0;
+    uint64_t hash = 0;
+    for (const auto& sim : d_sims)
+    {
+      hash = hash * UINT64_C(0x9e3779b97f4a7c15) + (sim[pos] ^ mask);
+    }
+    auto& reprs = classes[hash];
+    d_repr[pos] = pos;
+    for (size_t repr : reprs)
+    {
+      if (equal(pos, repr))
+      {
+        d_repr[pos] = repr;
+        break;
+      }
+    }
+    if (d_repr[pos] == pos)
+    {
+      reprs.push_back(pos);
+    }
+  }
+}
+
+Result
+AigFraiger::check_equiv(const AigNode& a, const AigNode& b)
+{
+  d_cnf_encoder->encode(a);
+  d_cnf_encoder->encode(b);
+  int64_t la = a.get_id();
+  int64_t lb = b.get_id();
+
+  // a = b iff both a /\ ~b and ~a /\ b are unsatisfiable.
+  for (int64_t sign : {1, -1})
+  {
+    ++d_stats.num_sat_calls;
+    d_terminator->reset();
+    d_sat_solver->assume(sign * la);
+    d_sat_solver->assume(-sign * lb);
+    Result res = d_sat_solver->solve();
+    if (res == Result::SAT)
+    {
+      add_cex();
+      return res;
+    }
+    if (res != Result::UNSAT)
+    {
+      ++d_stats.num_sat_unknown;
+      return Result::UNKNOWN;
+    }
+  }
+  return Result::UNSAT;
+}
+
+void
+AigFraiger::add_cex()
+{
+  ++d_stats.num_cex;
+  if (d_num_cex == 64)
+  {
+    return;
+  }
+  uint64_t bit = UINT64_C(1) << d_num_cex;
+  for (size_t pos : d_inputs)
+  {
+    // Inputs that are not encoded are not constrained by the counterexample
+    // and evaluate to false.
+    if (d_cnf_encoder->value(d_nodes[pos]) == 1)
+    {
+      d_cex[pos] |= bit;
+    }
+  }
+  d_num_cex += 1;
+}
+
+AigFraiger::Statistics::Statistics(util::Statistics& stats,
+                                   const std::string& prefix)
+    : time_fraig(stats.new_stat<util::TimerStatistic>(prefix + "time_fraig")),
+      num_merges(stats.new_stat<uint64_t>(prefix + "num_merges")),
+      num_sat_calls(stats.new_stat<uint64_t>(prefix + "num_sat_calls")),
+      num_sat_unknown(stats.new_stat<uint64_t>(prefix + "num_sat_unknown")),
+      num_cex(stats.new_stat<uint64_t>(prefix + "num_cex")),
+      num_refinements(stats.new_stat<uint64_t>(prefix + "num_refinements"))
+{
+}
+
+}  // namespace bzla::bv
@@ -0,0 +1,166 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_SOLVER_BV_AIG_FRAIGER_H_INCLUDED
+#define BZLA_SOLVER_BV_AIG_FRAIGER_H_INCLUDED
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "bitblast/aig/aig_cnf.h"
+#include "bitblast/aig/aig_simulator.h"
+#include "rng/rng.h"
+#include "sat/sat_solver.h"
+#include "solver/bv/aig_bitblaster.h"
+#include "util/statistics.h"
+
+namespace bzla {
+
+class Env;
+
+namespace bv {
+
+/**
+ * Functionally reduced AIG construction (fraiging) via SAT sweeping.
+ *
+ * AIG nodes are simulated with random input patterns, 64 patterns per word.
+ * Nodes with equal (or complementary) simulation signatures are candidates
+ * for being equivalent. Candidates are checked with incremental SAT calls in
+ * topological order, and proven equivalent nodes are merged while rebuilding
+ * the AIG. Counterexamples of failed checks are collected as additional
+ * simulation patterns that refine the candidate classes.
+ *
+ * Equivalences are proven over the AIG structure only (inputs are
+ * unconstrained), hence merges are valid independently of the assertions and
+ * are kept across calls to fraig().
+ */
+class AigFraiger
+{
+ public:
+  /**
+   * Constructor.
+   * @param env        The associated environment.
+   * @param bitblaster The bit-blaster that owns the AIG nodes to reduce.
+   * @param prefix     The prefix for statistics.
+   */
+  AigFraiger(Env& env, AigBitblaster& bitblaster, const std::string& prefix);
+  ~AigFraiger();
+
+  /**
+   * Reduce the AIG cones of given roots.
+   * @param roots The roots.
+   * @return The reduced roots, in the same order as `roots`.
+   */
+  std::vector<bitblast::AigNode> fraig(
+      const std::vector<bitblast::AigNode>& roots);
+
+  /**
+   * Release reduced AIG nodes that are only referenced by the fraiger, e.g.,
+   * after the bit-blasted terms of a popped scope were released.
+   */
+  void garbage_collect();
+
+ private:
+  /** Number of random simulation words per fraig() call. */
+  static constexpr size_t NUM_RANDOM_WORDS = 4;
+  /** Maximum number of counterexample words per fraig() call. */
+  static constexpr size_t MAX_CEX_WORDS = 16;
+  /**
+   * Maximum number of terminator polls per SAT call, which bounds the effort
+   * spent on a single equivalence check.
+   */
+  static constexpr uint64_t MAX_SAT_POLLS = 10000;
+
+  /** Sat interface used for d_cnf_encoder. */
+  class FraigSatSolver;
+  /** Terminator that bounds the effort of a SAT call. */
+  class FraigTerminator;
+
+  /**
+   * Collect the AIG nodes in the cones of the given roots in topological
+   * order. Initializes d_nodes and d_pos.
+   */
+  void collect(const std::vector<bitblast::AigNode>& roots);
+  /**
+   * Simulate all nodes for one word of input patterns.
+   * @param inputs The input patterns, indexed by position in d_nodes (only
+   *               entries of inputs are used).
+   */
+  void simulate(const std::vector<uint64_t>& inputs);
+  /** Compute the representative of each node's candidate class. */
+  void compute_classes();
+  /** @return True if the signature of the node at `pos` is complemented. */
+  bool phase(size_t pos) const { return d_sims[0][pos] & 1; }
+
+  /**
+   * Check whether given AIG nodes are equivalent.
+   * @param a The first node.
+   * @param b The second node.
+   * @return Result::UNSAT if `a` and `b` are equivalent, Result::SAT if a
+   *         counterexample was found and Result::UNKNOWN if the SAT call
+   *         exceeded its budget.
+   */
+  Result check_equiv(const bitblast::AigNode& a, const bitblast::AigNode& b);
+  /** Record the current SAT model as counterexample pattern. */
+  void add_cex();
+
+  /** The associated environment. */
+  Env& d_env;
+  /** The bit-blaster owning the AIG nodes. */
+  AigBitblaster& d_bitblaster;
+  /** Random number generator for simulation patterns. */
+  RNG d_rng;
+  /** Simulator for computing simulation signatures. */
+  bitblast::AigSimulator d_simulator;
+
+  /** SAT solver for equivalence checks. */
+  std::unique_ptr<sat::SatSolver> d_sat_solver;
+  /** SAT interface for d_cnf_encoder, which wraps d_sat_solver. */
+  std::unique_ptr<FraigSatSolver> d_fraig_sat_solver;
+  /** CNF encoder for the equivalence checks. */
+  std::unique_ptr<bitblast::AigCnfEncoder> d_cnf_encoder;
+  /** Terminator connected to d_sat_solver. */
+  std::unique_ptr<FraigTerminator> d_terminator;
+
+  /** Maps AIG ids to their reduced AIG node, kept across fraig() calls. */
+  std::unordered_map<int64_t, bitblast::AigNode> d_reduced;
+
+  /** The nodes of the current call in topological order, true first. */
+  std::vector<bitblast::AigNode> d_nodes;
+  /** Maps AIG ids to their position in d_nodes. */
+  std::unordered_map<int64_t, size_t> d_pos;
+  /** The positions of the inputs in d_nodes. */
+  std::vector<size_t> d_inputs;
+  /** Simulation words, one vector of signatures per word. */
+  std::vector<std::vector<uint64_t>> d_sims;
+  /** Position of the candidate representative of each node. */
+  std::vector<size_t> d_repr;
+  /** Pending counterexample patterns, indexed by position in d_nodes. */
+  std::vector<uint64_t> d_cex;
+  /** Number of pending counterexample patterns in d_cex. */
+  size_t d_num_cex = 0;
+
+  struct Statistics
+  {
+    Statistics(util::Statistics& stats, const std::string& prefix);
+    util::TimerStatistic& time_fraig;
+    uint64_t& num_merges;
+    uint64_t& num_sat_calls;
+    uint64_t& num_sat_unknown;
+    uint64_t& num_cex;
+    uint64_t& num_refinements;
+  } d_stats;
+};
+
+}  // namespace bv
+}  // namespace bzla
+
+#endif
@@ -0,0 +1,211 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "solver/bv/bitblast_cache.h"
+
+#include <cassert>
+#include <cstdlib>
+
+#include "util/exceptions.h"
+
+namespace bzla::bv {
+
+BitblastCache::BitblastCache(size_t max_vars)
+    : d_max_vars(max_vars), d_vars(TRUE_VAR + 1, {0, 0})
+{
+}
+
+uint64_t
+BitblastCache::generation() const
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  return d_generation;
+}
+
+bool
+BitblastCache::leaf(uint64_t generation,
+                    uint64_t id,
+                    size_t size,
+                    std::vector<int64_t>& vars)
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  if (generation != d_generation)
+  {
+    return false;
+  }
+  auto [it, inserted] = d_leaves.emplace(id, std::vector<int64_t>());
+  if (inserted)
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      it->second.push_back(new_var(0, 0));
+    }
+  }
+  assert(it->second.size() == size);
+  vars = it->second;
+  return true;
+}
+
+int64_t
+BitblastCache::mk_and(uint64_t generation, int64_t a, int64_t b)
+{
+  assert(a != 0 && b != 0);
+  if (a > b)
+  {
+    std::swap(a, b);
+  }
+  std::lock_guard<std::mutex> lock(d_mutex);
+  if (generation != d_generation)
+  {
+    return 0;
+  }
+  assert(static_cast<size_t>(std::abs(a)) < d_vars.size());
+  assert(static_cast<size_t>(std::abs(b)) < d_vars.size());
+  auto [it, inserted] = d_unique.emplace(key(a, b), 0);
+  if (inserted)
+  {
+    it->second = new_var(a, b);
+  }
+  return it->second;
+}
+
+bool
+BitblastCache::insert(uint64_t generation,
+                      uint64_t id,
+                      const std::vector<int64_t>& bits)
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  if (generation != d_generation)
+  {
+    return false;
+  }
+  d_terms.emplace(id, bits);
+  return true;
+}
+
+bool
+BitblastCache::contains(uint64_t id) const
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  return d_terms.find(id) != d_terms.end();
+}
+
+bool
+BitblastCache::find(uint64_t generation, uint64_t id, Cone& cone) const
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  if (generation != d_generation)
+  {
+    return false;
+  }
+  auto it = d_terms.find(id);
+  if (it == d_terms.end())
+  {
+    return false;
+  }
+
+  assert(!it->second.empty());
+  cone.d_bits = it->second;
+  cone.d_inputs.clear();
+  cone.d_gates.clear();
+
+  std::unordered_map<int64_t, bool> cache;
+  std::vector<int64_t> visit;
+  for (int64_t lit : cone.d_bits)
+  {
+    visit.push_back(std::abs(lit));
+  }
+  do
+  {
+    int64_t var          = visit.back();
+    const auto& children = d_vars[var];
+    auto [cit, inserted] = cache.emplace(var, false);
+    if (inserted)
+    {
+      if (children[0] != 0)
+      {
+        visit.push_back(std::abs(children[0]));
+        visit.push_back(std::abs(children[1]));
+        continue;
+      }
+      if (var != TRUE_VAR)
+      {
+        cone.d_inputs.push_back(var);
+      }
+      cit->second = true;
+    }
+    else if (!cit->second)
+    {
+      cone.d_gates.push_back({var, children[0], children[1]});
+      cit->second = true;
+    }
+    visit.pop_back();
+  } while (!visit.empty());
+  return true;
+}
+
+void
+BitblastCache::erase(const std::vector<uint64_t>& ids)
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  for (uint64_t id : ids)
+  {
+    d_terms.erase(id);
+    d_leaves.erase(id);
+  }
+  // Variables of erased entries may still occur in the cones of other terms,
+  // hence they are only reclaimed all at once.
+  if (d_vars.size() - 1 > d_max_vars)
+  {
+    // Swap with empty containers to release their memory.
+    decltype(d_vars)(TRUE_VAR + 1, {0, 0}).swap(d_vars);
+    decltype(d_unique)().swap(d_unique);
+    decltype(d_leaves)().swap(d_leaves);
+    decltype(d_terms)().swap(d_terms);
+    ++d_generation;
+  }
+}
+
+size_t
+BitblastCache::size() const
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  return d_terms.size();
+}
+
+size_t
+BitblastCache::num_vars() const
+{
+  std::lock_guard<std::mutex> lock(d_mutex);
+  return d_vars.size() - 1;
+}
+
+uint64_t
+BitblastCache::key(int64_t a, int64_t b)
+{
+  // Literals are encoded as var << 1 | negated, variables fit into 31 bits.
+  auto enc = [](int64_t lit) {
+    if (std::abs(lit) >= (INT64_C(1) << 31))
+    {
+      throw Error("maximum number of variables in bit-blast cache exceeded");
+    }
+    return static_cast<uint64_t>(std::abs(lit)) << 1 | (lit < 0 ? 1 : 0);
+  };
+  return enc(a) << 32 | enc(b);
+}
+
+int64_t
+BitblastCache::new_var(int64_t a, int64_t b)
+{
+  d_vars.push_back({a, b});
+  return static_cast<int64_t>(d_vars.size() - 1);
+}
+
+}  // namespace bzla::bv
@@ -0,0 +1,170 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_SOLVER_BV_BITBLAST_CACHE_H_INCLUDED
+#define BZLA_SOLVER_BV_BITBLAST_CACHE_H_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace bzla::bv {
+
+/**
+ * Cache of bit-blasted terms that is shared between all solver instances
+ * that use the same node manager.
+ *
+ * The cache stores the AIG cones of bit-blasted terms over cache variables,
+ * which are independent of the AIG manager and SAT solver of a solver
+ * instance. A solver instance that bit-blasts a cached term imports the CNF
+ * encoding of its cone instead of bit-blasting and encoding it again.
+ *
+ * Variable TRUE_VAR represents true. The bits of leaves (terms that are not
+ * bit-blasted, e.g., constants) are mapped to input variables, AND gates are
+ * hash-consed. Terms are identified by their node id, which is never reused.
+ * Hence, the cache does not hold references to nodes and all member functions
+ * can be called concurrently from multiple threads.
+ *
+ * The node manager erases the entries of garbage collected nodes. The
+ * variables of erased entries are not reclaimed individually. Instead, all
+ * entries are dropped when the number of variables exceeds a limit, which
+ * starts a new generation of variables. Functions that take variables or
+ * return variables are called with the generation the caller's variables
+ * belong to and fail if it is outdated.
+ */
+class BitblastCache
+{
+ public:
+  /** The AIG cone of a cached term. */
+  struct Cone
+  {
+    /** The literals of the bits of the term. */
+    std::vector<int64_t> d_bits;
+    /** The input variables in the cone. */
+    std::vector<int64_t> d_inputs;
+    /** The AND gates x <-> a /\ b as {x, a, b}, children before parents. */
+    std::vector<std::array<int64_t, 3>> d_gates;
+  };
+
+  /** The variable representing true. */
+  static constexpr int64_t TRUE_VAR = 1;
+  /** The default maximum number of variables. */
+  static constexpr size_t DEFAULT_MAX_VARS = size_t(1) << 24;
+
+  /**
+   * Constructor.
+   * @param max_vars The maximum number of variables. If exceeded, all entries
+   *                 are dropped on the next call to erase().
+   */
+  BitblastCache(size_t max_vars = DEFAULT_MAX_VARS);
+
+  /** @return The current generation of variables. */
+  uint64_t generation() const;
+
+  /**
+   * Get the input variables of the bits of given leaf, created on first
+   * request.
+   * @param generation The generation of variables of the caller.
+   * @param id         The node id of the leaf.
+   * @param size       The number of bits of the leaf.
+   * @param vars       The resulting input variables, most significant bit
+   *                   first.
+   * @return False if the given generation is outdated.
+   */
+  bool leaf(uint64_t generation,
+            uint64_t id,
+            size_t size,
+            std::vector<int64_t>& vars);
+
+  /**
+   * Get the variable of the AND gate over given literals, created on first
+   * request.
+   * @param generation The generation of variables of the caller.
+   * @param a          The literal of the first child.
+   * @param b          The literal of the second child.
+   * @return The variable of the AND gate, 0 if the given generation is
+   *         outdated.
+   * @throw Error if the number of variables exceeds 31 bits.
+   */
+  int64_t mk_and(uint64_t generation, int64_t a, int64_t b);
+
+  /**
+   * Cache the bits of given term. Does nothing if the term is already cached.
+   * @param generation The generation of variables of the caller.
+   * @param id         The node id of the term.
+   * @param bits       The literals of the bits of the term.
+   * @return False if the given generation is outdated.
+   */
+  bool insert(uint64_t generation,
+              uint64_t id,
+              const std::vector<int64_t>& bits);
+
+  /**
+   * Determine whether given term is cached.
+   * @param id The node id of the term.
+   * @return True if the term is cached.
+   */
+  bool contains(uint64_t id) const;
+
+  /**
+   * Get the cone of given term.
+   * @param generation The generation of variables of the caller.
+   * @param id         The node id of the term.
+   * @param cone       The resulting cone.
+   * @return False if the term is not cached or the given generation is
+   *         outdated.
+   */
+  bool find(uint64_t generation, uint64_t id, Cone& cone) const;
+
+  /**
+   * Erase the entries of given garbage collected nodes. Drops all entries and
+   * starts a new generation of variables if the number of variables exceeds
+   * the limit.
+   * @param ids The node ids of the garbage collected nodes.
+   */
+  void erase(const std::vector<uint64_t>& ids);
+
+  /** @return The number of cached terms. */
+  size_t size() const;
+
+  /** @return The number of variables (inputs and AND gates). */
+  size_t num_vars() const;
+
+ private:
+  /**
+   * @return The key of the AND gate over given literals in d_unique.
+   * @throw Error if a variable does not fit into 31 bits.
+   */
+  static uint64_t key(int64_t a, int64_t b);
+  /** Create a new variable with given children, {0, 0} for inputs. */
+  int64_t new_var(int64_t a, int64_t b);
+
+  /** The maximum number of variables. */
+  const size_t d_max_vars;
+
+  /** Guards all data below. */
+  mutable std::mutex d_mutex;
+  /** The current generation of variables. */
+  uint64_t d_generation = 0;
+  /** The children of AND gates indexed by variable, {0, 0} for inputs. */
+  std::vector<std::array<int64_t, 2>> d_vars;
+  /** Hash-consing table for AND gates. */
+  std::unordered_map<uint64_t, int64_t> d_unique;
+  /** Maps node ids of leaves to the input variables of their bits. */
+  std::unordered_map<uint64_t, std::vector<int64_t>> d_leaves;
+  /** Maps node ids of cached terms to the literals of their bits. */
+  std::unordered_map<uint64_t, std::vector<int64_t>> d_terms;
+};
+
+}  // namespace bzla::bv
+
+#endif
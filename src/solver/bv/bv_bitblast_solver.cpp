@@ -10,10 +10,18 @@
 
 #include "solver/bv/bv_bitblast_solver.h"
 
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "bv/bitvector.h"
 #include "env.h"
 #include "node/node_manager.h"
+#include "node/node_ref_vector.h"
 #include "node/node_utils.h"
+#include "node/unordered_node_ref_set.h"
+#include "sat/cube_and_conquer.h"
 #include "sat/sat_solver_factory.h"
 #include "solver/bv/bv_solver.h"
 
@@ -27,12 +35,17 @@ class BvBitblastSolver::BitblastSatSolver : public bitblast::SatInterface
  public:
   BitblastSatSolver(sat::SatSolver& solver) : d_solver(solver) {}
 
-  void add(int64_t lit) override { d_solver.add(lit); }
+  void add(int64_t lit) override
+  {
+    observe(lit);
+    d_solver.add(lit);
+  }
 
   void add_clause(const std::initializer_list<int64_t>& literals) override
   {
     for (int64_t lit : literals)
     {
+      observe(lit);
       d_solver.add(lit);
     }
     d_solver.add(0);
@@ -40,11 +53,629 @@ class BvBitblastSolver::BitblastSatSolver : public bitblast::SatInterface
 
   bool value(int64_t lit) override
   {
+    if (d_use_model)
+    {
+      size_t var = std::abs(lit);
+      bool val   = var < d_model.size() && d_model[var];
+      d_reads.push_back(var);
+      return lit < 0 ? !val : val;
+    }
     return d_solver.value(lit) == 1 ? true : false;
   }
 
+  /** Enable tracking of variables to be observed by the propagator. */
+  void enable_observe() { d_observe = true; }
+
+  /**
+   * Record variable to be observed by the propagator if it was not observed
+   * yet.
+   * @param lit The literal of the variable.
+   */
+  void observe(int64_t lit)
+  {
+    if (!d_observe || lit == 0)
+    {
+      return;
+    }
+    size_t var = std::abs(lit);
+    if (var >= d_observed.size())
+    {
+      d_observed.resize(var + 1, false);
+      d_pending.resize(var + 1, false);
+    }
+    if (!d_observed[var] && !d_pending[var])
+    {
+      d_pending[var] = true;
+      d_new_observed.push_back(var);
+    }
+  }
+
+  /**
+   * Determine whether given variable is observed by the propagator.
+   * @param var The variable.
+   * @return True if `var` was registered with the SAT solver via
+   *         flush_observed().
+   */
+  bool is_observed(int64_t var) const
+  {
+    assert(var > 0);
+    return static_cast<size_t>(var) < d_observed.size() && d_observed[var];
+  }
+
+  /** Register variables encoded since the last call as observed. */
+  void flush_observed()
+  {
+    for (int64_t var : d_new_observed)
+    {
+      d_solver.add_observed_var(var);
+      d_observed[var] = true;
+    }
+    d_new_observed.clear();
+  }
+
+  /**
+   * Answer value queries from given assignment instead of the SAT solver.
+   * @param model The assignment of observed variables, nullptr to answer
+   *              value queries from the SAT solver again. Variables not
+   *              assigned in `model` are interpreted as false.
+   */
+  void set_model(const std::vector<int32_t>* model)
+  {
+    d_use_model = model != nullptr;
+    if (d_use_model)
+    {
+      d_reads.clear();
+      d_model.assign(d_observed.size(), false);
+      for (int32_t lit : *model)
+      {
+        size_t var = std::abs(lit);
+        if (var < d_model.size())
+        {
+          d_model[var] = lit > 0;
+        }
+      }
+    }
+  }
+
+  /**
+   * @return The variables queried via value() since the last call to
+   *         set_model(), may contain duplicates.
+   */
+  const std::vector<int64_t>& reads() const { return d_reads; }
+
  private:
   sat::SatSolver& d_solver;
+
+  /** True if encoded variables are tracked for observation. */
+  bool d_observe = false;
+  /** Indicates whether a variable is observed by the propagator. */
+  std::vector<bool> d_observed;
+  /** Indicates whether a variable was recorded in d_new_observed. */
+  std::vector<bool> d_pending;
+  /** Variables not yet registered as observed with the SAT solver. */
+  std::vector<int64_t> d_new_observed;
+
+  /** True if value queries are answered from d_model. */
+  bool d_use_model = false;
+  /** Assignment provided by set_model(), indexed by variable. */
+  std::vector<bool> d_model;
+  /** Variables queried while value queries are answered from d_model. */
+  std::vector<int64_t> d_reads;
+};
+
+/**
+ * Propagator that checks theory consistency of assignments found during SAT
+ * search.
+ *
+ * Complete assignments are checked when the SAT solver found a model. Partial
+ * assignments are checked at propagation fixpoints as soon as all variables
+ * read by the previous check are assigned again, unassigned variables are
+ * interpreted as false. Theory lemmas are valid independent of the
+ * assignment they were generated from.
+ *
+ * Lemmas are added to the SAT solver as clauses without restarting search
+ * and reported to the solver engine via SolverState::lemma_added_in_search().
+ * AND gates of a lemma that are not encoded are defined via variables
+ * reserved before the SAT solver call, since the SAT solver does not allow to
+ * introduce new variables during search. If a lemma contains inputs that are
+ * not encoded or the reserved variables are exhausted, lemma checks are
+ * disabled for the remainder of the current solve() call and the lemma is
+ * processed by the solver engine after the SAT solver returned.
+ */
+class BvBitblastSolver::LemmaPropagator : public sat::Propagator
+{
+ public:
+  LemmaPropagator(BvBitblastSolver& solver) : d_solver(solver) {}
+
+  void notify_assignment(int32_t lit, bool fixed) override;
+
+  void notify_new_decision_level() override
+  {
+    d_trail_lim.push_back(d_trail.size());
+  }
+
+  void notify_backtrack(size_t level) override;
+
+  bool check_model(const std::vector<int32_t>& model) override;
+
+  bool has_clause() override;
+
+  int32_t next_clause_lit() override
+  {
+    assert(d_clause_idx < d_clauses.size());
+    return d_clauses[d_clause_idx++];
+  }
+
+  /**
+   * Reset propagator before a new SAT solver call and reserve variables for
+   * defining AND gates of lemmas.
+   */
+  void reset();
+
+ private:
+  /**
+   * Check theories against given assignment and queue clauses for the
+   * generated lemmas.
+   * @param model   The assignment of observed variables.
+   * @param partial True if `model` is a partial assignment.
+   * @return True if clauses were queued.
+   */
+  bool check(const std::vector<int32_t>& model, bool partial);
+
+  /**
+   * Unassign variable.
+   * @param var The variable.
+   */
+  void unassign(int32_t var);
+
+  /**
+   * Replace the set of variables read by the previous check.
+   * @param reads The variables read by the current check.
+   */
+  void set_reads(const std::vector<int64_t>& reads);
+
+  /**
+   * Convert lemma to clauses over observed variables.
+   * @param lemma The lemma.
+   * @return False if the lemma cannot be expressed over observed variables.
+   */
+  bool add_lemma(const Node& lemma);
+
+  /**
+   * Convert given literal into a clause over observed variables. Variables
+   * are only used in the polarities in which they are encoded.
+   * @param lit    The literal, an AIG node and a flag indicating whether the
+   *               node is negated.
+   * @param clause The resulting clause, empty if the literal is true.
+   * @return False if the literal cannot be expressed over observed variables.
+   */
+  bool to_clause(const std::pair<bitblast::AigNode, bool>& lit,
+                 std::vector<int32_t>& clause);
+
+  /**
+   * Get the variable corresponding to given AIG node in both polarities.
+   * AND gates that are not encoded in both polarities are defined via
+   * reserved variables, the defining clauses are queued.
+   * @param aig The AIG node.
+   * @return The variable, 0 if `aig` cannot be expressed over observed
+   *         variables.
+   */
+  int32_t define(const bitblast::AigNode& aig);
+
+  /**
+   * @param id The id of an AIG node.
+   * @return The variable corresponding to the AIG node in both polarities,
+   *         0 if there is none.
+   */
+  int32_t lookup(int64_t id) const;
+
+  /** Queue clause. */
+  void queue_clause(const std::initializer_list<int32_t>& clause);
+
+  /** The associated bit-blast solver. */
+  BvBitblastSolver& d_solver;
+  /** True if no more lemma checks should be performed in this SAT call. */
+  bool d_done = false;
+  /** Queued clauses, 0-terminated. */
+  std::vector<int32_t> d_clauses;
+  /** The index of the next literal in d_clauses. */
+  size_t d_clause_idx = 0;
+
+  /**
+   * The current assignment of observed variables, indexed by variable.
+   * 1 (-1) if assigned to true (false) above decision level 0, 2 (-2) if
+   * fixed to true (false), 0 if unassigned.
+   */
+  std::vector<int8_t> d_values;
+  /** Variables assigned above decision level 0 in assignment order. */
+  std::vector<int32_t> d_trail;
+  /** The size of d_trail at the start of each decision level. */
+  std::vector<size_t> d_trail_lim;
+
+  /** Indicates whether a variable was read by the previous check. */
+  std::vector<bool> d_read;
+  /** The variables read by the previous check. */
+  std::vector<int32_t> d_read_vars;
+  /** The number of variables in d_read_vars that are unassigned. */
+  size_t d_num_read_unassigned = 0;
+  /** True if a variable in d_read_vars was assigned since the last check. */
+  bool d_changed = false;
+
+  /** The initial number of variables reserved for each SAT solver call. */
+  static constexpr size_t s_num_reserve_init = 256;
+  /** The maximum number of variables reserved for each SAT solver call. */
+  static constexpr size_t s_num_reserve_max = 1 << 16;
+  /** The number of variables reserved for each SAT solver call. */
+  size_t d_num_reserve = s_num_reserve_init;
+  /** AIG constants whose variables are reserved for defining AND gates. */
+  std::vector<bitblast::AigNode> d_reserved;
+  /** The index of the next unused reserved variable in d_reserved. */
+  size_t d_reserved_idx = 0;
+  /** Maps ids of AND gates defined via reserved variables to the variable. */
+  std::unordered_map<int64_t, int32_t> d_defined;
+};
+
+void
+BvBitblastSolver::LemmaPropagator::reset()
+{
+  while (!d_trail.empty())
+  {
+    unassign(d_trail.back());
+    d_trail.pop_back();
+  }
+  d_trail_lim.clear();
+  d_done    = false;
+  d_changed = false;
+  d_clauses.clear();
+  d_clause_idx = 0;
+
+  // Reserve more variables if the previous call ran out of variables.
+  if (d_reserved_idx == d_reserved.size() && !d_reserved.empty())
+  {
+    d_num_reserve = std::min(2 * d_num_reserve, s_num_reserve_max);
+  }
+  while (d_reserved.size() < d_reserved_idx + d_num_reserve)
+  {
+    d_reserved.push_back(d_solver.d_bitblaster.mk_const());
+    d_solver.d_bitblast_sat_solver->observe(d_reserved.back().get_id());
+  }
+}
+
+void
+BvBitblastSolver::LemmaPropagator::notify_assignment(int32_t lit, bool fixed)
+{
+  size_t var = std::abs(lit);
+  if (var >= d_values.size())
+  {
+    d_values.resize(var + 1, 0);
+    d_read.resize(var + 1, false);
+  }
+  if (d_values[var] == 0)
+  {
+    if (d_read[var])
+    {
+      assert(d_num_read_unassigned > 0);
+      --d_num_read_unassigned;
+      d_changed = true;
+    }
+    if (!fixed)
+    {
+      d_trail.push_back(var);
+    }
+  }
+  int8_t val    = fixed ? 2 : 1;
+  d_values[var] = lit < 0 ? -val : val;
+}
+
+void
+BvBitblastSolver::LemmaPropagator::notify_backtrack(size_t level)
+{
+  if (level < d_trail_lim.size())
+  {
+    while (d_trail.size() > d_trail_lim[level])
+    {
+      unassign(d_trail.back());
+      d_trail.pop_back();
+    }
+    d_trail_lim.resize(level);
+  }
+}
+
+bool
+BvBitblastSolver::LemmaPropagator::check_model(
+    const std::vector<int32_t>& model)
+{
+  if (d_done)
+  {
+    return true;
+  }
+  // Variables fixed before they were observed are not notified.
+  for (int32_t lit : model)
+  {
+    size_t var = std::abs(lit);
+    if (var >= d_values.size() || d_values[var] == 0)
+    {
+      notify_assignment(lit, true);
+    }
+  }
+  return !check(model, false);
+}
+
+bool
+BvBitblastSolver::LemmaPropagator::has_clause()
+{
+  if (d_clause_idx == d_clauses.size() && !d_done && d_changed
+      && d_num_read_unassigned == 0)
+  {
+    // All variables read by the previous check are assigned, check the
+    // partial assignment.
+    std::vector<int32_t> model;
+    for (size_t var = 1, size = d_values.size(); var < size; ++var)
+    {
+      if (d_values[var] != 0)
+      {
+        int32_t v = static_cast<int32_t>(var);
+        model.push_back(d_values[var] < 0 ? -v : v);
+      }
+    }
+    ++d_solver.d_stats.num_partial_checks_in_search;
+    check(model, true);
+  }
+  return d_clause_idx < d_clauses.size();
+}
+
+bool
+BvBitblastSolver::LemmaPropagator::check(const std::vector<int32_t>& model,
+                                         bool partial)
+{
+  assert(d_clause_idx == d_clauses.size());
+  d_clauses.clear();
+  d_clause_idx = 0;
+
+  ++d_solver.d_stats.num_checks_in_search;
+  d_solver.d_bitblast_sat_solver->set_model(&model);
+  std::vector<Node> lemmas =
+      d_solver.d_solver_state.check_in_search(partial);
+  set_reads(d_solver.d_bitblast_sat_solver->reads());
+  d_solver.d_bitblast_sat_solver->set_model(nullptr);
+
+  for (const Node& lemma : lemmas)
+  {
+    if (add_lemma(lemma))
+    {
+      d_solver.d_solver_state.lemma_added_in_search(lemma);
+    }
+    else
+    {
+      d_done = true;
+    }
+  }
+  return !d_clauses.empty();
+}
+
+void
+BvBitblastSolver::LemmaPropagator::unassign(int32_t var)
+{
+  // Fixed variables stay assigned.
+  if (d_values[var] == 1 || d_values[var] == -1)
+  {
+    d_values[var] = 0;
+    if (d_read[var])
+    {
+      ++d_num_read_unassigned;
+    }
+  }
+}
+
+void
+BvBitblastSolver::LemmaPropagator::set_reads(
+    const std::vector<int64_t>& reads)
+{
+  for (int32_t var : d_read_vars)
+  {
+    d_read[var] = false;
+  }
+  d_read_vars.clear();
+  d_num_read_unassigned = 0;
+  for (int64_t var : reads)
+  {
+    // Variables that are not observed are never assigned.
+    if (!d_solver.d_bitblast_sat_solver->is_observed(var))
+    {
+      continue;
+    }
+    if (static_cast<size_t>(var) >= d_read.size())
+    {
+      d_values.resize(var + 1, 0);
+      d_read.resize(var + 1, false);
+    }
+    if (!d_read[var])
+    {
+      d_read[var] = true;
+      d_read_vars.push_back(var);
+      if (d_values[var] == 0)
+      {
+        ++d_num_read_unassigned;
+      }
+    }
+  }
+  d_changed = false;
+}
+
+bool
+BvBitblastSolver::LemmaPropagator::add_lemma(const Node& lemma)
+{
+  using AigLit = std::pair<bitblast::AigNode, bool>;
+
+  d_solver.d_bitblaster.bitblast(lemma);
+  const auto& bits = d_solver.d_bitblaster.bits(lemma);
+  assert(bits.size() == 1);
+
+  // Split top-level conjunctions.
+  std::vector<AigLit> conjuncts, visit{{bits[0], false}};
+  while (!visit.empty())
+  {
+    auto [aig, neg] = visit.back();
+    visit.pop_back();
+    if (aig.is_and() && !aig.is_negated() && !neg)
+    {
+      visit.emplace_back(aig[0], false);
+      visit.emplace_back(aig[1], false);
+    }
+    else
+    {
+      conjuncts.emplace_back(aig, neg);
+    }
+  }
+
+  std::vector<int32_t> clause;
+  for (const auto& lit : conjuncts)
+  {
+    clause.clear();
+    if (!to_clause(lit, clause))
+    {
+      return false;
+    }
+    if (!clause.empty())
+    {
+      d_clauses.insert(d_clauses.end(), clause.begin(), clause.end());
+      d_clauses.push_back(0);
+      ++d_solver.d_stats.num_lemma_clauses;
+    }
+  }
+  return true;
+}
+
+bool
+BvBitblastSolver::LemmaPropagator::to_clause(
+    const std::pair<bitblast::AigNode, bool>& lit, std::vector<int32_t>& clause)
+{
+  std::vector<std::pair<bitblast::AigNode, bool>> visit{lit};
+  bool sat = false;
+  while (!visit.empty())
+  {
+    auto [aig, neg] = visit.back();
+    visit.pop_back();
+    int64_t id = neg ? -aig.get_id() : aig.get_id();
+
+    if (aig.is_true() || aig.is_false())
+    {
+      // True literal satisfies the clause, false literals are dropped.
+      sat = sat || (aig.is_true() != neg);
+    }
+    else if (d_solver.d_bitblast_sat_solver->is_observed(std::abs(id))
+             && d_solver.d_cnf_encoder->is_encoded(id))
+    {
+      clause.push_back(id);
+    }
+    else if (aig.is_and() && id < 0)
+    {
+      // Negated AND: ~(a & b) = ~a | ~b
+      visit.emplace_back(aig[0], true);
+      visit.emplace_back(aig[1], true);
+    }
+    else
+    {
+      int32_t var = define(aig);
+      if (var == 0)
+      {
+        return false;
+      }
+      clause.push_back(id < 0 ? -var : var);
+    }
+  }
+  if (sat)
+  {
+    clause.clear();
+  }
+  return true;
+}
+
+int32_t
+BvBitblastSolver::LemmaPropagator::define(const bitblast::AigNode& aig)
+{
+  std::vector<bitblast::AigNode> visit{aig};
+  while (!visit.empty())
+  {
+    bitblast::AigNode cur = visit.back();
+    int64_t id            = std::abs(cur.get_id());
+    if (lookup(id) != 0)
+    {
+      visit.pop_back();
+      continue;
+    }
+    // Inputs that are not encoded cannot be expressed over observed
+    // variables.
+    if (!cur.is_and() || d_reserved_idx == d_reserved.size())
+    {
+      return 0;
+    }
+    bitblast::AigNode a = cur[0], b = cur[1];
+    int32_t va = lookup(std::abs(a.get_id()));
+    int32_t vb = lookup(std::abs(b.get_id()));
+    if (va == 0 || vb == 0)
+    {
+      if (va == 0)
+      {
+        visit.push_back(a);
+      }
+      if (vb == 0)
+      {
+        visit.push_back(b);
+      }
+      continue;
+    }
+    visit.pop_back();
+    int32_t var = d_reserved[d_reserved_idx++].get_id();
+    int32_t la  = a.is_negated() ? -va : va;
+    int32_t lb  = b.is_negated() ? -vb : vb;
+    queue_clause({-var, la});
+    queue_clause({-var, lb});
+    queue_clause({var, -la, -lb});
+    d_defined.emplace(id, var);
+  }
+  return lookup(std::abs(aig.get_id()));
+}
+
+int32_t
+BvBitblastSolver::LemmaPropagator::lookup(int64_t id) const
+{
+  assert(id > 0);
+  if (d_solver.d_bitblast_sat_solver->is_observed(id)
+      && d_solver.d_cnf_encoder->is_encoded(id)
+      && d_solver.d_cnf_encoder->is_encoded(-id))
+  {
+    return id;
+  }
+  auto it = d_defined.find(id);
+  return it == d_defined.end() ? 0 : it->second;
+}
+
+void
+BvBitblastSolver::LemmaPropagator::queue_clause(
+    const std::initializer_list<int32_t>& clause)
+{
+  d_clauses.insert(d_clauses.end(), clause.begin(), clause.end());
+  d_clauses.push_back(0);
+  ++d_solver.d_stats.num_lemma_clauses;
+}
+
+/** Backtrackable that opens and closes scopes on push/pop. */
+class BvBitblastSolver::ScopeBacktrack : public backtrack::Backtrackable
+{
+ public:
+  ScopeBacktrack(BvBitblastSolver& solver)
+      : Backtrackable(solver.d_solver_state.backtrack_mgr()), d_solver(solver)
+  {
+  }
+
+  void push() override { d_solver.push_scope(); }
+
+  void pop() override { d_solver.pop_scope(); }
+
+ private:
+  /** The associated bit-blast solver. */
+  BvBitblastSolver& d_solver;
 };
 
 /* --- BvBitblastSolver public ---------------------------------------------- */
@@ -56,45 +687,103 @@ BvBitblastSolver::BvBitblastSolver(Env& env, SolverState& state)
       d_last_result(Result::UNKNOWN),
       d_stats(env.statistics(), "solver::bv::bitblast::")
 {
-  d_sat_solver.reset(sat::new_sat_solver(env.options()));
+  if (env.options().cube_depth() > 0)
+  {
+    d_cube_solver = new sat::CubeAndConquer(env.options());
+    d_sat_solver.reset(d_cube_solver);
+  }
+  else
+  {
+    d_sat_solver.reset(sat::new_sat_solver(env.options()));
+  }
   d_bitblast_sat_solver.reset(new BitblastSatSolver(*d_sat_solver));
   d_cnf_encoder.reset(new bitblast::AigCnfEncoder(*d_bitblast_sat_solver));
+
+  if (env.options().fraig())
+  {
+    d_fraiger.reset(
+        new AigFraiger(env, d_bitblaster, "solver::bv::bitblast::fraig::"));
+  }
+
+  if (env.options().scoped_bitblast())
+  {
+    d_scope_backtrack.reset(new ScopeBacktrack(*this));
+  }
+
+  if (env.options().lemmas_in_search() && d_sat_solver->supports_propagator())
+  {
+    d_propagator.reset(new LemmaPropagator(*this));
+    d_sat_solver->connect_propagator(d_propagator.get());
+    d_bitblast_sat_solver->enable_observe();
+  }
+
+  // The prop solver requires the bits of all subterms of bit-blasted
+  // assertions, which are not available for imported terms.
+  if (env.options().shared_bitblast_cache()
+      && env.options().bv_solver() == option::BvSolver::BITBLAST)
+  {
+    d_shared_cache = &env.nm().bitblast_cache();
+    sync_cache();
+  }
 }
 
-BvBitblastSolver::~BvBitblastSolver() {}
+BvBitblastSolver::~BvBitblastSolver()
+{
+  if (d_propagator)
+  {
+    d_sat_solver->connect_propagator(nullptr);
+  }
+}
 
 Result
 BvBitblastSolver::solve()
 {
   d_sat_solver->configure_terminator(d_env.terminator());
 
-  if (!d_assertions.empty())
-  {
-    util::Timer timer(d_stats.time_encode);
-    for (const Node& assertion : d_assertions)
-    {
-      const auto& bits = d_bitblaster.bits(assertion);
-      assert(!bits.empty());
-      d_cnf_encoder->encode(bits[0], true);
-    }
-    d_assertions.clear();
-  }
+  encode_assertions();
 
+  std::vector<bitblast::AigNode> assumptions;
   for (const Node& assumption : d_assumptions)
   {
     const auto& bits = d_bitblaster.bits(assumption);
     assert(!bits.empty());
     util::Timer timer(d_stats.time_encode);
-    d_cnf_encoder->encode(bits[0], false);
+    d_cnf_encoder->encode_assumption(bits[0]);
     d_sat_solver->assume(bits[0].get_id());
+    if (d_cube_solver)
+    {
+      assumptions.push_back(bits[0]);
+    }
+  }
+
+  // Clauses of open scopes are only active if their activation literals are
+  // assumed.
+  for (int64_t activation : d_cnf_encoder->activations())
+  {
+    d_sat_solver->assume(activation);
+  }
+
+  if (d_cube_solver)
+  {
+    d_cube_solver->set_split_vars(split_vars(assumptions));
   }
 
   // Update CNF statistics
   update_statistics();
 
+  if (d_propagator)
+  {
+    d_propagator->reset();
+    d_bitblast_sat_solver->flush_observed();
+  }
+
   d_solver_state.print_statistics();
   util::Timer timer(d_stats.time_sat);
   d_last_result = d_sat_solver->solve();
+  if (d_cube_solver)
+  {
+    d_stats.num_cubes += d_cube_solver->num_cubes_solved();
+  }
 
   return d_last_result;
 }
@@ -121,7 +810,18 @@ BvBitblastSolver::register_assertion(const Node& assertion,
 
   {
     util::Timer timer(d_stats.time_bitblast);
-    d_bitblaster.bitblast(assertion);
+    if (d_shared_cache && !is_lemma && d_bitblaster.bits(assertion).empty())
+    {
+      if (!import_cached(assertion))
+      {
+        d_bitblaster.bitblast(assertion);
+        export_cached(assertion);
+      }
+    }
+    else
+    {
+      d_bitblaster.bitblast(assertion);
+    }
   }
 
   // Update AIG statistics
@@ -176,6 +876,335 @@ BvBitblastSolver::unsat_core(std::vector<Node>& core) const
 
 /* --- BvBitblastSolver private --------------------------------------------- */
 
+void
+BvBitblastSolver::encode_assertions()
+{
+  if (d_assertions.empty())
+  {
+    return;
+  }
+
+  std::vector<bitblast::AigNode> roots;
+  for (const Node& assertion : d_assertions)
+  {
+    const auto& bits = d_bitblaster.bits(assertion);
+    assert(!bits.empty());
+    roots.push_back(bits[0]);
+  }
+  d_assertions.clear();
+  // Assumptions are not reduced since their AIGs are required for
+  // extracting unsat cores.
+  if (d_fraiger)
+  {
+    roots = d_fraiger->fraig(roots);
+  }
+
+  util::Timer timer(d_stats.time_encode);
+  for (const bitblast::AigNode& root : roots)
+  {
+    d_cnf_encoder->encode(root, true);
+    if (d_cube_solver)
+    {
+      d_cube_roots.push_back(root);
+    }
+  }
+}
+
+void
+BvBitblastSolver::push_scope()
+{
+  encode_assertions();
+  d_bitblaster.push();
+  bitblast::AigNode activation = d_bitblaster.mk_const();
+  d_cnf_encoder->push(activation.get_id());
+  d_scopes.push_back({activation, d_cube_roots.size(), d_cache_trail.size()});
+}
+
+void
+BvBitblastSolver::pop_scope()
+{
+  assert(!d_scopes.empty());
+  const Scope& scope = d_scopes.back();
+  // Unmap AIG nodes of the shared cache mapped within the scope. Bits of
+  // leaves bit-blasted within the scope are released by the bit-blaster, the
+  // leaves get fresh bits when they are bit-blasted again.
+  while (d_cache_trail.size() > scope.d_cache_trail_size)
+  {
+    auto it = d_from_cache.find(d_cache_trail.back());
+    assert(it != d_from_cache.end());
+    d_to_cache.erase(it->second.get_id());
+    d_from_cache.erase(it);
+    d_cache_trail.pop_back();
+  }
+  d_bitblaster.pop();
+  d_cnf_encoder->pop();
+  d_cube_roots.erase(d_cube_roots.begin() + scope.d_num_cube_roots,
+                     d_cube_roots.end());
+  d_scopes.pop_back();
+  if (d_fraiger)
+  {
+    d_fraiger->garbage_collect();
+  }
+  update_statistics();
+}
+
+std::vector<int32_t>
+BvBitblastSolver::split_vars(const std::vector<bitblast::AigNode>& assumptions)
+{
+  assert(d_cube_solver);
+  // Rank encoded AIG nodes by their number of parents, prefer inputs. This is
+  // a static approximation of lookahead scoring, since the SAT solver
+  // interface does not support propagation without solving.
+  std::vector<std::tuple<bool, uint32_t, int32_t>> candidates;
+  std::unordered_set<int64_t> cache;
+  std::vector<bitblast::AigNode> visit(d_cube_roots.begin(),
+                                       d_cube_roots.end());
+  visit.insert(visit.end(), assumptions.begin(), assumptions.end());
+  while (!visit.empty())
+  {
+    bitblast::AigNode cur = visit.back();
+    visit.pop_back();
+    if (cur.is_true() || cur.is_false())
+    {
+      continue;
+    }
+    int64_t id = std::abs(cur.get_id());
+    if (!cache.insert(id).second)
+    {
+      continue;
+    }
+    if (d_cube_solver->has_var(id))
+    {
+      candidates.emplace_back(cur.is_const(), cur.parents(), id);
+    }
+    if (cur.is_and())
+    {
+      visit.push_back(cur[0]);
+      visit.push_back(cur[1]);
+    }
+  }
+
+  size_t depth = std::min<size_t>(d_env.options().cube_depth(),
+                                  candidates.size());
+  std::partial_sort(candidates.begin(),
+                    candidates.begin() + depth,
+                    candidates.end(),
+                    std::greater<>());
+  std::vector<int32_t> res;
+  for (size_t i = 0; i < depth; ++i)
+  {
+    res.push_back(std::get<2>(candidates[i]));
+  }
+  return res;
+}
+
+bool
+BvBitblastSolver::import_cached(const Node& term)
+{
+  sync_cache();
+  BitblastCache::Cone cone;
+  if (!d_shared_cache->find(*d_cache_generation, term.id(), cone)
+      || !map_cached_leaves(term))
+  {
+    return false;
+  }
+  for (int64_t var : cone.d_inputs)
+  {
+    auto it = d_from_cache.find(var);
+    if (it == d_from_cache.end())
+    {
+      // Should not happen, the inputs of the cone are the leaves of the term.
+      assert(false);
+      return false;
+    }
+    d_cnf_encoder->encode(it->second);
+  }
+  d_cnf_encoder->encode(d_from_cache.at(BitblastCache::TRUE_VAR));
+
+  auto local_lit = [this](int64_t lit) {
+    int64_t id = d_from_cache.at(std::abs(lit)).get_id();
+    return lit < 0 ? -id : id;
+  };
+
+  // Variables of AND gates that are not yet known are encoded as fresh AIG
+  // constants constrained by the clauses of the gate.
+  for (const auto& [x, a, b] : cone.d_gates)
+  {
+    auto it = d_from_cache.find(x);
+    if (it != d_from_cache.end())
+    {
+      d_cnf_encoder->encode(it->second);
+      continue;
+    }
+    bitblast::AigNode aig = d_bitblaster.mk_const();
+    d_cnf_encoder->encode(aig);
+    int64_t lx = aig.get_id();
+    int64_t la = local_lit(a);
+    int64_t lb = local_lit(b);
+    d_bitblast_sat_solver->add_clause({-lx, la});
+    d_bitblast_sat_solver->add_clause({-lx, lb});
+    d_bitblast_sat_solver->add_clause({lx, -la, -lb});
+    d_stats.num_cache_clauses += 3;
+    map_cache_var(x, aig);
+  }
+
+  bitblast::AigBitblaster::Bits bits;
+  for (int64_t lit : cone.d_bits)
+  {
+    const bitblast::AigNode& aig = d_from_cache.at(std::abs(lit));
+    bits.push_back(lit < 0 ? d_bitblaster.mk_not(aig) : aig);
+  }
+  d_bitblaster.set_bits(term, bits);
+  ++d_stats.num_cache_imports;
+  return true;
+}
+
+void
+BvBitblastSolver::export_cached(const Node& term)
+{
+  sync_cache();
+  if (d_shared_cache->contains(term.id()) || !map_cached_leaves(term))
+  {
+    return;
+  }
+
+  auto cache_lit = [this](const bitblast::AigNode& aig) {
+    int64_t var = d_to_cache.at(std::abs(aig.get_id()));
+    return aig.is_negated() ? -var : var;
+  };
+
+  // Map AND gates in the cone of the term to variables of the shared cache.
+  const auto& bits = d_bitblaster.bits(term);
+  std::vector<bitblast::AigNode> visit(bits.begin(), bits.end());
+  do
+  {
+    bitblast::AigNode cur = visit.back();
+    int64_t id            = std::abs(cur.get_id());
+    if (d_to_cache.find(id) != d_to_cache.end())
+    {
+      visit.pop_back();
+      continue;
+    }
+    if (!cur.is_and())
+    {
+      // Should not happen, all AIG constants in the cone are bits of leaves.
+      assert(false);
+      return;
+    }
+
+    bool mapped = true;
+    for (size_t i = 0; i < 2; ++i)
+    {
+      if (d_to_cache.find(std::abs(cur[i].get_id())) == d_to_cache.end())
+      {
+        visit.push_back(cur[i]);
+        mapped = false;
+      }
+    }
+    if (mapped)
+    {
+      int64_t var = d_shared_cache->mk_and(
+          *d_cache_generation, cache_lit(cur[0]), cache_lit(cur[1]));
+      if (var == 0)
+      {
+        // The cache started a new generation, mappings are dropped on the
+        // next call to sync_cache().
+        return;
+      }
+      map_cache_var(var, cur.is_negated() ? d_bitblaster.mk_not(cur) : cur);
+      visit.pop_back();
+    }
+  } while (!visit.empty());
+
+  std::vector<int64_t> lits;
+  for (const bitblast::AigNode& aig : bits)
+  {
+    lits.push_back(cache_lit(aig));
+  }
+  if (d_shared_cache->insert(*d_cache_generation, term.id(), lits))
+  {
+    ++d_stats.num_cache_exports;
+  }
+}
+
+bool
+BvBitblastSolver::map_cached_leaves(const Node& term)
+{
+  node_ref_vector visit{term};
+  unordered_node_ref_set cache;
+  do
+  {
+    const Node& cur = visit.back();
+    visit.pop_back();
+    if (!cache.insert(cur).second)
+    {
+      continue;
+    }
+    if (!BvSolver::is_leaf(cur))
+    {
+      visit.insert(visit.end(), cur.begin(), cur.end());
+      continue;
+    }
+    if (cur.is_value())
+    {
+      continue;
+    }
+
+    d_bitblaster.bitblast(cur);
+    const auto& bits = d_bitblaster.bits(cur);
+    std::vector<int64_t> vars;
+    if (!d_shared_cache->leaf(*d_cache_generation, cur.id(), bits.size(), vars))
+    {
+      return false;
+    }
+    for (size_t i = 0, size = bits.size(); i < size; ++i)
+    {
+      if (d_from_cache.find(vars[i]) == d_from_cache.end())
+      {
+        map_cache_var(vars[i], bits[i]);
+      }
+      assert(d_from_cache.at(vars[i]) == bits[i]);
+      assert(d_to_cache.at(bits[i].get_id()) == vars[i]);
+    }
+  } while (!visit.empty());
+  return true;
+}
+
+void
+BvBitblastSolver::sync_cache()
+{
+  uint64_t generation = d_shared_cache->generation();
+  if (d_cache_generation == generation)
+  {
+    return;
+  }
+  // Variables of previous generations are reused by the cache.
+  d_from_cache.clear();
+  d_to_cache.clear();
+  d_cache_trail.clear();
+  for (Scope& scope : d_scopes)
+  {
+    scope.d_cache_trail_size = 0;
+  }
+  bitblast::AigNode true_aig = d_bitblaster.mk_true();
+  d_to_cache.emplace(true_aig.get_id(), BitblastCache::TRUE_VAR);
+  d_from_cache.emplace(BitblastCache::TRUE_VAR, true_aig);
+  d_cache_generation = generation;
+}
+
+void
+BvBitblastSolver::map_cache_var(int64_t var, const bitblast::AigNode& aig)
+{
+  assert(!aig.is_negated());
+  [[maybe_unused]] bool inserted = d_from_cache.emplace(var, aig).second;
+  assert(inserted);
+  d_to_cache.emplace(aig.get_id(), var);
+  if (!d_scopes.empty())
+  {
+    d_cache_trail.push_back(var);
+  }
+}
+
 void
 BvBitblastSolver::update_statistics()
 {
@@ -201,7 +1230,20 @@ BvBitblastSolver::Statistics::Statistics(util::Statistics& stats,
       num_aig_shared(stats.new_stat<uint64_t>(prefix + "aig::num_shared")),
       num_cnf_vars(stats.new_stat<uint64_t>(prefix + "cnf::num_vars")),
       num_cnf_clauses(stats.new_stat<uint64_t>(prefix + "cnf::num_clauses")),
-      num_cnf_literals(stats.new_stat<uint64_t>(prefix + "cnf::num_literals"))
+      num_cnf_literals(stats.new_stat<uint64_t>(prefix + "cnf::num_literals")),
+      num_checks_in_search(
+          stats.new_stat<uint64_t>(prefix + "sat::num_checks_in_search")),
+      num_partial_checks_in_search(stats.new_stat<uint64_t>(
+          prefix + "sat::num_partial_checks_in_search")),
+      num_lemma_clauses(
+          stats.new_stat<uint64_t>(prefix + "sat::num_lemma_clauses")),
+      num_cubes(stats.new_stat<uint64_t>(prefix + "sat::num_cubes")),
+      num_cache_imports(
+          stats.new_stat<uint64_t>(prefix + "cache::num_imports")),
+      num_cache_exports(
+          stats.new_stat<uint64_t>(prefix + "cache::num_exports")),
+      num_cache_clauses(
+          stats.new_stat<uint64_t>(prefix + "cache::num_clauses"))
 {
 }
 
@@ -11,10 +11,16 @@
 #ifndef BZLA_SOLVER_BV_BV_BITBLAST_SOLVER_H_INCLUDED
 #define BZLA_SOLVER_BV_BV_BITBLAST_SOLVER_H_INCLUDED
 
+#include <optional>
+#include <unordered_map>
+
 #include "backtrack/vector.h"
 #include "bitblast/aig/aig_cnf.h"
+#include "sat/cube_and_conquer.h"
 #include "sat/sat_solver.h"
 #include "solver/bv/aig_bitblaster.h"
+#include "solver/bv/aig_fraiger.h"
+#include "solver/bv/bitblast_cache.h"
 #include "solver/bv/bv_solver_interface.h"
 #include "solver/solver.h"
 #include "util/statistics.h"
@@ -51,8 +57,80 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
   /** Update AIG and CNF statistics. */
   void update_statistics();
 
+  /**
+   * Encode the current top-level assertions to CNF, fraiged if option fraig
+   * is enabled.
+   */
+  void encode_assertions();
+
+  /**
+   * Open a new scope for bit-blasted terms and their CNF encoding.
+   *
+   * Pending top-level assertions are encoded before opening the scope since
+   * they belong to the enclosing scope.
+   */
+  void push_scope();
+  /**
+   * Release the terms bit-blasted within the current scope and disable the
+   * clauses of their CNF encoding.
+   */
+  void pop_scope();
+
+  /**
+   * Select splitting variables for cube-and-conquer.
+   *
+   * Selects the encoded AIG nodes with the highest number of parents,
+   * preferring inputs (AIG constants), e.g., inputs of multipliers.
+   *
+   * @param assumptions The AIGs of the current assumptions.
+   * @return The splitting variables, at most as many as configured via
+   *         option cube_depth.
+   */
+  std::vector<int32_t> split_vars(
+      const std::vector<bitblast::AigNode>& assumptions);
+
+  /**
+   * Import the CNF encoding of given term from the shared bit-blast cache.
+   * @param term The term.
+   * @return False if the term is not cached.
+   */
+  bool import_cached(const Node& term);
+
+  /**
+   * Add given bit-blasted term to the shared bit-blast cache.
+   * @param term The term.
+   */
+  void export_cached(const Node& term);
+
+  /**
+   * Bit-blast the leaves of given term and map their bits to the input
+   * variables of the shared bit-blast cache.
+   * @param term The term.
+   * @return False if the generation of variables of the shared cache changed.
+   */
+  bool map_cached_leaves(const Node& term);
+
+  /**
+   * Drop the mappings of variables of the shared bit-blast cache if the cache
+   * started a new generation of variables.
+   */
+  void sync_cache();
+
+  /**
+   * Map variable of the shared bit-blast cache to given AIG node. The mapping
+   * is recorded on `d_cache_trail` if a scope is open and removed when the
+   * scope is popped, since the AIG node may be released on pop.
+   * @param var The variable of the shared cache.
+   * @param aig The (non-negated) AIG node.
+   */
+  void map_cache_var(int64_t var, const bitblast::AigNode& aig);
+
   /** Sat interface used for d_cnf_encoder. */
   class BitblastSatSolver;
+  /** Propagator for checking theory lemmas during SAT search. */
+  class LemmaPropagator;
+  /** Syncs push/pop with the scopes of bit-blasted terms. */
+  class ScopeBacktrack;
 
   /** The current set of assertions. */
   backtrack::vector<Node> d_assertions;
@@ -61,16 +139,62 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
 
   /** AIG bit-blaster. */
   AigBitblaster d_bitblaster;
+  /** Fraiging of AIGs before encoding, nullptr if option fraig is disabled. */
+  std::unique_ptr<AigFraiger> d_fraiger;
 
   /** CNF encoder for AIGs. */
   std::unique_ptr<bitblast::AigCnfEncoder> d_cnf_encoder;
   /** SAT solver used for solving bit-blasted formula. */
   std::unique_ptr<sat::SatSolver> d_sat_solver;
+  /**
+   * Cube-and-conquer solver if option cube_depth is enabled, owned by
+   * `d_sat_solver`.
+   */
+  sat::CubeAndConquer* d_cube_solver = nullptr;
+  /** The encoded assertions, used for selecting splitting variables. */
+  std::vector<bitblast::AigNode> d_cube_roots;
   /** SAT solver interface for CNF encoder, which wraps `d_sat_solver`. */
   std::unique_ptr<BitblastSatSolver> d_bitblast_sat_solver;
+  /**
+   * Propagator connected to `d_sat_solver` if option lemmas_in_search is
+   * enabled and supported by the SAT solver.
+   */
+  std::unique_ptr<LemmaPropagator> d_propagator;
   /** Result of last solve() call. */
   Result d_last_result;
 
+  /**
+   * Syncs scopes of bit-blasted terms with push/pop if option
+   * scoped_bitblast is enabled.
+   */
+  std::unique_ptr<ScopeBacktrack> d_scope_backtrack;
+  /** Open scope of bit-blasted terms. */
+  struct Scope
+  {
+    /** The activation literal of the scope. */
+    bitblast::AigNode d_activation;
+    /** The size of `d_cube_roots` at the start of the scope. */
+    size_t d_num_cube_roots;
+    /** The size of `d_cache_trail` at the start of the scope. */
+    size_t d_cache_trail_size;
+  };
+  /** The currently open scopes. */
+  std::vector<Scope> d_scopes;
+
+  /**
+   * Bit-blast cache shared via the node manager, nullptr if option
+   * shared_bitblast_cache is disabled.
+   */
+  BitblastCache* d_shared_cache = nullptr;
+  /** Maps variables of the shared cache to AIG nodes. */
+  std::unordered_map<int64_t, bitblast::AigNode> d_from_cache;
+  /** Maps AIG ids to variables of the shared cache. */
+  std::unordered_map<int64_t, int64_t> d_to_cache;
+  /** Variables of the shared cache mapped within the open scopes. */
+  std::vector<int64_t> d_cache_trail;
+  /** The generation of variables of the shared cache mapped above. */
+  std::optional<uint64_t> d_cache_generation;
+
   struct Statistics
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
@@ -83,6 +207,13 @@ class BvBitblastSolver : public Solver, public BvSolverInterface
     uint64_t& num_cnf_vars;
     uint64_t& num_cnf_clauses;
     uint64_t& num_cnf_literals;
+    uint64_t& num_checks_in_search;
+    uint64_t& num_partial_checks_in_search;
+    uint64_t& num_lemma_clauses;
+    uint64_t& num_cubes;
+    uint64_t& num_cache_imports;
+    uint64_t& num_cache_exports;
+    uint64_t& num_cache_clauses;
   } d_stats;
 };
 
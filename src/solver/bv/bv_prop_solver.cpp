@@ -10,8 +10,13 @@
 
 #include "solver/bv/bv_prop_solver.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "bv/domain/bitvector_domain.h"
 #include "env.h"
@@ -34,7 +39,7 @@ BvPropSolver::BvPropSolver(Env& env,
                            BvBitblastSolver& bb_solver)
     : Solver(env, state),
       d_bb_solver(bb_solver),
-      d_ls_backtrack(state.backtrack_mgr(), nullptr),
+      d_ls_backtrack(state.backtrack_mgr()),
       d_stats(env.statistics(), "solver::bv::prop::")
 {
   const option::Options& options = d_env.options();
@@ -58,7 +63,30 @@ BvPropSolver::BvPropSolver(Env& env,
 
   d_ls->init();
 
-  d_ls_backtrack.d_ls = d_ls.get();
+  d_ls_backtrack.d_ls.push_back(d_ls.get());
+  d_ls_result = d_ls.get();
+
+  // Configure parallel workers. Worker i uses a different seed, every other
+  // worker flips the configured path selection mode, and the probability for
+  // inverse value selection is varied over pairs of workers.
+  static constexpr uint32_t s_prob_pick_inv_value[] = {990, 900, 750, 500};
+  for (uint64_t i = 1, n = options.prop_nthreads(); i < n; ++i)
+  {
+    auto& worker = d_ls_workers.emplace_back(
+        new ls::LocalSearchBV(options.prop_nprops(),
+                              options.prop_nupdates(),
+                              options.seed() + i,
+                              options.log_level(),
+                              options.verbosity()));
+    worker->d_options = d_ls->d_options;
+    if (i % 2)
+    {
+      worker->d_options.use_path_sel_essential =
+          !worker->d_options.use_path_sel_essential;
+    }
+    worker->d_options.prob_pick_inv_value = s_prob_pick_inv_value[(i / 2) % 4];
+    d_ls_backtrack.d_ls.push_back(worker.get());
+  }
 
   d_use_sext       = options.prop_sext();
   d_use_const_bits = options.prop_const_bits();
@@ -84,7 +112,17 @@ BvPropSolver::solve()
 
   if (d_env.options().prop_normalize())
   {
-    d_ls->normalize();
+    for (auto ls : d_ls_backtrack.d_ls)
+    {
+      ls->normalize();
+    }
+  }
+
+  d_ls_result = d_ls.get();
+  if (!d_ls_workers.empty())
+  {
+    sat_result = solve_parallel(nprops, nupdates);
+    goto DONE;
   }
 
   // incremental: increase limit by given nprops/nupdates
@@ -191,7 +229,10 @@ BvPropSolver::register_assertion(const Node& assertion,
   } while (!visit.empty());
 
   uint64_t id = d_node_map.at(assertion);
-  d_ls->register_root(id, top_level);
+  for (auto ls : d_ls_backtrack.d_ls)
+  {
+    ls->register_root(id, top_level);
+  }
   // Reverse map assertions for unsat cores.
   d_root_id_node_map[id] = assertion;
 }
@@ -206,7 +247,7 @@ BvPropSolver::value(const Node& term)
   {
     return utils::mk_default_value(nm, term.type());
   }
-  const BitVector& value = d_ls->get_assignment(it->second);
+  const BitVector& value = d_ls_result->get_assignment(it->second);
   if (term.type().is_bool())
   {
     return nm.mk_value(value.is_true());
@@ -219,7 +260,7 @@ BvPropSolver::unsat_core(std::vector<Node>& core) const
 {
   // The LocalSearchBV library can only determine unsat if a single root is
   // false. Hence, the unsat core always consists of one root.
-  auto it = d_root_id_node_map.find(d_ls->get_false_root());
+  auto it = d_root_id_node_map.find(d_ls_result->get_false_root());
   assert(it != d_root_id_node_map.end());
   core.push_back(it->second);
 }
@@ -278,27 +319,27 @@ BvPropSolver::mk_node(const Node& node)
   {
     case Kind::BV_ADD:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_ADD,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_ADD,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_AND:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_AND,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_AND,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_ASHR:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_ASHR,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_ASHR,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_CONCAT:
       assert(node.num_children() == 2);
@@ -306,152 +347,263 @@ BvPropSolver::mk_node(const Node& node)
         Node child;
         if (d_use_sext && node::utils::is_bv_sext(node, child))
         {
-          res = d_ls->mk_node(bzla::ls::NodeKind::BV_SEXT,
-                              domain,
-                              {d_node_map.at(child)},
-                              {node[0].type().bv_size()},
-                              symbol);
+          res = mk_ls_node(bzla::ls::NodeKind::BV_SEXT,
+                           domain,
+                           {d_node_map.at(child)},
+                           {node[0].type().bv_size()},
+                           symbol);
         }
         else
         {
-          res = d_ls->mk_node(bzla::ls::NodeKind::BV_CONCAT,
-                              domain,
-                              {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                              {},
-                              symbol);
+          res = mk_ls_node(bzla::ls::NodeKind::BV_CONCAT,
+                           domain,
+                           {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                           {},
+                           symbol);
         }
       }
       break;
     case Kind::BV_EXTRACT:
       assert(node.num_children() == 1);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_EXTRACT,
-                          domain,
-                          {d_node_map.at(node[0])},
-                          {node.index(0), node.index(1)},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_EXTRACT,
+                       domain,
+                       {d_node_map.at(node[0])},
+                       {node.index(0), node.index(1)},
+                       symbol);
       break;
     case Kind::BV_MUL:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_MUL,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_MUL,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_NOT:
       assert(node.num_children() == 1);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_NOT,
-                          domain,
-                          {d_node_map.at(node[0])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_NOT,
+                       domain,
+                       {d_node_map.at(node[0])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_ULT:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_ULT,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_ULT,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_SHL:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_SHL,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_SHL,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_SLT:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_SLT,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_SLT,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_SHR:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_SHR,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_SHR,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_UDIV:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_UDIV,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_UDIV,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_UREM:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_UREM,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_UREM,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_XOR:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::BV_XOR,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::BV_XOR,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::AND:
       assert(node.num_children() == 2);
-      res = d_ls->mk_node(bzla::ls::NodeKind::AND,
-                          domain,
-                          {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::AND,
+                       domain,
+                       {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                       {},
+                       symbol);
       break;
     case Kind::BV_COMP:
     case Kind::EQUAL:
       assert(node.num_children() == 2);
       if (BvSolver::is_leaf(node))
       {
-        res = d_ls->mk_node(domain.lo(), domain, symbol);
+        res = mk_ls_node(domain.lo(), domain, symbol);
       }
       else
       {
-        res = d_ls->mk_node(bzla::ls::NodeKind::EQ,
-                            domain,
-                            {d_node_map.at(node[0]), d_node_map.at(node[1])},
-                            {},
-                            symbol);
+        res = mk_ls_node(bzla::ls::NodeKind::EQ,
+                         domain,
+                         {d_node_map.at(node[0]), d_node_map.at(node[1])},
+                         {},
+                         symbol);
       }
       break;
     case Kind::ITE:
       assert(node.num_children() == 3);
-      res = d_ls->mk_node(bzla::ls::NodeKind::ITE,
-                          domain,
-                          {d_node_map.at(node[0]),
-                           d_node_map.at(node[1]),
-                           d_node_map.at(node[2])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::ITE,
+                       domain,
+                       {d_node_map.at(node[0]),
+                        d_node_map.at(node[1]),
+                        d_node_map.at(node[2])},
+                       {},
+                       symbol);
       break;
     case Kind::NOT:
       assert(node.num_children() == 1);
-      res = d_ls->mk_node(bzla::ls::NodeKind::NOT,
-                          domain,
-                          {d_node_map.at(node[0])},
-                          {},
-                          symbol);
+      res = mk_ls_node(bzla::ls::NodeKind::NOT,
+                       domain,
+                       {d_node_map.at(node[0])},
+                       {},
+                       symbol);
       break;
     default:
       assert(BvSolver::is_leaf(node));
-      res = d_ls->mk_node(domain.lo(), domain, symbol);
+      res = mk_ls_node(domain.lo(), domain, symbol);
   }
 
   return res;
 }
 
+uint64_t
+BvPropSolver::mk_ls_node(bzla::ls::NodeKind kind,
+                         const BitVectorDomain& domain,
+                         const std::vector<uint64_t>& children,
+                         const std::vector<uint64_t>& indices,
+                         const std::string& symbol)
+{
+  uint64_t res = d_ls->mk_node(kind, domain, children, indices, symbol);
+  for (auto& ls : d_ls_workers)
+  {
+    [[maybe_unused]] uint64_t id =
+        ls->mk_node(kind, domain, children, indices, symbol);
+    assert(id == res);
+  }
+  return res;
+}
+
+uint64_t
+BvPropSolver::mk_ls_node(const BitVector& assignment,
+                         const BitVectorDomain& domain,
+                         const std::string& symbol)
+{
+  uint64_t res = d_ls->mk_node(assignment, domain, symbol);
+  for (auto& ls : d_ls_workers)
+  {
+    [[maybe_unused]] uint64_t id = ls->mk_node(assignment, domain, symbol);
+    assert(id == res);
+  }
+  return res;
+}
+
+Result
+BvPropSolver::solve_parallel(uint64_t nprops, uint64_t nupdates)
+{
+  std::atomic<bool> done(false);
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t nrunning                 = d_ls_backtrack.d_ls.size();
+  bzla::ls::LocalSearchBV* winner = nullptr;
+  bzla::ls::Result res            = bzla::ls::Result::UNKNOWN;
+
+  auto run = [&](bzla::ls::LocalSearchBV* ls) {
+    // The path selection configuration is thread-local, initialize on the
+    // thread that runs the worker.
+    ls->init();
+    // incremental: increase limit by given nprops/nupdates
+    uint64_t max_nprops   = nprops ? nprops + ls->num_props() : 0;
+    uint64_t max_nupdates = nupdates ? nupdates + ls->num_updates() : 0;
+    ls->set_max_nprops(max_nprops);
+    ls->set_max_nupdates(max_nupdates);
+
+    bzla::ls::Result r = bzla::ls::Result::UNKNOWN;
+    while (r == bzla::ls::Result::UNKNOWN && !done.load()
+           && (!max_nprops || ls->num_props() < max_nprops)
+           && (!max_nupdates || ls->num_updates() < max_nupdates))
+    {
+      r = ls->move();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (r != bzla::ls::Result::UNKNOWN && winner == nullptr)
+    {
+      winner = ls;
+      res    = r;
+      done   = true;
+    }
+    --nrunning;
+    cv.notify_one();
+  };
+
+  Log(1) << "start " << d_ls_backtrack.d_ls.size()
+         << " parallel local search workers";
+
+  std::vector<std::thread> threads;
+  for (auto ls : d_ls_backtrack.d_ls)
+  {
+    threads.emplace_back(run, ls);
+  }
+  {
+    // Poll the terminator on the main thread.
+    std::unique_lock<std::mutex> lock(mutex);
+    while (nrunning > 0)
+    {
+      if (!cv.wait_for(lock, std::chrono::milliseconds(10), [&nrunning]() {
+            return nrunning == 0;
+          }))
+      {
+        if (d_env.terminate())
+        {
+          done = true;
+        }
+      }
+    }
+  }
+  for (auto& t : threads)
+  {
+    t.join();
+  }
+
+  if (winner == nullptr)
+  {
+    return Result::UNKNOWN;
+  }
+  d_ls_result = winner;
+  if (winner != d_ls.get())
+  {
+    ++d_stats.num_worker_results;
+  }
+  return res == bzla::ls::Result::SAT ? Result::SAT : Result::UNSAT;
+}
+
 void
 BvPropSolver::print_progress() const
 {
@@ -471,6 +623,8 @@ BvPropSolver::print_progress() const
 BvPropSolver::Statistics::Statistics(util::Statistics& stats,
                                      const std::string& prefix)
     : num_checks(stats.new_stat<uint64_t>(prefix + "num_checks")),
+      num_worker_results(
+          stats.new_stat<uint64_t>(prefix + "num_worker_results")),
       num_assertions(stats.new_stat<uint64_t>(prefix + "num_assertions")),
       num_bits_fixed(stats.new_stat<uint64_t>(prefix + "num_bits_fixed")),
       num_bits_total(stats.new_stat<uint64_t>(prefix + "num_bits_total")),
@@ -41,17 +41,26 @@ class BvPropSolver : public Solver, public BvSolverInterface
   void unsat_core(std::vector<Node>& core) const override;
 
  private:
-  /** Backtrack manager to sync push/pop with local search engine. */
+  /** Backtrack manager to sync push/pop with local search engines. */
   class LsBacktrack : public backtrack::Backtrackable
   {
    public:
-    LsBacktrack(backtrack::BacktrackManager* mgr, bzla::ls::LocalSearchBV* ls)
-        : Backtrackable(mgr), d_ls(ls)
+    LsBacktrack(backtrack::BacktrackManager* mgr) : Backtrackable(mgr) {}
+    void push() override
     {
+      for (auto ls : d_ls)
+      {
+        ls->push();
+      }
     }
-    void push() override { d_ls->push(); }
-    void pop() override { d_ls->pop(); }
-    bzla::ls::LocalSearchBV* d_ls = nullptr;
+    void pop() override
+    {
+      for (auto ls : d_ls)
+      {
+        ls->pop();
+      }
+    }
+    std::vector<bzla::ls::LocalSearchBV*> d_ls;
   };
 
   /**
@@ -61,6 +70,43 @@ class BvPropSolver : public Solver, public BvSolverInterface
    * @return The id of the created LS bit-vector node.
    */
   uint64_t mk_node(const Node& node);
+  /**
+   * Helper to create LocalSearchBV node in the local search engine and all
+   * its parallel workers.
+   * @param kind     The node kind.
+   * @param domain   The associated bit-vector domain.
+   * @param children The ids of the children.
+   * @param indices  The set of indices, empty for non-indexed nodes.
+   * @param symbol   The symbol of the node.
+   * @return The id of the created LS bit-vector node.
+   */
+  uint64_t mk_ls_node(bzla::ls::NodeKind kind,
+                      const BitVectorDomain& domain,
+                      const std::vector<uint64_t>& children,
+                      const std::vector<uint64_t>& indices,
+                      const std::string& symbol);
+  /**
+   * Helper to create LocalSearchBV leaf node in the local search engine and
+   * all its parallel workers.
+   * @param assignment The initial assignment of the node.
+   * @param domain     The associated bit-vector domain.
+   * @param symbol     The symbol of the node.
+   * @return The id of the created LS bit-vector node.
+   */
+  uint64_t mk_ls_node(const BitVector& assignment,
+                      const BitVectorDomain& domain,
+                      const std::string& symbol);
+
+  /**
+   * Run the local search engines in d_ls_workers in parallel until one of
+   * them determines a result or the limits are reached.
+   * @param nprops   The number of propagations each worker may perform in
+   *                 this check, 0 for no limit.
+   * @param nupdates The number of updates each worker may perform in this
+   *                 check, 0 for no limit.
+   * @return The result.
+   */
+  Result solve_parallel(uint64_t nprops, uint64_t nupdates);
 
   /**
    * Print current progress of LocalSearchBV.
@@ -75,6 +121,17 @@ class BvPropSolver : public Solver, public BvSolverInterface
   BvBitblastSolver& d_bb_solver;
   /** The local search engine. */
   std::unique_ptr<bzla::ls::LocalSearchBV> d_ls;
+  /**
+   * The additional local search workers if option prop_nthreads > 1. All
+   * workers maintain a copy of the local search graph of `d_ls`, with the same
+   * node ids, but use a different configuration.
+   */
+  std::vector<std::unique_ptr<bzla::ls::LocalSearchBV>> d_ls_workers;
+  /**
+   * The local search engine that determined the result of the last solve()
+   * call, used for querying model values and unsat cores.
+   */
+  bzla::ls::LocalSearchBV* d_ls_result = nullptr;
   /** The backtrack manager for the local search engine. */
   LsBacktrack d_ls_backtrack;
   /** Map Bitwuzla node to LocalSearchBV bit-vector node id. */
@@ -90,6 +147,7 @@ class BvPropSolver : public Solver, public BvSolverInterface
   {
     Statistics(util::Statistics& stats, const std::string& prefix);
     uint64_t& num_checks;
+    uint64_t& num_worker_results;
     uint64_t& num_assertions;
     uint64_t& num_bits_fixed;
     uint64_t& num_bits_total;
@@ -16,6 +16,7 @@
 
 #include "env.h"
 #include "node/node.h"
+#include "node/node_map.h"
 #include "solver/fp/floating_point.h"
 
 /* -------------------------------------------------------------------------- */
@@ -57,12 +58,12 @@ class WordBlaster
 
  private:
   using SymUnpackedFloat = ::symfpu::unpackedFloat<SymFpuSymTraits>;
-  using UnpackedFloatMap = std::unordered_map<Node, SymUnpackedFloat>;
-  using SymFpuSymRMMap   = std::unordered_map<Node, SymFpuSymRM>;
-  using SymFpuSymPropMap = std::unordered_map<Node, SymFpuSymProp>;
-  using PackedFloatMap   = std::unordered_map<Node, SymFpuSymBV<false>>;
-  using SymSBVMap        = std::unordered_map<Node, SymFpuSymBV<true>>;
-  using SymUBVMap        = std::unordered_map<Node, SymFpuSymBV<false>>;
+  using UnpackedFloatMap = node::NodeMap<SymUnpackedFloat>;
+  using SymFpuSymRMMap   = node::NodeMap<SymFpuSymRM>;
+  using SymFpuSymPropMap = node::NodeMap<SymFpuSymProp>;
+  using PackedFloatMap   = node::NodeMap<SymFpuSymBV<false>>;
+  using SymSBVMap        = node::NodeMap<SymFpuSymBV<true>>;
+  using SymUBVMap        = node::NodeMap<SymFpuSymBV<false>>;
 
   struct Internal;
 
@@ -0,0 +1,284 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2022 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_SOLVER_QUANT_MBQI_WORKER_H_INCLUDED
+#define BZLA_SOLVER_QUANT_MBQI_WORKER_H_INCLUDED
+
+#include <cassert>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "env.h"
+#include "node/node.h"
+#include "node/node_manager.h"
+#include "node/node_translator.h"
+#include "solver/quant/quant_solver.h"
+#include "solving_context.h"
+#include "terminator.h"
+
+namespace bzla::quant {
+
+/**
+ * MBQI terminator.
+ *
+ * Forwards to the terminator configured in the environment of the quantifier
+ * solver. The terminator is queried at the time of the call, since it may be
+ * reconfigured between checks (e.g., when wrapped by a resource terminator).
+ * Calls are serialized since the workers may run on separate threads.
+ */
+class QuantSolver::MbqiTerminator : public Terminator
+{
+ public:
+  MbqiTerminator(const Env& env) : d_env(env) {}
+  bool terminate() override
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_env.terminate();
+  }
+
+ private:
+  /** The environment of the quantifier solver. */
+  const Env& d_env;
+  /** Serializes calls from workers on separate threads. */
+  std::mutex d_mutex;
+};
+
+/**
+ * MBQI worker.
+ *
+ * Owns a solving context that is kept across MBQI checks. Persistent MBQI
+ * instances (see QuantSolver::mbqi_persistent()) are asserted once at level
+ * 0, guarded by an activation literal, and the model of the current check is
+ * asserted in a separate scope. Each quantifier is checked in a nested scope
+ * that asserts its activation literal or its non-persistent instance. All
+ * scopes are popped at the end of a check.
+ *
+ * Workers that are run on separate threads own a separate node manager,
+ * since node managers are not thread-safe. All nodes are translated from and
+ * to the node manager of the quantifier solver on the main thread, check()
+ * only accesses the node manager of the worker.
+ */
+class QuantSolver::MbqiWorker
+{
+ public:
+  /**
+   * Constructor.
+   * @param env        The environment of the quantifier solver.
+   * @param own_nm     True to create a separate node manager for this worker.
+   * @param terminator The terminator of the worker.
+   */
+  MbqiWorker(Env& env, bool own_nm, Terminator* terminator)
+  {
+    option::Options options;
+    options.abstraction.set(env.options().abstraction());
+    options.pp_normalize.set(false);
+    options.scoped_bitblast.set(true);
+
+    NodeManager* nm = &env.nm();
+    if (own_nm)
+    {
+      d_nm.reset(new NodeManager());
+      d_import.reset(new node::NodeTranslator(*d_nm));
+      d_export.reset(new node::NodeTranslator(env.nm()));
+      nm = d_nm.get();
+    }
+    d_ctx.reset(new SolvingContext(*nm, options, "mbqi", true));
+    d_ctx->env().configure_terminator(terminator);
+  }
+
+  /** Clear the checks of the previous MBQI check. */
+  void clear() { d_checks.clear(); }
+
+  /**
+   * Add quantifier to check.
+   * @param q           The quantifier.
+   * @param inst        The MBQI instance of `q`.
+   * @param inst_consts The instantiation constants of `q`.
+   * @param persistent  True if `inst` does not depend on the current model
+   *                    and is asserted once, guarded by an activation
+   *                    literal. Else, `inst` is only asserted for this check.
+   */
+  void add(const Node& q,
+           const Node& inst,
+           const std::vector<Node>& inst_consts,
+           bool persistent)
+  {
+    Check& check = d_checks.emplace_back();
+    if (persistent)
+    {
+      auto it = d_active.find(q);
+      if (it == d_active.end())
+      {
+        NodeManager& nm = d_ctx->env().nm();
+        std::stringstream ss;
+        ss << "mbqi(" << q.id() << ")";
+        Node active = nm.mk_const(nm.mk_bool_type(), ss.str());
+        d_pending.push_back(
+            nm.mk_node(node::Kind::IMPLIES, {active, translate(inst)}));
+        it = d_active.emplace(q, active).first;
+      }
+      check.d_assertion = it->second;
+    }
+    else
+    {
+      check.d_assertion = translate(inst);
+    }
+    for (const Node& ic : inst_consts)
+    {
+      check.d_inst_consts.push_back(translate(ic));
+    }
+  }
+
+  /**
+   * Set the model of the current MBQI check.
+   * @param model The values of the constants of the ground assertions.
+   */
+  void set_model(const std::vector<std::pair<Node, Node>>& model)
+  {
+    NodeManager& nm = d_ctx->env().nm();
+    d_model.clear();
+    for (const auto& [c, value] : model)
+    {
+      d_model.push_back(
+          nm.mk_node(node::Kind::EQUAL, {translate(c), translate(value)}));
+    }
+    if (d_export)
+    {
+      // Map uninterpreted types back to the node manager of the solver.
+      for (const auto& [from, to] : d_import->type_map())
+      {
+        d_export->add(to, from);
+      }
+    }
+  }
+
+  /** Check all added quantifiers. */
+  void check()
+  {
+    try
+    {
+      for (const Node& assertion : d_pending)
+      {
+        d_ctx->assert_formula(assertion);
+      }
+      d_pending.clear();
+
+      d_ctx->push();
+      for (const Node& assertion : d_model)
+      {
+        d_ctx->assert_formula(assertion);
+      }
+      for (Check& check : d_checks)
+      {
+        d_ctx->push();
+        d_ctx->assert_formula(check.d_assertion);
+        check.d_result = d_ctx->solve();
+        if (check.d_result == Result::SAT)
+        {
+          for (const Node& ic : check.d_inst_consts)
+          {
+            check.d_values.push_back(d_ctx->get_value(ic));
+          }
+        }
+        d_ctx->pop();
+      }
+      d_ctx->pop();
+      assert(d_ctx->backtrack_mgr()->num_levels() == 0);
+    }
+    catch (...)
+    {
+      d_exception = std::current_exception();
+    }
+  }
+
+  /** Rethrow the exception thrown by the last call to check(), if any. */
+  void rethrow()
+  {
+    if (d_exception)
+    {
+      std::exception_ptr e = d_exception;
+      d_exception          = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+  /** @return The number of added quantifiers. */
+  size_t num_checks() const { return d_checks.size(); }
+
+  /**
+   * @param i The index of the added quantifier.
+   * @return The result of the check of the i-th added quantifier.
+   */
+  Result result(size_t i) const { return d_checks[i].d_result; }
+
+  /**
+   * @param i The index of the added quantifier.
+   * @return The values of the instantiation constants of the i-th added
+   *         quantifier, in terms of the node manager of the solver.
+   */
+  std::vector<Node> values(size_t i)
+  {
+    std::vector<Node> res;
+    for (const Node& value : d_checks[i].d_values)
+    {
+      res.push_back(d_export ? d_export->translate(value) : value);
+    }
+    return res;
+  }
+
+ private:
+  /** Translate given node into the node manager of this worker. */
+  Node translate(const Node& node)
+  {
+    return d_import ? d_import->translate(node) : node;
+  }
+
+  struct Check
+  {
+    /**
+     * The activation literal of the instance if it is persistent, else the
+     * instance itself.
+     */
+    Node d_assertion;
+    /** The instantiation constants. */
+    std::vector<Node> d_inst_consts;
+    /** The result of the check. */
+    Result d_result = Result::UNKNOWN;
+    /** The values of the instantiation constants if d_result is SAT. */
+    std::vector<Node> d_values;
+  };
+
+  /** The node manager of the worker if separate, must be destroyed last. */
+  std::unique_ptr<NodeManager> d_nm;
+  /** Translates nodes from the solver into the worker node manager. */
+  std::unique_ptr<node::NodeTranslator> d_import;
+  /** Translates nodes from the worker into the solver node manager. */
+  std::unique_ptr<node::NodeTranslator> d_export;
+  /** The MBQI solving context. */
+  std::unique_ptr<SolvingContext> d_ctx;
+  /** Maps quantifiers to the activation literal of their instance. */
+  std::unordered_map<Node, Node> d_active;
+  /** Guarded instances to assert at level 0 on the next check. */
+  std::vector<Node> d_pending;
+  /** The model equations of the current check. */
+  std::vector<Node> d_model;
+  /** The checks of the current MBQI check. */
+  std::vector<Check> d_checks;
+  /** Exception thrown by the last call to check(). */
+  std::exception_ptr d_exception;
+};
+
+}  // namespace bzla::quant
+
+#endif
@@ -10,11 +10,16 @@
 
 #include "solver/quant/quant_solver.h"
 
+#include <thread>
+
+#include "env.h"
 #include "node/node.h"
 #include "node/node_manager.h"
 #include "node/node_ref_vector.h"
 #include "node/node_utils.h"
 #include "node/unordered_node_ref_map.h"
+#include "node/unordered_node_ref_set.h"
+#include "solver/quant/mbqi_worker.h"
 #include "solving_context.h"
 #include "util/logger.h"
 
@@ -33,6 +38,21 @@ operator<<(std::ostream& os, QuantSolver::LemmaKind kind)
 
 using namespace node;
 
+namespace {
+
+/**
+ * @return True if the model value of a constant of given type can be
+ *         asserted as an equality in the MBQI solver. Equalities over arrays,
+ *         functions and uninterpreted sorts are not (fully) supported.
+ */
+bool
+is_mbqi_model_type(const Type& type)
+{
+  return type.is_bool() || type.is_bv() || type.is_fp() || type.is_rm();
+}
+
+}  // namespace
+
 /* --- QuantSolver public --------------------------------------------------- */
 
 bool
@@ -340,39 +360,113 @@ QuantSolver::mbqi_check(const std::vector<Node>& to_check)
 {
   util::Timer timer(d_stats.time_mbqi);
 
-  // Initialize MBQI solver
-  NodeManager& nm = d_env.nm();
-  option::Options options;
-  options.abstraction.set(d_env.options().abstraction());
-  options.pp_normalize.set(false);
-  d_mbqi_solver.reset(new SolvingContext(d_env.nm(), options, "mbqi", true));
+  if (d_mbqi_workers.empty())
+  {
+    d_mbqi_terminator.reset(new MbqiTerminator(d_env));
+    size_t num_workers = d_env.options().mbqi_nthreads();
+    for (size_t i = 0; i < num_workers; ++i)
+    {
+      d_mbqi_workers.emplace_back(new MbqiWorker(
+          d_env, num_workers > 1, d_mbqi_terminator.get()));
+    }
+  }
 
-  // Assert formula
+  for (auto& worker : d_mbqi_workers)
+  {
+    worker->clear();
+  }
+
+  // Model values. The values of arrays, functions and uninterpreted sorts
+  // are only substituted into non-persistent instances.
+  std::vector<std::pair<Node, Node>> model;
+  std::unordered_map<Node, Node> values, cache;
   for (const Node& c : d_consts)
   {
     Node value = d_solver_state.value(c);
-    d_mbqi_solver->assert_formula(nm.mk_node(Kind::EQUAL, {c, value}));
+    if (is_mbqi_model_type(c.type()))
+    {
+      model.emplace_back(c, value);
+    }
+    values.emplace(c, value);
   }
 
-  size_t num_inactive = 0;
+  // Quantifiers are always checked by the same worker, since their instances
+  // are only asserted once.
+  std::vector<MbqiWorker*> workers;
   for (const Node& q : to_check)
   {
     ++d_stats.mbqi_checks;
-    d_mbqi_solver->push();
-    d_mbqi_solver->assert_formula(mbqi_inst(q));
+    auto [it, inserted] = d_mbqi_worker_index.emplace(
+        q, d_mbqi_worker_index.size() % d_mbqi_workers.size());
+    MbqiWorker* worker = d_mbqi_workers[it->second].get();
+    std::vector<Node> inst_consts;
+    for (Node cur = q; cur.kind() == Kind::FORALL; cur = cur[1])
+    {
+      inst_consts.push_back(inst_const(cur));
+    }
+    if (mbqi_persistent(q))
+    {
+      worker->add(q, mbqi_inst(q), inst_consts, true);
+    }
+    else
+    {
+      worker->add(
+          q,
+          utils::substitute(d_env.nm(), mbqi_inst(q), values, cache),
+          inst_consts,
+          false);
+    }
+    workers.push_back(worker);
+  }
+  for (auto& worker : d_mbqi_workers)
+  {
+    worker->set_model(model);
+  }
+
+  if (d_mbqi_workers.size() == 1)
+  {
+    d_mbqi_workers[0]->check();
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    for (auto& worker : d_mbqi_workers)
+    {
+      if (worker->num_checks() > 0)
+      {
+        threads.emplace_back(&MbqiWorker::check, worker.get());
+      }
+    }
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+  }
+  for (auto& worker : d_mbqi_workers)
+  {
+    worker->rethrow();
+  }
+
+  // Add counterexample lemmas in the order of `to_check`.
+  size_t num_inactive = 0;
+  std::unordered_map<MbqiWorker*, size_t> next;
+  for (size_t i = 0, size = to_check.size(); i < size; ++i)
+  {
+    const Node& q = to_check[i];
+    Result res    = workers[i]->result(next[workers[i]]);
     Log(2) << "mbqi check: " << mbqi_inst(q);
-    auto res = d_mbqi_solver->solve();
     Log(2) << res;
     // Counterexample
     if (res == Result::SAT)
     {
-      lemma(mbqi_lemma(q), LemmaKind::MBQI_INST);
+      lemma(mbqi_lemma(q, workers[i]->values(next[workers[i]])),
+            LemmaKind::MBQI_INST);
     }
     else if (res == Result::UNSAT)
     {
       ++num_inactive;
     }
-    d_mbqi_solver->pop();
+    ++next[workers[i]];
   }
   bool done = num_inactive == to_check.size();
   if (done)
@@ -409,17 +503,51 @@ QuantSolver::mbqi_inst(const Node& q)
   return iit->second;
 }
 
+bool
+QuantSolver::mbqi_persistent(const Node& q)
+{
+  assert(q.kind() == Kind::FORALL);
+
+  auto it = d_mbqi_persistent.find(q);
+  if (it != d_mbqi_persistent.end())
+  {
+    return it->second;
+  }
+
+  bool res = true;
+  unordered_node_ref_set cache;
+  node_ref_vector visit{mbqi_inst(q)};
+  do
+  {
+    const Node& cur = visit.back();
+    visit.pop_back();
+    if (cache.insert(cur).second)
+    {
+      if (cur.kind() == Kind::FORALL || cur.kind() == Kind::EXISTS
+          || (cur.is_const() && !is_mbqi_model_type(cur.type())))
+      {
+        res = false;
+        break;
+      }
+      visit.insert(visit.end(), cur.begin(), cur.end());
+    }
+  } while (!visit.empty());
+  d_mbqi_persistent.emplace(q, res);
+  return res;
+}
+
 Node
-QuantSolver::mbqi_lemma(const Node& q)
+QuantSolver::mbqi_lemma(const Node& q, const std::vector<Node>& values)
 {
   assert(q.kind() == Kind::FORALL);
 
   std::unordered_map<Node, Node> map;
   Node cur = q;
-  while (cur.kind() == Kind::FORALL)
+  for (size_t i = 0; cur.kind() == Kind::FORALL; ++i)
   {
     const Node& ic = inst_const(cur);
-    Node value     = d_mbqi_solver->get_value(ic);
+    assert(i < values.size());
+    Node value = values[i];
     assert(!value.is_null());
     for (const Node& t : d_ground_terms)
     {
@@ -69,9 +69,46 @@ class QuantSolver : public Solver
 
   void process(const Node& q);
 
+  /** Worker that checks MBQI instances of a subset of the quantifiers. */
+  class MbqiWorker;
+  /** Terminator of the MBQI workers, forwards to the solver terminator. */
+  class MbqiTerminator;
+
+  /**
+   * Check the MBQI instances of given quantifiers under the current model.
+   *
+   * Quantifiers are distributed over the MBQI workers, which are run on
+   * separate threads if option mbqi_nthreads is greater than 1. The
+   * counterexample lemmas of all workers are added in a single refinement
+   * round.
+   *
+   * @param to_check The active quantifiers.
+   * @return True if all instances are unsatisfiable.
+   */
   bool mbqi_check(const std::vector<Node>& to_check);
   const Node& mbqi_inst(const Node& q);
-  Node mbqi_lemma(const Node& q);
+  /**
+   * Determine if the MBQI instance of given quantifier can be asserted once
+   * and checked under the model values as assumptions.
+   *
+   * This is not the case for instances with nested quantifiers or with
+   * constants of array, function or uninterpreted sort. Equalities over the
+   * latter are not (fully) supported, and nested quantifiers are only solved
+   * efficiently if the model values are substituted. The model values are
+   * substituted into these instances on every check instead.
+   *
+   * @param q The quantifier.
+   * @return True if the MBQI instance of `q` is persistent.
+   */
+  bool mbqi_persistent(const Node& q);
+  /**
+   * Construct MBQI instantiation lemma for given quantifier.
+   * @param q      The quantifier.
+   * @param values The values of the instantiation constants of `q` in the
+   *               MBQI model, one for each nested quantifier.
+   * @return The lemma.
+   */
+  Node mbqi_lemma(const Node& q, const std::vector<Node>& values);
 
   backtrack::vector<Node> d_quantifiers;
   backtrack::vector<Node> d_assertions;
@@ -85,8 +122,15 @@ class QuantSolver : public Solver
 
   backtrack::unordered_map<Node, Node> d_skolemization_lemmas;
 
-  std::unique_ptr<SolvingContext> d_mbqi_solver;
+  /** The terminator shared by all MBQI workers, must outlive the workers. */
+  std::unique_ptr<MbqiTerminator> d_mbqi_terminator;
+  /** The MBQI workers, kept across MBQI checks. */
+  std::vector<std::unique_ptr<MbqiWorker>> d_mbqi_workers;
+  /** Maps quantifiers to the index of the MBQI worker that checks them. */
+  std::unordered_map<Node, size_t> d_mbqi_worker_index;
   std::unordered_map<Node, Node> d_mbqi_inst;
+  /** Caches the result of mbqi_persistent(). */
+  std::unordered_map<Node, bool> d_mbqi_persistent;
   backtrack::unordered_set<Node> d_lemma_cache;
 
   bool d_added_lemma;
@@ -10,6 +10,7 @@
 
 #include "solver/solver_engine.h"
 
+#include <algorithm>
 #include <iomanip>
 
 #include "env.h"
@@ -85,11 +86,31 @@ SolverEngine::solve()
     }
 
     d_sat_state = d_bv_solver.solve();
+
+    // Lemmas generated during SAT search via check_in_search() that were added
+    // to the SAT solver as clauses are satisfied by the current model and are
+    // dropped. The remaining lemmas are processed in the next round.
+    if (!d_lemmas_added_in_search.empty())
+    {
+      auto added = [this](const Node& lemma) {
+        return d_lemmas_added_in_search.find(lemma)
+               != d_lemmas_added_in_search.end();
+      };
+      d_lemmas.erase(std::remove_if(d_lemmas.begin(), d_lemmas.end(), added),
+                     d_lemmas.end());
+      d_lemmas_added_in_search.clear();
+    }
+
     if (d_sat_state != Result::SAT)
     {
       break;
     }
 
+    if (!d_lemmas.empty())
+    {
+      continue;
+    }
+
     // Determine relevant terms based on current bit-vector model
     if (d_opt_relevant_terms)
     {
@@ -188,8 +209,9 @@ SolverEngine::lemma(const Node& lemma)
   // Lemmas should never simplify to true
   assert(!rewritten.is_value() || !rewritten.value<bool>());
   auto [it, inserted] = d_lemma_cache.insert(rewritten);
-  // Solvers should not send lemma duplicates.
-  assert(inserted);
+  // Solvers should not send lemma duplicates, except for checks of partial
+  // assignments.
+  assert(inserted || d_in_partial_check);
   // There can be duplicates if we add more than one lemma per round.
   if (inserted)
   {
@@ -380,6 +402,53 @@ SolverEngine::process_lemmas()
   d_lemmas.clear();
 }
 
+std::vector<Node>
+SolverEngine::check_in_search(bool partial)
+{
+  assert(d_in_solving_mode);
+  size_t num_lemmas  = d_lemmas.size();
+  d_in_partial_check = partial;
+
+  // The bit-vector assignment changes with every call.
+  d_value_cache.clear();
+
+  if (d_opt_relevant_terms)
+  {
+    find_relevant();
+  }
+
+  // Check theories in the same order as solve(), stop at the first theory
+  // that generates lemmas.
+  d_fp_solver.check();
+  d_stats.num_lemmas_fp += d_lemmas.size() - num_lemmas;
+  if (d_lemmas.size() == num_lemmas && d_am != nullptr)
+  {
+    d_am->check();
+    d_stats.num_lemmas_abstr += d_lemmas.size() - num_lemmas;
+  }
+  if (d_lemmas.size() == num_lemmas)
+  {
+    d_array_solver.check();
+    d_stats.num_lemmas_array += d_lemmas.size() - num_lemmas;
+  }
+  if (d_lemmas.size() == num_lemmas)
+  {
+    d_fun_solver.check();
+    d_stats.num_lemmas_fun += d_lemmas.size() - num_lemmas;
+  }
+  d_value_cache.clear();
+  d_in_partial_check = false;
+
+  d_stats.num_lemmas_search += d_lemmas.size() - num_lemmas;
+  return {d_lemmas.begin() + num_lemmas, d_lemmas.end()};
+}
+
+void
+SolverEngine::lemma_added_in_search(const Node& lemma)
+{
+  d_lemmas_added_in_search.insert(lemma);
+}
+
 Node
 SolverEngine::_value(const Node& term)
 {
@@ -893,6 +962,7 @@ SolverEngine::Statistics::Statistics(util::Statistics& stats,
       num_lemmas_fun(stats.new_stat<uint64_t>(prefix + "lemmas::fun")),
       num_lemmas_quant(stats.new_stat<uint64_t>(prefix + "lemmas::quant")),
       num_lemmas_abstr(stats.new_stat<uint64_t>(prefix + "lemmas::abstr")),
+      num_lemmas_search(stats.new_stat<uint64_t>(prefix + "lemmas::search")),
       time_register_term(
           stats.new_stat<util::TimerStatistic>(prefix + "time_register_term")),
       time_solve(stats.new_stat<util::TimerStatistic>(prefix + "time_solve")),
@@ -16,6 +16,7 @@
 #include "backtrack/pop_callback.h"
 #include "backtrack/unordered_set.h"
 #include "node/node.h"
+#include "node/node_map.h"
 #include "rewrite/rewriter.h"
 #include "solver/array/array_solver.h"
 #include "solver/bv/bv_solver.h"
@@ -116,6 +117,27 @@ class SolverEngine
   /** Process lemmas added via lemma(). */
   void process_lemmas();
 
+  /**
+   * Check theories against the current bit-vector assignment while the SAT
+   * solver is still searching (option lemmas_in_search).
+   *
+   * Quantifiers are only checked after the SAT solver determined a model.
+   *
+   * @param partial True if the assignment is partial. Theory solvers may
+   *                send lemma duplicates in this case, since the values of
+   *                unassigned bits are not consistent with previous lemmas.
+   * @return The lemmas generated by this check. Lemmas are also kept for
+   *         process_lemmas() in the next round of solve(), unless they are
+   *         marked via lemma_added_in_search().
+   */
+  std::vector<Node> check_in_search(bool partial);
+
+  /**
+   * Mark lemma generated by check_in_search() as added to the SAT solver.
+   * @param lemma The lemma.
+   */
+  void lemma_added_in_search(const Node& lemma);
+
   /** Compute value for given term. */
   Node _value(const Node& term);
 
@@ -135,7 +157,7 @@ class SolverEngine
   uint64_t d_num_printed_stats = 0;
 
   /** Model value cache for _value(). */
-  std::unordered_map<Node, Node> d_value_cache;
+  node::NodeMap<Node> d_value_cache;
 
   /** Associated solving context. */
   SolvingContext& d_context;
@@ -155,6 +177,8 @@ class SolverEngine
 
   /** Lemmas added via lemma(). */
   std::vector<Node> d_lemmas;
+  /** Lemmas of d_lemmas already added to the SAT solver during search. */
+  std::unordered_set<Node> d_lemmas_added_in_search;
   /** Indicates whether new terms were registered while solving. */
   bool d_new_terms_registered = false;
   /** Lemma cache. */
@@ -165,6 +189,8 @@ class SolverEngine
 
   /** Indicates whether solver engine is currently in solving loop. */
   bool d_in_solving_mode;
+  /** Indicates whether a partial assignment is checked in check_in_search(). */
+  bool d_in_partial_check = false;
   /**
    * Indicates whether solver engine requires additional checks for model
    * construction.
@@ -180,6 +206,7 @@ class SolverEngine
     uint64_t& num_lemmas_fun;
     uint64_t& num_lemmas_quant;
     uint64_t& num_lemmas_abstr;
+    uint64_t& num_lemmas_search;
     util::TimerStatistic& time_register_term;
     util::TimerStatistic& time_solve;
     util::TimerStatistic& time_relevant;
@@ -62,4 +62,16 @@ SolverState::process_term(const Node& term)
   d_solver_engine.process_term(term, true);
 }
 
+std::vector<Node>
+SolverState::check_in_search(bool partial)
+{
+  return d_solver_engine.check_in_search(partial);
+}
+
+void
+SolverState::lemma_added_in_search(const Node& lemma)
+{
+  d_solver_engine.lemma_added_in_search(lemma);
+}
+
 }  // namespace bzla
@@ -49,6 +49,23 @@ class SolverState
   /** Process term to register. */
   void process_term(const Node& term);
 
+  /**
+   * Check theories against the current bit-vector assignment during SAT
+   * search.
+   * @param partial True if the assignment is partial.
+   * @return The generated lemmas.
+   */
+  std::vector<Node> check_in_search(bool partial);
+
+  /**
+   * Notify the solver engine that a lemma generated by check_in_search() was
+   * added to the SAT solver as clauses. Such lemmas are satisfied by any
+   * model the SAT solver determines and do not require another round of
+   * solving.
+   * @param lemma The lemma.
+   */
+  void lemma_added_in_search(const Node& lemma);
+
  private:
   /** Associated solver engine. */
   SolverEngine& d_solver_engine;
@@ -11,10 +11,12 @@
 #include "solving_context.h"
 
 #include <cassert>
+#include <stdexcept>
 
 #include "check/check_model.h"
 #include "check/check_unsat_core.h"
 #include "node/node.h"
+#include "portfolio.h"
 #include "resource_terminator.h"
 #include "solver/fp/symfpu_nm.h"  // Temporary for setting SymFpuNM
 #include "util/exceptions.h"
@@ -41,6 +43,11 @@ SolvingContext::SolvingContext(NodeManager& nm,
       d_stats(d_env.statistics())
 {
   d_have_quantifiers = false;
+  if (!d_subsolver && d_env.options().nthreads() > 1
+      && d_env.options().cube_depth() == 0)
+  {
+    d_portfolio.reset(new Portfolio(d_env));
+  }
 }
 
 SolvingContext::~SolvingContext() {}
@@ -54,6 +61,17 @@ SolvingContext::solve()
 #ifndef NDEBUG
   check_no_free_variables();
 #endif
+
+  // In portfolio mode, preprocessing, solving and model/unsat core checking
+  // is done by the portfolio workers.
+  if (d_portfolio)
+  {
+    d_sat_state = d_portfolio->solve(std::vector<Node>(
+        d_original_assertions.begin(), d_original_assertions.end()));
+    d_stats.max_memory = util::maximum_memory_usage();
+    return d_sat_state;
+  }
+
   d_sat_state = preprocess();
 
   if (d_sat_state == Result::UNKNOWN)
@@ -67,6 +85,11 @@ SolvingContext::solve()
       Warn(!d_subsolver) << e.msg();
       d_sat_state = Result::UNKNOWN;
     }
+    catch (const std::length_error& e)
+    {
+      // Thrown by the AIG manager if the bit-blasted formula is too large.
+      throw Error(e.what());
+    }
   }
 
   if (d_sat_state == Result::SAT && d_have_quantifiers.get()
@@ -136,6 +159,10 @@ SolvingContext::get_value(const Node& term)
 {
   assert(d_sat_state == Result::SAT);
   fp::SymFpuNM snm(d_env.nm());
+  if (d_portfolio)
+  {
+    return d_portfolio->get_value(term);
+  }
   try
   {
     return d_solver_engine.value(d_preprocessor.process(term));
@@ -155,6 +182,11 @@ std::vector<Node>
 SolvingContext::get_unsat_core()
 {
   fp::SymFpuNM snm(d_env.nm());
+  if (d_portfolio)
+  {
+    return d_portfolio->get_unsat_core();
+  }
+
   std::vector<Node> res, core;
   if (d_assertions.is_inconsistent())
   {
@@ -24,6 +24,7 @@
 
 namespace bzla {
 
+class Portfolio;
 class ResourceTerminator;
 
 class SolvingContext
@@ -127,6 +128,9 @@ class SolvingContext
   /** Indicates whether solving context is used as subsolver (e.g. MBQI). */
   bool d_subsolver;
 
+  /** Parallel portfolio solver, only enabled if nthreads > 1. */
+  std::unique_ptr<Portfolio> d_portfolio;
+
   struct Statistics
   {
     Statistics(util::Statistics& stats);
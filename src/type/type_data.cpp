@@ -161,15 +161,21 @@ TypeData::get_fp_sig_size() const
 void
 TypeData::inc_ref()
 {
-  ++d_refs;
+  if (d_mgr->thread_safe())
+  {
+    d_refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    d_refs.store(d_refs.load(std::memory_order_relaxed) + 1,
+                 std::memory_order_relaxed);
+  }
 }
 
 void
 TypeData::dec_ref()
 {
-  assert(d_refs > 0);
-  --d_refs;
-  if (d_refs == 0)
+  if (release())
   {
     d_mgr->garbage_collect(this);
   }
@@ -181,4 +187,34 @@ TypeData::tm()
   return d_mgr;
 }
 
+/* --- TypeData private ---------------------------------------------------- */
+
+bool
+TypeData::release()
+{
+  assert(d_refs.load(std::memory_order_relaxed) > 0);
+  if (d_mgr->thread_safe())
+  {
+    return d_refs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+  uint32_t refs = d_refs.load(std::memory_order_relaxed) - 1;
+  d_refs.store(refs, std::memory_order_relaxed);
+  return refs == 0;
+}
+
+bool
+TypeData::try_inc_ref()
+{
+  assert(d_mgr->thread_safe());
+  uint32_t refs = d_refs.load(std::memory_order_relaxed);
+  while (refs > 0)
+  {
+    if (d_refs.compare_exchange_weak(refs, refs + 1))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 }  // namespace bzla::type
@@ -12,6 +12,7 @@
 #define BZLA_TYPE_TYPE_DATA_H_INCLUDED
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
@@ -100,6 +101,20 @@ class TypeData
   TypeManager* tm();
 
  private:
+  /**
+   * Decrease the reference count by one without garbage collecting this type.
+   * @return True if the reference count became zero.
+   */
+  bool release();
+
+  /**
+   * Increase the reference count by one if it is not zero, i.e., if this type
+   * is not being garbage collected by another thread. Only used if the type
+   * manager is thread-safe.
+   * @return True if the reference count was increased.
+   */
+  bool try_inc_ref();
+
   /** Constructor. */
   TypeData(TypeManager* mgr, Kind kind, const std::vector<Type>& types = {});
   /** Constructor for creating bit-vector type data. */
@@ -116,8 +131,11 @@ class TypeData
   uint64_t d_id = 0;
   /** Type kind. */
   Kind d_kind;
-  /** Reference count. */
-  uint32_t d_refs = 0;
+  /**
+   * Reference count, only modified atomically if the type manager is
+   * thread-safe.
+   */
+  std::atomic<uint32_t> d_refs = 0;
 
   /**
    * Variant that either stores the
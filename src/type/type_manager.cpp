@@ -19,6 +19,8 @@ namespace bzla::type {
 
 /* --- TypeManager public -------------------------------------------------- */
 
+TypeManager::TypeManager(bool thread_safe) : d_thread_safe(thread_safe) {}
+
 TypeManager::~TypeManager()
 {
   // Cleanup remaining types without triggering garbage_collect().
@@ -47,25 +49,25 @@ TypeManager::~TypeManager()
 Type
 TypeManager::mk_bool_type()
 {
-  return Type(find_or_create_type(TypeData::Kind::BOOL));
+  return find_or_create_type(TypeData::Kind::BOOL);
 }
 
 Type
 TypeManager::mk_bv_type(uint64_t size)
 {
-  return Type(find_or_create_bv_type(size));
+  return find_or_create_bv_type(size);
 }
 
 Type
 TypeManager::mk_fp_type(uint64_t exp_size, uint64_t sig_size)
 {
-  return Type(find_or_create_fp_type(exp_size, sig_size));
+  return find_or_create_fp_type(exp_size, sig_size);
 }
 
 Type
 TypeManager::mk_rm_type()
 {
-  return Type(find_or_create_type(TypeData::Kind::RM));
+  return find_or_create_type(TypeData::Kind::RM);
 }
 
 Type
@@ -73,7 +75,7 @@ TypeManager::mk_array_type(const Type& index, const Type& elem)
 {
   assert(index.tm() == this);
   assert(elem.tm() == this);
-  return Type(find_or_create_type(TypeData::Kind::ARRAY, {index, elem}));
+  return find_or_create_type(TypeData::Kind::ARRAY, {index, elem});
 }
 
 Type
@@ -81,19 +83,30 @@ TypeManager::mk_fun_type(const std::vector<Type>& types)
 {
   assert(std::all_of(
       types.begin(), types.end(), [this](auto& c) { return c.tm() == this; }));
-  return Type(find_or_create_type(TypeData::Kind::FUN, types));
+  return find_or_create_type(TypeData::Kind::FUN, types);
 }
 
 Type
 TypeManager::mk_uninterpreted_type(const std::optional<std::string>& symbol)
 {
   TypeData* data = new TypeData(this, symbol);
+  auto lock      = this->lock();
   init_id(data);
   return data;
 }
 
 /* --- TypeManager private ------------------------------------------------- */
 
+std::unique_lock<std::mutex>
+TypeManager::lock()
+{
+  if (d_thread_safe)
+  {
+    return std::unique_lock<std::mutex>(d_mutex);
+  }
+  return std::unique_lock<std::mutex>();
+}
+
 void
 TypeManager::init_id(TypeData* data)
 {
@@ -105,23 +118,44 @@ TypeManager::init_id(TypeData* data)
   data->d_id = d_type_id_counter++;
 }
 
-TypeData*
+Type
 TypeManager::find_or_create(TypeData* data)
 {
+  // Note: Declared before the lock, the type data is deleted after releasing
+  //       the lock if the type already exists.
+  std::unique_ptr<TypeData> existing;
+  auto lock           = this->lock();
   auto [it, inserted] = d_unique_types.insert(data);
 
   if (!inserted)  // Type already exists
   {
-    delete data;
-    return *it;
+    TypeData* d = *it;
+    if (!d_thread_safe)
+    {
+      existing.reset(data);
+      return d;
+    }
+    if (d->try_inc_ref())
+    {
+      existing.reset(data);
+      // Adopt reference acquired by try_inc_ref().
+      Type res;
+      res.d_data = d;
+      return res;
+    }
+    // Type is being garbage collected by another thread, replace it.
+    d_unique_types.erase(it);
+    d_unique_types.insert(data);
   }
 
-  // Type is new, initialize
+  // Type is new, initialize. In thread-safe mode, the type must be created
+  // while holding the lock to make sure that new type data is referenced
+  // before it can be found by other threads.
   init_id(data);
   return data;
 }
 
-TypeData*
+Type
 TypeManager::find_or_create_type(TypeData::Kind kind,
                                  const std::vector<Type>& types)
 {
@@ -129,14 +163,14 @@ TypeManager::find_or_create_type(TypeData::Kind kind,
   return find_or_create(data);
 }
 
-TypeData*
+Type
 TypeManager::find_or_create_bv_type(uint64_t size)
 {
   TypeData* data = new TypeData(this, size);
   return find_or_create(data);
 }
 
-TypeData*
+Type
 TypeManager::find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size)
 {
   TypeData* data = new TypeData(this, exp_size, sig_size);
@@ -146,6 +180,7 @@ TypeManager::find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size)
 void
 TypeManager::garbage_collect(TypeData* data)
 {
+  auto lock = this->lock();
   assert(data->d_refs == 0);
   assert(!d_in_gc_mode);
 
@@ -159,8 +194,13 @@ TypeManager::garbage_collect(TypeData* data)
     cur = visit.back();
     visit.pop_back();
 
-    // Erase type data before we modify children.
-    d_unique_types.erase(cur);
+    // Erase type data before we modify children. In thread-safe mode, the
+    // type data may already have been replaced by a new type.
+    auto it = d_unique_types.find(cur);
+    if (it != d_unique_types.end() && *it == cur)
+    {
+      d_unique_types.erase(it);
+    }
 
     auto kind = cur->get_kind();
     if (kind == TypeData::Kind::ARRAY || kind == TypeData::Kind::FUN)
@@ -174,9 +214,8 @@ TypeManager::garbage_collect(TypeData* data)
         // Manually decrement reference count to not trigger decrement of
         // TypeData reference. This will avoid recursive call to
         // garbage_collect().
-        --d->d_refs;
         t.d_data = nullptr;
-        if (d->d_refs == 0)
+        if (d->release())
         {
           visit.push_back(d);
         }
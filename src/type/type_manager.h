@@ -12,6 +12,7 @@
 #define BZLA_TYPE_TYPE_MANAGER_H_INCLUDED
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_set>
 #include <vector>
@@ -24,13 +25,29 @@ class Type;
 
 namespace type {
 
+/**
+ * Type manager, creates and owns all types.
+ *
+ * In thread-safe mode, type creation and garbage collection are guarded by a
+ * mutex, and reference counts of types are modified atomically. Lookups skip
+ * types whose reference count dropped to zero, which are about to be garbage
+ * collected by another thread, and replace them with new type data.
+ */
 class TypeManager
 {
   friend TypeData;
 
  public:
+  /**
+   * Constructor.
+   * @param thread_safe True to support concurrent type creation.
+   */
+  TypeManager(bool thread_safe = false);
   ~TypeManager();
 
+  /** @return True if this type manager is thread-safe. */
+  bool thread_safe() const { return d_thread_safe; }
+
   /**
    * @return Boolean type.
    */
@@ -85,21 +102,32 @@ class TypeManager
       const std::optional<std::string>& symbol = std::nullopt);
 
  private:
+  /**
+   * Lock d_mutex in thread-safe mode.
+   * @return The lock, which does not own the mutex if not in thread-safe mode.
+   */
+  std::unique_lock<std::mutex> lock();
+
   /** Initialize type data. */
   void init_id(TypeData* d);
 
-  /** Helper function to check whether type data already exists. */
-  TypeData* find_or_create(TypeData* d);
+  /**
+   * Helper function to check whether type data already exists.
+   * @param d The type data to insert if it does not exist yet, deleted
+   *          otherwise.
+   * @return The type.
+   */
+  Type find_or_create(TypeData* d);
 
   /** Find or create new boolean, rounding mode, array, or function type. */
-  TypeData* find_or_create_type(TypeData::Kind kind,
-                                const std::vector<Type>& types = {});
+  Type find_or_create_type(TypeData::Kind kind,
+                           const std::vector<Type>& types = {});
 
   /** Find or create new bit-vector type. */
-  TypeData* find_or_create_bv_type(uint64_t size);
+  Type find_or_create_bv_type(uint64_t size);
 
   /** Find or create new floating-point type. */
-  TypeData* find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size);
+  Type find_or_create_fp_type(uint64_t exp_size, uint64_t sig_size);
 
   /**
    * Garbage collect type data.
@@ -111,6 +139,12 @@ class TypeManager
    */
   void garbage_collect(TypeData* d);
 
+  /** True if this type manager is thread-safe. */
+  const bool d_thread_safe;
+
+  /** Guards all members below in thread-safe mode. */
+  std::mutex d_mutex;
+
   /** Type id counter. */
   uint64_t d_type_id_counter = 1;
 
@@ -0,0 +1,92 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "util/mapped_file.h"
+
+#if !defined(__WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bzla::util {
+
+MappedFile::~MappedFile() { close(); }
+
+#if defined(__WIN32)
+
+bool
+MappedFile::open(const std::string& filename)
+{
+  (void) filename;
+  return false;
+}
+
+void
+MappedFile::close()
+{
+}
+
+#else
+
+bool
+MappedFile::open(const std::string& filename)
+{
+  close();
+
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) || !S_ISREG(st.st_mode))
+  {
+    ::close(fd);
+    return false;
+  }
+
+  d_size = static_cast<size_t>(st.st_size);
+  if (d_size > 0)
+  {
+    void* data = mmap(nullptr, d_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      ::close(fd);
+      d_size = 0;
+      return false;
+    }
+    // Input files are lexed front to back exactly once.
+    madvise(data, d_size, MADV_SEQUENTIAL);
+    d_data = static_cast<const char*>(data);
+  }
+  // The mapping stays valid after closing the file descriptor.
+  ::close(fd);
+  d_is_open = true;
+  return true;
+}
+
+void
+MappedFile::close()
+{
+  if (d_data)
+  {
+    munmap(const_cast<char*>(d_data), d_size);
+  }
+  d_is_open = false;
+  d_data    = nullptr;
+  d_size    = 0;
+}
+
+#endif
+
+}  // namespace bzla::util
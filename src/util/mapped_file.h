@@ -0,0 +1,63 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_MAPPED_FILE_H_INCLUDED
+#define BZLA_UTIL_MAPPED_FILE_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+
+namespace bzla::util {
+
+/**
+ * Read-only memory mapping of a regular file.
+ *
+ * Allows the lexers to read input files directly from the page cache instead
+ * of copying them chunk-wise into a read buffer. Mapping is only supported on
+ * POSIX platforms, open() fails on all other platforms and for inputs that
+ * are not regular files (e.g., pipes), in which case callers are expected to
+ * fall back to stream-based input.
+ */
+class MappedFile
+{
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /**
+   * Map given file into memory.
+   * @param filename The name of the file.
+   * @return False if the file could not be mapped.
+   */
+  bool open(const std::string& filename);
+  /** Unmap the currently mapped file. */
+  void close();
+
+  /** @return True if a file is currently mapped. */
+  bool is_open() const { return d_is_open; }
+  /** @return The mapped file contents, nullptr for empty files. */
+  const char* data() const { return d_data; }
+  /** @return The size of the mapped file in bytes. */
+  size_t size() const { return d_size; }
+
+ private:
+  /** True if a file is currently mapped. */
+  bool d_is_open = false;
+  /** The mapped file contents. */
+  const char* d_data = nullptr;
+  /** The size of the mapped file in bytes. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::util
+
+#endif
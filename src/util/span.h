@@ -0,0 +1,80 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#ifndef BZLA_UTIL_SPAN_H_INCLUDED
+#define BZLA_UTIL_SPAN_H_INCLUDED
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace bzla::util {
+
+/**
+ * Non-owning read-only view of a contiguous sequence of elements, the subset
+ * of C++20's std::span<const T> that we need.
+ *
+ * Spans are implicitly constructible from vectors, arrays and initializer
+ * lists, and are meant to be passed by value as function arguments. A span
+ * must not outlive the sequence it refers to.
+ */
+template <class T>
+class Span
+{
+ public:
+  using value_type = T;
+  using iterator   = const T*;
+
+  Span() = default;
+  Span(const T* data, size_t size) : d_data(data), d_size(size) {}
+  Span(const std::vector<T>& vector)
+      : d_data(vector.data()), d_size(vector.size())
+  {
+  }
+  Span(const std::initializer_list<T>& list)
+      : d_data(std::data(list)), d_size(list.size())
+  {
+  }
+  template <size_t N>
+  Span(const std::array<T, N>& array) : d_data(array.data()), d_size(N)
+  {
+  }
+
+  /** @return A pointer to the first element. */
+  const T* data() const { return d_data; }
+  /** @return The number of elements. */
+  size_t size() const { return d_size; }
+  /** @return True if the span has no elements. */
+  bool empty() const { return d_size == 0; }
+
+  const T& operator[](size_t i) const
+  {
+    assert(i < d_size);
+    return d_data[i];
+  }
+  const T& front() const { return (*this)[0]; }
+  const T& back() const { return (*this)[d_size - 1]; }
+
+  iterator begin() const { return d_data; }
+  iterator end() const { return d_data + d_size; }
+
+ private:
+  /** The first element. */
+  const T* d_data = nullptr;
+  /** The number of elements. */
+  size_t d_size = 0;
+};
+
+}  // namespace bzla::util
+
+#endif
@@ -307,6 +307,145 @@ TEST_F(TestAigCnf, enc_or)
                         {or_id, a.get_id(), b.get_id()}}));
 }
 
+TEST_F(TestAigCnf, enc_and_nary)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver);
+
+  bitblast::AigNode a        = aigmgr.mk_bit();
+  bitblast::AigNode b        = aigmgr.mk_bit();
+  bitblast::AigNode c        = aigmgr.mk_bit();
+  bitblast::AigNode d        = aigmgr.mk_bit();
+  bitblast::AigNode and_aig1 = aigmgr.mk_and(a, b);
+  bitblast::AigNode and_aig2 = aigmgr.mk_and(c, d);
+  bitblast::AigNode and_aig3 = aigmgr.mk_and(and_aig1, and_aig2);
+  auto x                     = and_aig3.get_id();
+  enc.encode(and_aig3);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-x, a.get_id()},
+                        {-x, b.get_id()},
+                        {-x, c.get_id()},
+                        {-x, d.get_id()},
+                        {x,
+                         -a.get_id(),
+                         -b.get_id(),
+                         -c.get_id(),
+                         -d.get_id()}}));
+  ASSERT_FALSE(enc.is_encoded(and_aig1.get_id()));
+  ASSERT_FALSE(enc.is_encoded(and_aig2.get_id()));
+}
+
+TEST_F(TestAigCnf, enc_xor)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver);
+
+  // a <-> b is encoded as ~a xor b
+  bitblast::AigNode a       = aigmgr.mk_bit();
+  bitblast::AigNode b       = aigmgr.mk_bit();
+  bitblast::AigNode iff_aig = aigmgr.mk_iff(a, b);
+  auto x                    = iff_aig.get_id();
+  enc.encode(iff_aig);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-a.get_id(), b.get_id(), -x},
+                        {a.get_id(), b.get_id(), x},
+                        {-a.get_id(), -b.get_id(), x},
+                        {a.get_id(), -b.get_id(), -x}}));
+}
+
+TEST_F(TestAigCnf, enc_or_top_polarity)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver);
+
+  // (a /\ b) \/ c = ~(~(a /\ b) /\ ~c), only the clauses for
+  // ~(a /\ b) /\ ~c -> false and a /\ b -> a, b are required.
+  bitblast::AigNode a       = aigmgr.mk_bit();
+  bitblast::AigNode b       = aigmgr.mk_bit();
+  bitblast::AigNode c       = aigmgr.mk_bit();
+  bitblast::AigNode and_aig = aigmgr.mk_and(a, b);
+  bitblast::AigNode or_aig  = aigmgr.mk_or(and_aig, c);
+  auto x                    = and_aig.get_id();
+  auto y                    = -or_aig.get_id();
+  enc.encode(or_aig, true);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{y, c.get_id(), x},
+                        {-x, a.get_id()},
+                        {-x, b.get_id()},
+                        {-y}}));
+  ASSERT_TRUE(enc.is_encoded(x));
+  ASSERT_FALSE(enc.is_encoded(-x));
+  ASSERT_TRUE(enc.is_encoded(or_aig.get_id()));
+  ASSERT_FALSE(enc.is_encoded(-or_aig.get_id()));
+}
+
+TEST_F(TestAigCnf, enc_assumption)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver);
+
+  bitblast::AigNode a       = aigmgr.mk_bit();
+  bitblast::AigNode b       = aigmgr.mk_bit();
+  bitblast::AigNode and_aig = aigmgr.mk_and(a, b);
+  auto x                    = and_aig.get_id();
+  enc.encode_assumption(and_aig);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-x, a.get_id()}, {-x, b.get_id()}}));
+  ASSERT_TRUE(enc.is_encoded(x));
+  ASSERT_FALSE(enc.is_encoded(-x));
+
+  // Add missing polarity.
+  enc.encode(and_aig);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-x, a.get_id()},
+                        {-x, b.get_id()},
+                        {x, -a.get_id(), -b.get_id()}}));
+  ASSERT_TRUE(enc.is_encoded(-x));
+  ASSERT_EQ(enc.statistics().num_vars, 3);
+}
+
+TEST_F(TestAigCnf, enc_scopes)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  DummySatSolver solver;
+  bitblast::AigCnfEncoder enc(solver);
+
+  bitblast::AigNode a       = aigmgr.mk_bit();
+  bitblast::AigNode b       = aigmgr.mk_bit();
+  bitblast::AigNode act     = aigmgr.mk_bit();
+  bitblast::AigNode and_aig = aigmgr.mk_and(a, b);
+  auto x                    = and_aig.get_id();
+  auto s                    = act.get_id();
+  enc.encode(a);
+
+  enc.push(s);
+  ASSERT_EQ(enc.activations(), std::vector<int64_t>{s});
+  enc.encode_assumption(and_aig);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-x, a.get_id(), -s}, {-x, b.get_id(), -s}}));
+  ASSERT_TRUE(enc.is_encoded(x));
+  ASSERT_TRUE(enc.is_encoded(b.get_id()));
+
+  enc.pop();
+  ASSERT_TRUE(enc.activations().empty());
+  ASSERT_FALSE(enc.is_encoded(x));
+  ASSERT_FALSE(enc.is_encoded(b.get_id()));
+  ASSERT_TRUE(enc.is_encoded(a.get_id()));
+
+  // Encodings of popped scopes are added again.
+  enc.encode_assumption(and_aig);
+  ASSERT_EQ(solver.get_clauses(),
+            ClauseList({{-x, a.get_id(), -s},
+                        {-x, b.get_id(), -s},
+                        {-s},
+                        {-x, a.get_id()},
+                        {-x, b.get_id()}}));
+}
+
 #if 0
 TEST_F(TestAigCnf, enc_or_top)
 {
@@ -483,4 +483,44 @@ TEST_F(TestAigMgr, idempotence4_3)
   }
 }
 
+TEST_F(TestAigMgr, children)
+{
+  bitblast::AigManager mgr;
+
+  auto a       = mgr.mk_const();
+  auto b       = mgr.mk_const();
+  auto and_aig = mgr.mk_and(a, mgr.mk_not(b));
+
+  ASSERT_EQ(and_aig[0], a);
+  ASSERT_EQ(and_aig[1], mgr.mk_not(b));
+  ASSERT_TRUE(and_aig[1].is_negated());
+  ASSERT_EQ(a.parents(), 1);
+  ASSERT_EQ(b.parents(), 1);
+  ASSERT_EQ(mgr.mk_not(and_aig)[0], a);
+}
+
+TEST_F(TestAigMgr, garbage_collect)
+{
+  bitblast::AigManager mgr;
+
+  auto a = mgr.mk_const();
+  auto b = mgr.mk_const();
+  {
+    auto c       = mgr.mk_const();
+    auto and_aig = mgr.mk_and(mgr.mk_and(a, b), c);
+    ASSERT_EQ(mgr.statistics().num_ands, 2);
+    ASSERT_EQ(mgr.statistics().num_consts, 3);
+    ASSERT_EQ(a.get_refs(), 2);
+  }
+  ASSERT_EQ(mgr.statistics().num_ands, 0);
+  ASSERT_EQ(mgr.statistics().num_consts, 2);
+  ASSERT_EQ(a.get_refs(), 1);
+  ASSERT_EQ(a.parents(), 0);
+
+  // Ids of deleted nodes are not reused.
+  auto and_aig = mgr.mk_and(a, b);
+  ASSERT_EQ(and_aig[0], a);
+  ASSERT_GT(and_aig.get_id(), b.get_id() + 3);
+}
+
 }  // namespace bzla::test
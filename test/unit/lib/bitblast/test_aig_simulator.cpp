@@ -0,0 +1,88 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bitblast/aig/aig_simulator.h"
+#include "bitblast/aig_bitblaster.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+class TestAigSimulator : public TestCommon
+{
+};
+
+TEST_F(TestAigSimulator, gates)
+{
+  bitblast::BitInterface<bitblast::AigNode> aigmgr;
+  bitblast::AigSimulator sim;
+
+  auto a = aigmgr.mk_bit();
+  auto b = aigmgr.mk_bit();
+  auto c = aigmgr.mk_bit();
+
+  // All combinations of a, b and c in the lowest 8 patterns.
+  sim.set(a, 0xaa);
+  sim.set(b, 0xcc);
+  sim.set(aigmgr.mk_not(c), ~UINT64_C(0xf0));
+
+  ASSERT_EQ(sim.simulate(aigmgr.mk_true()), ~UINT64_C(0));
+  ASSERT_EQ(sim.simulate(aigmgr.mk_false()), 0);
+  ASSERT_EQ(sim.simulate(c), 0xf0);
+  ASSERT_EQ(sim.simulate(aigmgr.mk_not(a)), ~UINT64_C(0xaa));
+  ASSERT_EQ(sim.simulate(aigmgr.mk_and(a, b)), 0x88);
+  ASSERT_EQ(sim.simulate(aigmgr.mk_or(a, b)), 0xee);
+  ASSERT_EQ(sim.simulate(aigmgr.mk_iff(a, b)) & 0xff, 0x99);
+  ASSERT_EQ(sim.simulate(aigmgr.mk_ite(c, a, b)), 0xac);
+
+  ASSERT_TRUE(sim.value(aigmgr.mk_ite(c, a, b), 2));
+  ASSERT_FALSE(sim.value(aigmgr.mk_ite(c, a, b), 4));
+
+  // Changing an input invalidates simulated words.
+  sim.set(a, 0x0f);
+  ASSERT_EQ(sim.simulate(aigmgr.mk_and(a, b)), 0x0c);
+  sim.reset();
+  ASSERT_EQ(sim.simulate(aigmgr.mk_or(a, b)), 0);
+}
+
+TEST_F(TestAigSimulator, add)
+{
+  bitblast::AigBitblaster bb;
+  bitblast::AigSimulator sim;
+  RNG rng(1234);
+
+  uint64_t size = 16;
+  auto a        = bb.bv_constant(size);
+  auto b        = bb.bv_constant(size);
+  auto res      = bb.bv_add(a, b);
+
+  // Bits are stored with the most significant bit first.
+  std::vector<uint64_t> values_a, values_b;
+  for (size_t i = 0; i < size; ++i)
+  {
+    values_a.push_back(rng.pick<uint64_t>());
+    values_b.push_back(rng.pick<uint64_t>());
+    sim.set(a[size - 1 - i], values_a.back());
+    sim.set(b[size - 1 - i], values_b.back());
+  }
+
+  for (size_t p = 0; p < bitblast::AigSimulator::NUM_PATTERNS; ++p)
+  {
+    BitVector bv_a(size), bv_b(size), bv_res(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      bv_a.set_bit(i, (values_a[i] >> p) & 1);
+      bv_b.set_bit(i, (values_b[i] >> p) & 1);
+      bv_res.set_bit(i, sim.value(res[size - 1 - i], p));
+    }
+    ASSERT_EQ(bv_res, bv_a.bvadd(bv_b));
+  }
+}
+
+}  // namespace bzla::test
@@ -6548,6 +6548,135 @@ TEST_F(TestBitVector, udivurem)
   test_udivurem(127);
 }
 
+TEST_F(TestBitVector, limbs)
+{
+  // Values of size s_native_size < size <= s_max_limbs_size are stored as
+  // inline limbs, check against GMP including conversions from and to GMP
+  // values.
+  for (uint64_t size : {65, 100, 128, 192, 255, 256})
+  {
+    mpz_class mod = mpz_class(1) << size;
+    auto mk_bv    = [size, &mod](const mpz_class& val) {
+      mpz_class v = val % mod;
+      if (v < 0) v += mod;
+      return BitVector(size, v.get_str(2), 2);
+    };
+    for (uint32_t i = 0; i < N_TESTS; ++i)
+    {
+      BitVector bv1(size, *d_rng);
+      BitVector bv2(size, *d_rng);
+      if (i % 4 == 0)
+      {
+        // small divisor
+        bv2 = BitVector::from_ui(size, d_rng->pick<uint64_t>());
+      }
+      mpz_class a(bv1.str(), 2);
+      mpz_class b(bv2.str(), 2);
+      uint64_t n = d_rng->pick<uint64_t>(0, size);
+
+      ASSERT_EQ(bv1.bvadd(bv2), mk_bv(a + b));
+      ASSERT_EQ(bv1.bvsub(bv2), mk_bv(a - b));
+      ASSERT_EQ(bv1.bvmul(bv2), mk_bv(a * b));
+      ASSERT_EQ(bv1.bvneg(), mk_bv(-a));
+      ASSERT_EQ(bv1.bvnot(), mk_bv(mod - 1 - a));
+      ASSERT_EQ(bv1.bvinc(), mk_bv(a + 1));
+      ASSERT_EQ(bv1.bvdec(), mk_bv(a - 1));
+      ASSERT_EQ(bv1.bvand(bv2), mk_bv(a & b));
+      ASSERT_EQ(bv1.bvor(bv2), mk_bv(a | b));
+      ASSERT_EQ(bv1.bvxor(bv2), mk_bv(a ^ b));
+      ASSERT_EQ(bv1.bvult(bv2).is_true(), a < b);
+      ASSERT_EQ(bv1.compare(bv2) == 0, a == b);
+      if (b != 0)
+      {
+        ASSERT_EQ(bv1.bvudiv(bv2), mk_bv(a / b));
+        ASSERT_EQ(bv1.bvurem(bv2), mk_bv(a % b));
+      }
+      ASSERT_EQ(bv1.bvshl(n), mk_bv(n < size ? a << n : mpz_class(0)));
+      ASSERT_EQ(bv1.bvshr(n), mk_bv(n < size ? a >> n : mpz_class(0)));
+      ASSERT_EQ(bv1.bvroli(n).bvrori(n), bv1);
+      ASSERT_EQ(bv1.count_leading_zeros(),
+                a == 0 ? size : size - mpz_sizeinbase(a.get_mpz_t(), 2));
+      ASSERT_EQ(bv1.bvconcat(bv2).bvextract(2 * size - 1, size), bv1);
+      ASSERT_EQ(bv1.bvconcat(bv2).bvextract(size - 1, 0), bv2);
+      ASSERT_EQ(bv1.bvzext(n).bvextract(size - 1, 0), bv1);
+      ASSERT_EQ(bv1.bvsext(n).bvextract(size - 1, 0), bv1);
+      ASSERT_EQ(bv1.bvsext(n).count_leading_ones(),
+                bv1.msb() ? n + bv1.count_leading_ones() : 0);
+      ASSERT_EQ(bv1.bvrepeat(2), bv1.bvconcat(bv1));
+      ASSERT_EQ(bv1.hash(), mk_bv(a).hash());
+      if (bv1.lsb())
+      {
+        ASSERT_TRUE(bv1.bvmul(bv1.bvmodinv()).is_one());
+      }
+    }
+  }
+}
+
+TEST_F(TestBitVector, wide)
+{
+  // Bitwise operations and shifts on values of size > s_max_limbs_size are
+  // performed on the GMP limbs via the word kernels, check against GMP.
+  for (uint64_t size : {257, 300, 512, 1000, 4096})
+  {
+    mpz_class mod = mpz_class(1) << size;
+    auto mk_bv    = [size, &mod](const mpz_class& val) {
+      mpz_class v = val % mod;
+      if (v < 0) v += mod;
+      return BitVector(size, v.get_str(2), 2);
+    };
+    for (uint32_t i = 0; i < N_TESTS / 10; ++i)
+    {
+      BitVector bv1(size, *d_rng);
+      BitVector bv2(size, *d_rng);
+      if (i % 4 == 0)
+      {
+        // operands with different number of limbs
+        bv2 = BitVector::from_ui(size, d_rng->pick<uint64_t>());
+      }
+      else if (i % 4 == 1)
+      {
+        bv1 = BitVector::mk_ones(size).bvshl(d_rng->pick<uint64_t>(0, 64));
+      }
+      mpz_class a(bv1.str(), 2);
+      mpz_class b(bv2.str(), 2);
+      mpz_class ones = mod - 1;
+      uint64_t n     = d_rng->pick<uint64_t>(0, size);
+
+      ASSERT_EQ(bv1.bvnot(), mk_bv(ones ^ a));
+      ASSERT_EQ(bv1.bvand(bv2), mk_bv(a & b));
+      ASSERT_EQ(bv1.bvor(bv2), mk_bv(a | b));
+      ASSERT_EQ(bv1.bvxor(bv2), mk_bv(a ^ b));
+      ASSERT_EQ(bv1.bvnand(bv2), mk_bv(ones ^ (a & b)));
+      ASSERT_EQ(bv1.bvnor(bv2), mk_bv(ones ^ (a | b)));
+      ASSERT_EQ(bv1.bvxnor(bv2), mk_bv(ones ^ a ^ b));
+      ASSERT_EQ(bv2.bvand(bv1), mk_bv(a & b));
+      ASSERT_EQ(bv2.bvxnor(bv1), mk_bv(ones ^ a ^ b));
+      ASSERT_EQ(bv1.bvshl(n), mk_bv(n < size ? a << n : mpz_class(0)));
+      ASSERT_EQ(bv1.bvshr(n), mk_bv(n < size ? a >> n : mpz_class(0)));
+      ASSERT_EQ(bv2.bvshr(n), mk_bv(n < size ? b >> n : mpz_class(0)));
+      mpz_class inv = ones ^ a;
+      ASSERT_EQ(bv1.count_leading_ones(),
+                inv == 0 ? size : size - mpz_sizeinbase(inv.get_mpz_t(), 2));
+      // in-place
+      BitVector res(bv1);
+      res.ibvxor(res, bv2);
+      ASSERT_EQ(res, mk_bv(a ^ b));
+      res = bv2;
+      res.ibvor(bv1, res);
+      ASSERT_EQ(res, mk_bv(a | b));
+      res = bv1;
+      res.ibvnot(res);
+      ASSERT_EQ(res, mk_bv(ones ^ a));
+      res = bv1;
+      res.ibvshl(res, n);
+      ASSERT_EQ(res, mk_bv(n < size ? a << n : mpz_class(0)));
+      res = bv1;
+      res.ibvshr(res, n);
+      ASSERT_EQ(res, mk_bv(n < size ? a >> n : mpz_class(0)));
+    }
+  }
+}
+
 /* -------------------------------------------------------------------------- */
 
 }  // namespace bzla::test
@@ -0,0 +1,231 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "bv/word_kernels.h"
+#include "test_lib.h"
+
+namespace bzla::test {
+
+/* -------------------------------------------------------------------------- */
+
+class TestWordKernels : public ::bzla::test::TestCommon
+{
+ protected:
+  static constexpr size_t N_TESTS = 200;
+  static constexpr size_t MAX_N   = 70;
+
+  void SetUp() override
+  {
+    TestCommon::SetUp();
+    d_rng.reset(new RNG(1234));
+    if (const WordKernels* k = word_kernels_sse2())
+    {
+      d_kernels.push_back(k);
+    }
+    if (const WordKernels* k = word_kernels_avx2())
+    {
+      d_kernels.push_back(k);
+    }
+    d_kernels.push_back(&word_kernels());
+  }
+
+  std::vector<uint64_t> random_words(size_t n);
+
+  void test_binary(WordKernels::BinaryFun WordKernels::*fun);
+  void test_shift(WordKernels::ShiftFun WordKernels::*fun);
+  void test_find(size_t (*WordKernels::*fun)(const uint64_t*,
+                                             size_t,
+                                             uint64_t));
+
+  std::unique_ptr<RNG> d_rng;
+  /** The kernels to test against the portable kernels. */
+  std::vector<const WordKernels*> d_kernels;
+};
+
+std::vector<uint64_t>
+TestWordKernels::random_words(size_t n)
+{
+  std::vector<uint64_t> res(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    // Generate runs of equal words for find_first_not/find_last_not.
+    uint32_t pick = d_rng->pick<uint32_t>(0, 3);
+    res[i]        = pick == 0   ? 0
+                    : pick == 1 ? ~uint64_t(0)
+                                : d_rng->pick<uint64_t>();
+  }
+  return res;
+}
+
+void
+TestWordKernels::test_binary(WordKernels::BinaryFun WordKernels::*fun)
+{
+  const WordKernels& portable = word_kernels_portable();
+  for (size_t i = 0; i < N_TESTS; ++i)
+  {
+    size_t n                = d_rng->pick<size_t>(0, MAX_N);
+    std::vector<uint64_t> a = random_words(n);
+    std::vector<uint64_t> b = random_words(n);
+    std::vector<uint64_t> expected(n);
+    (portable.*fun)(expected.data(), a.data(), b.data(), n);
+    for (const WordKernels* k : d_kernels)
+    {
+      std::vector<uint64_t> res(n);
+      (k->*fun)(res.data(), a.data(), b.data(), n);
+      ASSERT_EQ(res, expected) << k->name;
+      // r aliases a
+      res = a;
+      (k->*fun)(res.data(), res.data(), b.data(), n);
+      ASSERT_EQ(res, expected) << k->name;
+    }
+  }
+}
+
+void
+TestWordKernels::test_shift(WordKernels::ShiftFun WordKernels::*fun)
+{
+  const WordKernels& portable = word_kernels_portable();
+  for (size_t i = 0; i < N_TESTS; ++i)
+  {
+    size_t n                = d_rng->pick<size_t>(1, MAX_N);
+    std::vector<uint64_t> a = random_words(n);
+    uint64_t shift          = d_rng->pick<uint64_t>(0, 64 * n - 1);
+    if (i % 4 == 0)
+    {
+      // Shift by whole words.
+      shift -= shift % 64;
+    }
+    std::vector<uint64_t> expected(n);
+    (portable.*fun)(expected.data(), a.data(), n, shift);
+    for (const WordKernels* k : d_kernels)
+    {
+      std::vector<uint64_t> res(n);
+      (k->*fun)(res.data(), a.data(), n, shift);
+      ASSERT_EQ(res, expected) << k->name << " shift " << shift;
+      // r aliases a
+      res = a;
+      (k->*fun)(res.data(), res.data(), n, shift);
+      ASSERT_EQ(res, expected) << k->name << " shift " << shift;
+    }
+  }
+}
+
+void
+TestWordKernels::test_find(size_t (*WordKernels::*fun)(const uint64_t*,
+                                                       size_t,
+                                                       uint64_t))
+{
+  const WordKernels& portable = word_kernels_portable();
+  for (size_t i = 0; i < N_TESTS; ++i)
+  {
+    size_t n = d_rng->pick<size_t>(0, MAX_N);
+    for (uint64_t word : {uint64_t(0), ~uint64_t(0)})
+    {
+      std::vector<uint64_t> a(n, word);
+      if (n > 0 && d_rng->flip_coin())
+      {
+        a[d_rng->pick<size_t>(0, n - 1)] = d_rng->pick<uint64_t>();
+      }
+      size_t expected = (portable.*fun)(a.data(), n, word);
+      for (const WordKernels* k : d_kernels)
+      {
+        ASSERT_EQ((k->*fun)(a.data(), n, word), expected) << k->name;
+      }
+    }
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+
+TEST_F(TestWordKernels, portable)
+{
+  const WordKernels& k    = word_kernels_portable();
+  std::vector<uint64_t> a = {0x00000000ffffffff, 0x0123456789abcdef, 0};
+  std::vector<uint64_t> b = {0xffff0000ffff0000, 0xffffffffffffffff, 0};
+  std::vector<uint64_t> r(3);
+  k.bvand(r.data(), a.data(), b.data(), 3);
+  ASSERT_EQ(r,
+            std::vector<uint64_t>({0x00000000ffff0000, 0x0123456789abcdef, 0}));
+  k.bvxnor(r.data(), a.data(), b.data(), 3);
+  ASSERT_EQ(r,
+            std::vector<uint64_t>(
+                {0x0000ffffffff0000, 0x0123456789abcdef, ~uint64_t(0)}));
+  k.shl(r.data(), a.data(), 3, 68);
+  ASSERT_EQ(r,
+            std::vector<uint64_t>({0, 0x0000000ffffffff0, 0x123456789abcdef0}));
+  k.shr(r.data(), a.data(), 3, 4);
+  ASSERT_EQ(r,
+            std::vector<uint64_t>({0xf00000000fffffff, 0x00123456789abcde, 0}));
+  ASSERT_EQ(k.popcount(a.data(), 3), 32u + 32u);
+  ASSERT_EQ(k.find_first_not(a.data(), 3, 0), 0u);
+  ASSERT_EQ(k.find_last_not(a.data(), 3, 0), 1u);
+  ASSERT_EQ(k.find_first_not(b.data() + 1, 1, ~uint64_t(0)), 1u);
+}
+
+TEST_F(TestWordKernels, bitwise)
+{
+  test_binary(&WordKernels::bvand);
+  test_binary(&WordKernels::bvor);
+  test_binary(&WordKernels::bvxor);
+  test_binary(&WordKernels::bvnand);
+  test_binary(&WordKernels::bvnor);
+  test_binary(&WordKernels::bvxnor);
+}
+
+TEST_F(TestWordKernels, bvnot)
+{
+  const WordKernels& portable = word_kernels_portable();
+  for (size_t i = 0; i < N_TESTS; ++i)
+  {
+    size_t n                = d_rng->pick<size_t>(0, MAX_N);
+    std::vector<uint64_t> a = random_words(n);
+    std::vector<uint64_t> expected(n);
+    portable.bvnot(expected.data(), a.data(), n);
+    for (const WordKernels* k : d_kernels)
+    {
+      std::vector<uint64_t> res(n);
+      k->bvnot(res.data(), a.data(), n);
+      ASSERT_EQ(res, expected) << k->name;
+    }
+  }
+}
+
+TEST_F(TestWordKernels, shl) { test_shift(&WordKernels::shl); }
+
+TEST_F(TestWordKernels, shr) { test_shift(&WordKernels::shr); }
+
+TEST_F(TestWordKernels, popcount)
+{
+  const WordKernels& portable = word_kernels_portable();
+  for (size_t i = 0; i < N_TESTS; ++i)
+  {
+    size_t n                = d_rng->pick<size_t>(0, MAX_N);
+    std::vector<uint64_t> a = random_words(n);
+    uint64_t expected       = portable.popcount(a.data(), n);
+    for (const WordKernels* k : d_kernels)
+    {
+      ASSERT_EQ(k->popcount(a.data(), n), expected) << k->name;
+    }
+  }
+}
+
+TEST_F(TestWordKernels, find_first_not)
+{
+  test_find(&WordKernels::find_first_not);
+}
+
+TEST_F(TestWordKernels, find_last_not)
+{
+  test_find(&WordKernels::find_last_not);
+}
+
+/* -------------------------------------------------------------------------- */
+
+}  // namespace bzla::test
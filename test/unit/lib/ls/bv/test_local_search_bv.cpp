@@ -119,7 +119,7 @@ class TestLsBv : public TestBvNodeCommon
    * Note: LocalSearchBV::update_cone() is private and only the main test class
    * has access to it.
    */
-  void update_cone(uint64_t id, const BitVector& assignment);
+  uint64_t update_cone(uint64_t id, const BitVector& assignment);
 
   void test_move_binary(NodeKind kind, uint32_t pos_x);
   void test_move_ite(uint32_t pos_x);
@@ -173,10 +173,10 @@ TestLsBv::get_expected_parents()
   return parents;
 }
 
-void
+uint64_t
 TestLsBv::update_cone(uint64_t id, const BitVector& assignment)
 {
-  d_ls->update_cone(d_ls->get_node(id), assignment);
+  return d_ls->update_cone(d_ls->get_node(id), assignment);
 }
 
 void
@@ -746,7 +746,8 @@ TEST_F(TestLsBv, update_cone)
   }
 
   /* v1 -> 0001 */
-  update_cone(d_v1, d_one4);
+  // v1edv3e does not change, v1edv3e_ext is not re-evaluated
+  ASSERT_EQ(update_cone(d_v1, d_one4), 10);
   std::map<uint32_t, BitVector> ass_up_v1 = {
       {d_c1, d_ten4},            // 1010
       {d_v1, d_one4},            // 0001
@@ -798,7 +799,8 @@ TEST_F(TestLsBv, update_cone)
   }
 
   /* v3 -> 0001 */
-  update_cone(d_v3, d_one4);
+  // v1edv3e does not change, v1edv3e_ext is not re-evaluated
+  ASSERT_EQ(update_cone(d_v3, d_one4), 7);
   std::map<uint32_t, BitVector> ass_up_v3 = {
       {d_c1, d_ten4},            // 1010
       {d_v1, d_one4},            // 0001
@@ -822,6 +824,9 @@ TEST_F(TestLsBv, update_cone)
   {
     ASSERT_EQ(d_ls->get_assignment(p.first).compare(p.second), 0);
   }
+
+  /* v3 -> 0001, no change */
+  ASSERT_EQ(update_cone(d_v3, d_one4), 0);
 }
 
 TEST_F(TestLsBv, move_add)
@@ -0,0 +1,88 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <unordered_set>
+
+#include "ls/sparse_set.h"
+#include "test_lib.h"
+
+namespace bzla::ls::test {
+
+/* -------------------------------------------------------------------------- */
+
+class TestSparseSet : public ::bzla::test::TestCommon
+{
+};
+
+TEST_F(TestSparseSet, insert_erase)
+{
+  SparseSet set;
+  ASSERT_TRUE(set.empty());
+  ASSERT_FALSE(set.contains(0));
+  ASSERT_FALSE(set.erase(3));
+
+  ASSERT_TRUE(set.insert(3));
+  ASSERT_TRUE(set.insert(0));
+  ASSERT_TRUE(set.insert(7));
+  ASSERT_FALSE(set.insert(3));
+  ASSERT_EQ(set.size(), 3);
+  ASSERT_TRUE(set.contains(0));
+  ASSERT_TRUE(set.contains(3));
+  ASSERT_TRUE(set.contains(7));
+  ASSERT_FALSE(set.contains(1));
+  ASSERT_FALSE(set.contains(100));
+
+  ASSERT_TRUE(set.erase(3));
+  ASSERT_FALSE(set.erase(3));
+  ASSERT_EQ(set.size(), 2);
+  ASSERT_FALSE(set.contains(3));
+  ASSERT_TRUE(set.contains(0));
+  ASSERT_TRUE(set.contains(7));
+
+  set.clear();
+  ASSERT_TRUE(set.empty());
+  ASSERT_FALSE(set.contains(0));
+  ASSERT_FALSE(set.contains(7));
+  ASSERT_TRUE(set.insert(7));
+  ASSERT_EQ(set[0], 7);
+}
+
+TEST_F(TestSparseSet, random)
+{
+  RNG rng(1234);
+  SparseSet set;
+  std::unordered_set<uint64_t> expected;
+  for (uint32_t i = 0; i < 10000; ++i)
+  {
+    uint64_t id = rng.pick<uint64_t>(0, 200);
+    if (rng.flip_coin())
+    {
+      ASSERT_EQ(set.insert(id), expected.insert(id).second);
+    }
+    else
+    {
+      ASSERT_EQ(set.erase(id), expected.erase(id) > 0);
+    }
+    ASSERT_EQ(set.size(), expected.size());
+    if (i % 100 == 0)
+    {
+      std::unordered_set<uint64_t> elements(set.begin(), set.end());
+      ASSERT_EQ(elements, expected);
+      for (size_t j = 0; j < set.size(); ++j)
+      {
+        ASSERT_TRUE(set.contains(set[j]));
+      }
+    }
+  }
+}
+
+/* -------------------------------------------------------------------------- */
+
+}  // namespace bzla::ls::test
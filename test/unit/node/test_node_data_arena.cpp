@@ -0,0 +1,118 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <vector>
+
+#include "node/node_data_arena.h"
+#include "node/node_manager.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestNodeDataArena : public TestCommon
+{
+};
+
+TEST_F(TestNodeDataArena, size_class)
+{
+  ASSERT_EQ(NodeDataArena::size_class(1), 1);
+  ASSERT_EQ(NodeDataArena::size_class(NodeDataArena::s_granularity), 1);
+  ASSERT_EQ(NodeDataArena::size_class(NodeDataArena::s_granularity + 1), 2);
+  ASSERT_EQ(NodeDataArena::size_class(NodeDataArena::s_max_size),
+            NodeDataArena::s_num_size_classes - 1);
+  ASSERT_EQ(NodeDataArena::size_class(NodeDataArena::s_max_size + 1), 0);
+}
+
+TEST_F(TestNodeDataArena, alloc_dealloc)
+{
+  NodeDataArena arena;
+  std::vector<std::pair<char*, uint16_t>> ptrs;
+  for (size_t size = 1; size <= 2 * NodeDataArena::s_max_size; size += 7)
+  {
+    uint16_t sc = NodeDataArena::size_class(size);
+    char* p     = static_cast<char*>(arena.allocate(sc, size));
+    for (size_t i = 0; i < size; ++i)
+    {
+      ASSERT_EQ(p[i], 0);
+    }
+    std::fill(p, p + size, 1);
+    ptrs.emplace_back(p, sc);
+  }
+  ASSERT_EQ(arena.num_slabs(), 1);
+
+  // Deallocated memory is reused and zero-initialized.
+  auto [p, sc] = ptrs[ptrs.size() / 4];
+  ptrs.erase(ptrs.begin() + ptrs.size() / 4);
+  ASSERT_NE(sc, 0);
+  size_t size = sc * NodeDataArena::s_granularity;
+  arena.deallocate(p, sc);
+  char* q = static_cast<char*>(arena.allocate(sc, size));
+  ASSERT_EQ(p, q);
+  for (size_t i = 0; i < size; ++i)
+  {
+    ASSERT_EQ(q[i], 0);
+  }
+  arena.deallocate(q, sc);
+
+  for (auto [ptr, c] : ptrs)
+  {
+    arena.deallocate(ptr, c);
+  }
+}
+
+TEST_F(TestNodeDataArena, slabs)
+{
+  NodeDataArena arena;
+  size_t size = NodeDataArena::s_max_size;
+  uint16_t sc = NodeDataArena::size_class(size);
+  std::vector<void*> ptrs;
+  for (size_t i = 0, n = 2 * NodeDataArena::s_slab_size / size; i < n; ++i)
+  {
+    ptrs.push_back(arena.allocate(sc, size));
+  }
+  ASSERT_EQ(arena.num_slabs(), 2);
+  for (void* p : ptrs)
+  {
+    arena.deallocate(p, sc);
+  }
+  for (size_t i = 0, n = ptrs.size(); i < n; ++i)
+  {
+    arena.allocate(sc, size);
+  }
+  ASSERT_EQ(arena.num_slabs(), 2);
+}
+
+TEST_F(TestNodeDataArena, node_manager)
+{
+  NodeManager nm;
+  Type bv_type = nm.mk_bv_type(32);
+  Node x       = nm.mk_const(bv_type);
+  Node y       = nm.mk_const(bv_type);
+  {
+    Node a = nm.mk_node(Kind::BV_ADD, {x, y});
+    Node b = nm.mk_node(Kind::BV_MUL, {a, y});
+    ASSERT_EQ(a, nm.mk_node(Kind::BV_ADD, {x, y}));
+    ASSERT_EQ(b[0], a);
+  }
+  // Node data of a and b have been garbage collected, new nodes of the same
+  // size reuse their memory.
+  size_t num_slabs = nm.d_shards[0]->d_arena.num_slabs();
+  for (size_t i = 0; i < 10000; ++i)
+  {
+    Node a = nm.mk_node(Kind::BV_ADD, {x, y});
+    Node b = nm.mk_node(Kind::BV_MUL, {a, y});
+    ASSERT_EQ(b.num_children(), 2);
+  }
+  ASSERT_EQ(nm.d_shards[0]->d_arena.num_slabs(), num_slabs);
+}
+
+}  // namespace bzla::test
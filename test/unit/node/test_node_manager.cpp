@@ -8,6 +8,9 @@
  * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
  */
 
+#include <array>
+#include <thread>
+
 #include "bv/bitvector.h"
 #include "node/node.h"
 #include "node/node_manager.h"
@@ -195,6 +198,45 @@ TEST_F(TestNodeManager, mk_node)
   ASSERT_EQ(or_z, nm.mk_node(Kind::OR, {nm.mk_node(Kind::AND, {x, y}), z}));
 }
 
+TEST_F(TestNodeManager, mk_node_overloads)
+{
+  NodeManager nm;
+
+  Type bool_type = nm.mk_bool_type();
+  Type bv_type   = nm.mk_bv_type(8);
+
+  Node x = nm.mk_const(bool_type);
+  Node a = nm.mk_const(bv_type);
+  Node b = nm.mk_const(bv_type);
+
+  std::vector<Node> children{x, a, b};
+  std::vector<uint64_t> indices{3, 0};
+  std::array<Node, 2> arr{a, b};
+
+  Node not_x = nm.mk_node(Kind::NOT, x);
+  Node add   = nm.mk_node(Kind::BV_ADD, a, b);
+  Node ite   = nm.mk_node(Kind::ITE, x, a, b);
+  Node ext   = nm.mk_node(Kind::BV_EXTRACT, {a}, {3, 0});
+
+  // Fixed-arity, span and braced list overloads create the same nodes.
+  ASSERT_EQ(not_x, nm.mk_node(Kind::NOT, {x}));
+  ASSERT_EQ(add, nm.mk_node(Kind::BV_ADD, {a, b}));
+  ASSERT_EQ(add, nm.mk_node(Kind::BV_ADD, arr));
+  ASSERT_EQ(ite, nm.mk_node(Kind::ITE, children));
+  ASSERT_EQ(ext, nm.mk_node(Kind::BV_EXTRACT, {a}, indices));
+  ASSERT_EQ(ext, nm.mk_node(Kind::BV_EXTRACT, util::Span<Node>(&a, 1), {3, 0}));
+
+  ASSERT_EQ(add.kind(), Kind::BV_ADD);
+  ASSERT_EQ(add[0], a);
+  ASSERT_EQ(add[1], b);
+  ASSERT_EQ(add.type(), bv_type);
+  ASSERT_EQ(ite.type(), bv_type);
+  ASSERT_EQ(ext.type(), nm.mk_bv_type(4));
+  ASSERT_EQ(ext.index(0), 3);
+  ASSERT_EQ(ext.index(1), 0);
+  ASSERT_NE(nm.mk_node(Kind::BV_ADD, b, a), add);
+}
+
 TEST_F(TestNodeManager, mk_apply)
 {
   NodeManager nm;
@@ -414,4 +456,64 @@ TEST_F(TestNodeManager, check_type)
             nm.mk_fun_type({bv_type, fp_type, array_type}));
 }
 
+TEST_F(TestNodeManager, thread_safe)
+{
+  NodeManager nm(true);
+  ASSERT_TRUE(nm.thread_safe());
+  ASSERT_FALSE(NodeManager().thread_safe());
+
+  std::vector<Node> consts;
+  for (uint64_t i = 0; i < 8; ++i)
+  {
+    consts.push_back(nm.mk_const(nm.mk_bv_type(8)));
+  }
+
+  // Concurrently create the same nodes, nodes of all rounds but the last are
+  // garbage collected while other threads look them up.
+  size_t num_threads = 8;
+  std::vector<std::vector<Node>> nodes(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (size_t round = 0; round < 50; ++round)
+      {
+        std::vector<Node> res;
+        for (size_t i = 0; i < consts.size(); ++i)
+        {
+          for (size_t j = 0; j < consts.size(); ++j)
+          {
+            Node add = nm.mk_node(Kind::BV_ADD, consts[i], consts[j]);
+            Node val = nm.mk_value(BitVector::from_ui(8, i * j));
+            Node ext = nm.mk_node(Kind::BV_EXTRACT, {add}, {1 + i % 7, 0});
+            Node zext =
+                nm.mk_node(Kind::BV_ZERO_EXTEND, {ext}, {(i + j + t) % 4});
+            res.push_back(nm.mk_node(Kind::BV_MUL, add, val));
+            res.push_back(zext);
+          }
+        }
+        nodes[t] = std::move(res);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (size_t t = 1; t < num_threads; ++t)
+  {
+    ASSERT_EQ(nodes[t].size(), nodes[0].size());
+    for (size_t i = 0; i < nodes[t].size(); i += 2)
+    {
+      ASSERT_EQ(nodes[t][i], nodes[0][i]);
+      ASSERT_EQ(nodes[t][i + 1][0], nodes[0][i + 1][0]);
+    }
+  }
+  ASSERT_EQ(nm.mk_node(Kind::BV_MUL,
+                       nm.mk_node(Kind::BV_ADD, consts[2], consts[3]),
+                       nm.mk_value(BitVector::from_ui(8, 6))),
+            nodes[0][2 * (2 * consts.size() + 3)]);
+}
+
 }  // namespace bzla::test
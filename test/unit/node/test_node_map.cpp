@@ -0,0 +1,209 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "node/node_id_table.h"
+#include "node/node_manager.h"
+#include "node/node_map.h"
+#include "node/node_set.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestNodeMap : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    Type bv_type = d_nm.mk_bv_type(8);
+    for (size_t i = 0; i < 3000; ++i)
+    {
+      d_nodes.push_back(d_nm.mk_const(bv_type));
+    }
+  }
+
+  NodeManager d_nm;
+  std::vector<Node> d_nodes;
+};
+
+TEST_F(TestNodeMap, map)
+{
+  NodeMap<size_t> map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(map.begin(), map.end());
+
+  for (size_t i = 0; i < d_nodes.size(); i += 2)
+  {
+    auto [it, inserted] = map.emplace(d_nodes[i], i);
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(it->first, d_nodes[i]);
+    ASSERT_EQ(it->second, i);
+  }
+  ASSERT_EQ(map.size(), d_nodes.size() / 2);
+  ASSERT_FALSE(map.emplace(d_nodes[0], 1).second);
+  ASSERT_EQ(map.at(d_nodes[0]), 0);
+
+  for (size_t i = 0; i < d_nodes.size(); ++i)
+  {
+    ASSERT_EQ(map.contains(d_nodes[i]), i % 2 == 0);
+    ASSERT_EQ(map.find(d_nodes[i]) != map.end(), i % 2 == 0);
+  }
+  ASSERT_THROW(map.at(d_nodes[1]), std::out_of_range);
+
+  // References stay valid on insertion.
+  size_t& ref = map.at(d_nodes[2]);
+  map[d_nodes[1]] = 1;
+  ASSERT_EQ(&ref, &map.at(d_nodes[2]));
+
+  // Iteration is in ascending order of node ids.
+  size_t num    = 0;
+  uint64_t prev = 0;
+  for (const auto& [node, value] : map)
+  {
+    ASSERT_LT(prev, node.id());
+    ASSERT_EQ(node, d_nodes[value]);
+    prev = node.id();
+    ++num;
+  }
+  ASSERT_EQ(num, map.size());
+
+  ASSERT_EQ(map.erase(d_nodes[2]), 1);
+  ASSERT_EQ(map.erase(d_nodes[2]), 0);
+  ASSERT_FALSE(map.contains(d_nodes[2]));
+
+  NodeMap<size_t> copy = map;
+  ASSERT_EQ(copy.size(), map.size());
+  ASSERT_EQ(copy.at(d_nodes[1]), 1);
+
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_FALSE(map.contains(d_nodes[0]));
+  ASSERT_EQ(map.begin(), map.end());
+  ASSERT_TRUE(map.emplace(d_nodes[0], 5).second);
+  ASSERT_EQ(map.at(d_nodes[0]), 5);
+  ASSERT_EQ(copy.at(d_nodes[0]), 0);
+}
+
+TEST_F(TestNodeMap, map_owning)
+{
+  NodeMap<Node> map;
+  {
+    Node a = d_nm.mk_const(d_nm.mk_bool_type());
+    map.emplace(a, d_nodes[0]);
+  }
+  // The key is kept alive by the map.
+  auto it = map.begin();
+  ASSERT_NE(it, map.end());
+  ASSERT_TRUE(it->first.type().is_bool());
+  ASSERT_EQ(it->second, d_nodes[0]);
+  map.clear();
+  ASSERT_TRUE(map.empty());
+}
+
+TEST_F(TestNodeMap, ref_map)
+{
+  NodeRefMap<bool> map;
+  for (const Node& n : d_nodes)
+  {
+    map[n] = true;
+  }
+  ASSERT_EQ(map.size(), d_nodes.size());
+  for (size_t i = 0; i < 100; ++i)
+  {
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(d_nodes[i]));
+    map.emplace(d_nodes[i], false);
+    ASSERT_TRUE(map.contains(d_nodes[i]));
+    ASSERT_EQ(map.begin()->first.get(), d_nodes[i]);
+  }
+}
+
+TEST_F(TestNodeMap, id_table_pages)
+{
+  using Table = NodeIdTable<uint64_t>;
+  Table table;
+  uint64_t num_ids = 3 * Table::PAGE_SIZE;
+  for (uint64_t id = 1; id < num_ids; ++id)
+  {
+    table.emplace(id, id);
+  }
+  ASSERT_EQ(table.num_pages(), 3);
+
+  // Pages are freed when their last entry is erased.
+  for (uint64_t id = Table::PAGE_SIZE; id < 2 * Table::PAGE_SIZE; ++id)
+  {
+    ASSERT_TRUE(table.erase(id));
+  }
+  ASSERT_EQ(table.num_pages(), 2);
+  ASSERT_EQ(table.lookup(Table::PAGE_SIZE), nullptr);
+  ASSERT_EQ(*table.lookup(2 * Table::PAGE_SIZE), 2 * Table::PAGE_SIZE);
+  uint64_t prev = 0;
+  for (auto it = table.begin(); it != table.end(); ++it)
+  {
+    ASSERT_TRUE(Table::id(it) < Table::PAGE_SIZE
+                || Table::id(it) >= 2 * Table::PAGE_SIZE);
+    ASSERT_LT(prev, *it);
+    prev = *it;
+  }
+  ASSERT_EQ(prev, num_ids - 1);
+
+  for (uint64_t id = 2 * Table::PAGE_SIZE; id < num_ids; ++id)
+  {
+    ASSERT_TRUE(table.erase(id));
+  }
+  ASSERT_EQ(table.num_pages(), 1);
+  ASSERT_EQ(table.size(), Table::PAGE_SIZE - 1);
+
+  // All pages are freed on clear.
+  table.clear();
+  ASSERT_EQ(table.num_pages(), 0);
+  ASSERT_TRUE(table.empty());
+  ASSERT_EQ(table.begin(), table.end());
+  ASSERT_TRUE(table.emplace(num_ids, 1).second);
+  ASSERT_EQ(table.num_pages(), 1);
+}
+
+TEST_F(TestNodeMap, set)
+{
+  NodeSet<> set;
+  NodeRefSet ref_set;
+  for (const Node& n : d_nodes)
+  {
+    ASSERT_TRUE(set.insert(n).second);
+    ASSERT_TRUE(ref_set.insert(n).second);
+    ASSERT_FALSE(set.insert(n).second);
+    ASSERT_FALSE(ref_set.insert(n).second);
+  }
+  ASSERT_EQ(set.size(), d_nodes.size());
+  ASSERT_EQ(ref_set.size(), d_nodes.size());
+
+  size_t i = 0;
+  for (const Node& n : set)
+  {
+    ASSERT_EQ(n, d_nodes[i++]);
+  }
+  ASSERT_EQ(ref_set.find(d_nodes[7])->get(), d_nodes[7]);
+
+  ASSERT_EQ(set.erase(d_nodes[7]), 1);
+  ASSERT_EQ(set.count(d_nodes[7]), 0);
+  ASSERT_EQ(set.count(d_nodes[8]), 1);
+
+  ref_set.clear();
+  ASSERT_TRUE(ref_set.empty());
+  ASSERT_EQ(ref_set.count(d_nodes[8]), 0);
+  ASSERT_TRUE(ref_set.insert(d_nodes[8]).second);
+  ASSERT_EQ(ref_set.size(), 1);
+}
+
+}  // namespace bzla::test
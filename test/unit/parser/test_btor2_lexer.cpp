@@ -13,6 +13,7 @@
 
 #include "parser/btor2/lexer.h"
 #include "test/unit/test.h"
+#include "util/mapped_file.h"
 
 namespace bzla::test {
 
@@ -42,6 +43,7 @@ class TestBtor2Lexer : public ::testing::Test
     if (!expected_str.empty())
     {
       ASSERT_EQ(lexer.token(), expected_str);
+      ASSERT_EQ(lexer.token_view(), expected_str);
     }
   }
 
@@ -186,4 +188,39 @@ TEST_F(TestBtor2Lexer, formula)
   next_token(lexer, Token::ENDOFFILE);
   infile.close();
 }
+
+TEST_F(TestBtor2Lexer, mapped)
+{
+  std::stringstream input;
+  input << "1 sort bitvec 32" << std::endl
+        << "; foo" << std::endl
+        << "2 input 1 x";
+  std::ifstream infile;
+  open_file(input, infile);
+  infile.close();
+  util::MappedFile mapped;
+  ASSERT_TRUE(mapped.open(s_out_prefix + std::string("lexer.btor2")));
+  ASSERT_EQ(mapped.size(), input.str().size());
+  Lexer lexer;
+  lexer.init(mapped.data(), mapped.size());
+  next_token(lexer, Token::NUMBER_DEC, "1");
+  next_token(lexer, Token::SORT, "sort");
+  next_token(lexer, Token::BITVEC, "bitvec");
+  next_token(lexer, Token::NUMBER_DEC, "32");
+  next_token(lexer, Token::NUMBER_DEC, "2");
+  next_token(lexer, Token::INPUT, "input");
+  next_token(lexer, Token::NUMBER_DEC, "1");
+  next_token(lexer, Token::SYMBOL, "x");
+  // Tokens of mapped input are views into the mapped data.
+  ASSERT_EQ(lexer.token_view().data(), mapped.data() + mapped.size() - 1);
+  next_token(lexer, Token::ENDOFFILE);
+  ASSERT_EQ(lexer.coo().line, 3u);
+
+  // Lexer does not read past the end of the given data.
+  lexer.init("4 input", 3);
+  next_token(lexer, Token::NUMBER_DEC, "4");
+  next_token(lexer, Token::SYMBOL, "i");
+  next_token(lexer, Token::ENDOFFILE);
+}
+
 }  // namespace bzla::test
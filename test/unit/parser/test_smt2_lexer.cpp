@@ -13,6 +13,7 @@
 
 #include "parser/smt2/lexer.h"
 #include "test/unit/test.h"
+#include "util/mapped_file.h"
 
 namespace bzla::test {
 
@@ -320,4 +321,47 @@ TEST_F(TestSmt2Lexer, input2)
   infile.close();
 }
 
+TEST_F(TestSmt2Lexer, mapped)
+{
+  std::stringstream input;
+  input << "(declare-fun a () (_ BitVec 1))" << std::endl
+        << "; foo" << std::endl
+        << "(assert (= a #b1))";
+  std::ifstream infile;
+  open_file(input, infile);
+  infile.close();
+  util::MappedFile mapped;
+  ASSERT_TRUE(mapped.open(s_out_prefix + std::string("lexer.smt2")));
+  ASSERT_EQ(mapped.size(), input.str().size());
+  Lexer lexer;
+  lexer.init(mapped.data(), mapped.size());
+  next_token(lexer, Token::LPAR);
+  next_token(lexer, Token::SYMBOL, "declare-fun");
+  next_token(lexer, Token::SYMBOL, "a");
+  next_token(lexer, Token::LPAR);
+  next_token(lexer, Token::RPAR);
+  next_token(lexer, Token::LPAR);
+  next_token(lexer, Token::UNDERSCORE);
+  next_token(lexer, Token::SYMBOL, "BitVec");
+  next_token(lexer, Token::DECIMAL_VALUE, "1");
+  next_token(lexer, Token::RPAR);
+  next_token(lexer, Token::RPAR);
+  next_token(lexer, Token::LPAR);
+  next_token(lexer, Token::SYMBOL, "assert");
+  next_token(lexer, Token::LPAR);
+  next_token(lexer, Token::SYMBOL, "=");
+  next_token(lexer, Token::SYMBOL, "a");
+  next_token(lexer, Token::BINARY_VALUE, "#b1");
+  next_token(lexer, Token::RPAR);
+  next_token(lexer, Token::RPAR);
+  next_token(lexer, Token::ENDOFFILE);
+  ASSERT_EQ(lexer.coo().line, 3u);
+
+  // Lexer does not read past the end of the given data.
+  lexer.init("(assert", 2);
+  next_token(lexer, Token::LPAR);
+  next_token(lexer, Token::SYMBOL, "a");
+  next_token(lexer, Token::ENDOFFILE);
+}
+
 }  // namespace bzla::test
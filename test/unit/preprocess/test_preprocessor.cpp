@@ -55,4 +55,38 @@ TEST_F(TestPreprocessor, inc2)
   ctx.pop();
 }
 
+TEST_F(TestPreprocessor, inc_caches)
+{
+  SolvingContext ctx(d_nm, d_options);
+
+  Type bv4   = d_nm.mk_bv_type(4);
+  Node x     = d_nm.mk_const(bv4);
+  Node y     = d_nm.mk_const(bv4);
+  Node one   = d_nm.mk_value(BitVector::from_ui(4, 1));
+  Node three = d_nm.mk_value(BitVector::from_ui(4, 3));
+  Node eq1 =
+      d_nm.mk_node(Kind::EQUAL, {d_nm.mk_node(Kind::BV_ADD, {x, y}), one});
+  Node eq2 = d_nm.mk_node(Kind::EQUAL, {x, y});
+
+  ctx.assert_formula(d_nm.mk_node(Kind::DISTINCT, {x, three}));
+  for (size_t i = 0; i < 3; ++i)
+  {
+    // Processed assertions and substitutions of popped levels must not be
+    // kept.
+    ctx.push();
+    ctx.assert_formula(eq1);
+    ctx.assert_formula(eq2);
+    ASSERT_EQ(ctx.solve(), Result::UNSAT);
+    ctx.pop();
+    ctx.push();
+    ctx.assert_formula(eq1);
+    ASSERT_EQ(ctx.solve(), Result::SAT);
+    ctx.pop();
+    ctx.push();
+    ctx.assert_formula(eq2);
+    ASSERT_EQ(ctx.solve(), Result::SAT);
+    ctx.pop();
+  }
+}
+
 }  // namespace bzla::test
@@ -0,0 +1,129 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "env.h"
+#include "gtest/gtest.h"
+#include "node/node_manager.h"
+#include "rewrite/rewrite_cache.h"
+#include "rewrite/rewriter.h"
+
+namespace bzla::test {
+
+using namespace bzla::node;
+
+class TestRewriteCache : public ::testing::Test
+{
+ protected:
+  /** @return A vector of `n` fresh bit-vector constants. */
+  std::vector<Node> mk_consts(size_t n)
+  {
+    std::vector<Node> res;
+    Type bv4 = d_nm.mk_bv_type(4);
+    for (size_t i = 0; i < n; ++i)
+    {
+      res.push_back(d_nm.mk_const(bv4));
+    }
+    return res;
+  }
+
+  NodeManager d_nm;
+  util::Statistics d_stats;
+};
+
+TEST_F(TestRewriteCache, insert_find)
+{
+  RewriteCache cache(d_stats, "cache::");
+  std::vector<Node> nodes = mk_consts(1000);
+  ASSERT_TRUE(cache.empty());
+  ASSERT_EQ(cache.find(nodes[0]), nullptr);
+
+  // Visited, no result yet
+  cache.insert(nodes[0]);
+  ASSERT_NE(cache.find(nodes[0]), nullptr);
+  ASSERT_TRUE(cache.find(nodes[0])->is_null());
+
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    cache.insert(nodes[i], nodes[nodes.size() - i - 1]);
+  }
+  ASSERT_EQ(cache.size(), nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    Node* res = cache.find(nodes[i]);
+    ASSERT_NE(res, nullptr);
+    ASSERT_EQ(*res, nodes[nodes.size() - i - 1]);
+    ASSERT_EQ(cache.at(nodes[i]), *res);
+  }
+  // No memory limit
+  ASSERT_EQ(cache.limit(), 0);
+  ASSERT_EQ(cache.size(), nodes.size());
+
+  cache.clear();
+  ASSERT_TRUE(cache.empty());
+  ASSERT_EQ(cache.find(nodes[0]), nullptr);
+}
+
+TEST_F(TestRewriteCache, limit)
+{
+  RewriteCache cache(d_stats, "cache::", 4096);
+  std::vector<Node> nodes = mk_consts(2000);
+  for (const Node& n : nodes)
+  {
+    cache.insert(n, n);
+  }
+  // Grows beyond the limit on insert
+  ASSERT_EQ(cache.size(), nodes.size());
+  ASSERT_GT(cache.memory(), 4096);
+
+  // Recently used entries survive
+  for (size_t i = 0; i < 10; ++i)
+  {
+    ASSERT_NE(cache.find(nodes[i]), nullptr);
+  }
+  uint64_t evicted = cache.limit();
+  ASSERT_GT(evicted, 0);
+  ASSERT_EQ(cache.size(), nodes.size() - evicted);
+  ASSERT_LE(cache.memory(), 4096);
+  for (size_t i = 0; i < 10; ++i)
+  {
+    Node* res = cache.find(nodes[i]);
+    ASSERT_NE(res, nullptr);
+    ASSERT_EQ(*res, nodes[i]);
+  }
+  ASSERT_EQ(cache.find(nodes[nodes.size() / 2]), nullptr);
+  ASSERT_EQ(cache.limit(), 0);
+}
+
+TEST_F(TestRewriteCache, rewriter_limit)
+{
+  option::Options options;
+  options.rewrite_cache_limit.set(1);
+  Env env(d_nm, options);
+  Rewriter& rw = env.rewriter();
+
+  std::vector<Node> nodes = mk_consts(300);
+  std::vector<Node> terms, rewritten;
+  for (size_t i = 0; i < 60000; ++i)
+  {
+    terms.push_back(d_nm.mk_node(
+        Kind::BV_ADD, {nodes[i % nodes.size()], nodes[i / nodes.size()]}));
+    rewritten.push_back(rw.rewrite(terms.back()));
+  }
+  ASSERT_LE(rw.d_cache.memory(), 1024 * 1024 * 2);
+  // Evicted results are recomputed
+  for (size_t i = 0; i < terms.size(); ++i)
+  {
+    ASSERT_EQ(rw.rewrite(terms[i]), rewritten[i]);
+  }
+  rw.clear_cache();
+  ASSERT_TRUE(rw.d_cache.empty());
+}
+
+}  // namespace bzla::test
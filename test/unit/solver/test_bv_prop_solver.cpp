@@ -410,6 +410,13 @@ TEST_F(TestBvPropSolver, eq) { test_prop(Kind::EQUAL); }
 
 TEST_F(TestBvPropSolver, ite) { test_prop(Kind::ITE); }
 
+TEST_F(TestBvPropSolver, nthreads)
+{
+  d_options.prop_nthreads.set(4);
+  test_prop(Kind::BV_MUL);
+  test_prop(Kind::ITE);
+}
+
 /* -------------------------------------------------------------------------- */
 
 }  // namespace bzla::test
@@ -9,6 +9,7 @@
  */
 
 #include "node/node_manager.h"
+#include "solver/bv/bitblast_cache.h"
 #include "solving_context.h"
 #include "test/unit/test.h"
 
@@ -211,4 +212,215 @@ TEST_F(TestBvSolver, solve1)
   ASSERT_EQ(ctx.solve(), Result::UNSAT);
 }
 
+TEST_F(TestBvSolver, shared_bitblast_cache)
+{
+  NodeManager nm;
+  d_options.shared_bitblast_cache.set(true);
+  d_options.preprocess.set(false);
+
+  Type bv8   = nm.mk_bv_type(8);
+  Node x     = nm.mk_const(bv8);
+  Node y     = nm.mk_const(bv8);
+  Node z     = nm.mk_const(bv8);
+  Node one   = nm.mk_value(BitVector::from_ui(8, 1));
+  Node val   = nm.mk_value(BitVector::from_ui(8, 143));
+  Node x_mul = nm.mk_node(Kind::BV_MUL, {x, y});
+  // Background formula asserted in all contexts.
+  Node bg = nm.mk_node(Kind::AND,
+                       {nm.mk_node(Kind::EQUAL, {x_mul, z}),
+                        nm.mk_node(Kind::BV_ULT, {one, x})});
+  // Cached terms are identified by node id, the rewritten background formula
+  // must be kept alive to be imported in other contexts.
+  Node bg_rewritten;
+  {
+    SolvingContext ctx1 = SolvingContext(nm, d_options);
+    ctx1.assert_formula(bg);
+    ASSERT_EQ(ctx1.solve(), Result::SAT);
+    bg_rewritten = ctx1.rewriter().rewrite(bg);
+  }
+  ASSERT_GT(nm.bitblast_cache().size(), 0);
+
+  SolvingContext ctx2 = SolvingContext(nm, d_options);
+  ctx2.assert_formula(bg);
+  ctx2.assert_formula(nm.mk_node(Kind::EQUAL, {z, val}));
+  ASSERT_EQ(ctx2.solve(), Result::SAT);
+  BitVector xv = ctx2.get_value(x).value<BitVector>();
+  BitVector yv = ctx2.get_value(y).value<BitVector>();
+  ASSERT_EQ(xv.bvmul(yv), val.value<BitVector>());
+  ASSERT_TRUE(one.value<BitVector>().compare(xv) < 0);
+  auto stats = ctx2.env().statistics().get();
+  ASSERT_NE(stats.at("solver::bv::bitblast::cache::num_imports"), "0");
+
+  SolvingContext ctx3 = SolvingContext(nm, d_options);
+  ctx3.assert_formula(bg);
+  ctx3.assert_formula(nm.mk_node(Kind::EQUAL, {y, one}));
+  ctx3.assert_formula(nm.mk_node(Kind::EQUAL, {z, one}));
+  ASSERT_EQ(ctx3.solve(), Result::UNSAT);
+}
+
+TEST_F(TestBvSolver, shared_bitblast_cache_gc)
+{
+  NodeManager nm;
+  d_options.shared_bitblast_cache.set(true);
+  d_options.preprocess.set(false);
+
+  Type bv8 = nm.mk_bv_type(8);
+  Node x   = nm.mk_const(bv8);
+  {
+    Node y   = nm.mk_const(bv8);
+    Node val = nm.mk_value(BitVector::from_ui(8, 143));
+    SolvingContext ctx = SolvingContext(nm, d_options);
+    ctx.assert_formula(
+        nm.mk_node(Kind::EQUAL, {nm.mk_node(Kind::BV_MUL, {x, y}), val}));
+    ASSERT_EQ(ctx.solve(), Result::SAT);
+    ASSERT_EQ(nm.bitblast_cache().size(), 1);
+  }
+  // The cached assertion is erased when it is garbage collected.
+  ASSERT_EQ(nm.bitblast_cache().size(), 0);
+}
+
+TEST_F(TestBvSolver, bitblast_cache_generation)
+{
+  bv::BitblastCache cache(4);
+  uint64_t gen = cache.generation();
+  std::vector<int64_t> vars;
+  ASSERT_TRUE(cache.leaf(gen, 1, 2, vars));
+  int64_t var = cache.mk_and(gen, vars[0], -vars[1]);
+  ASSERT_NE(var, 0);
+  ASSERT_EQ(cache.mk_and(gen, -vars[1], vars[0]), var);
+  ASSERT_TRUE(cache.insert(gen, 2, {var}));
+  ASSERT_TRUE(cache.contains(2));
+  ASSERT_EQ(cache.num_vars(), 4);
+
+  // Erasing entries does not start a new generation below the limit.
+  cache.erase({2});
+  ASSERT_FALSE(cache.contains(2));
+  ASSERT_EQ(cache.generation(), gen);
+
+  ASSERT_NE(cache.mk_and(gen, vars[0], vars[1]), 0);
+  ASSERT_TRUE(cache.insert(gen, 3, {var}));
+  cache.erase({});
+  ASSERT_NE(cache.generation(), gen);
+  ASSERT_EQ(cache.size(), 0);
+  ASSERT_EQ(cache.num_vars(), 1);
+
+  // Variables of the previous generation are outdated.
+  bv::BitblastCache::Cone cone;
+  ASSERT_FALSE(cache.find(gen, 3, cone));
+  ASSERT_FALSE(cache.leaf(gen, 1, 2, vars));
+  ASSERT_EQ(cache.mk_and(gen, vars[0], vars[1]), 0);
+  ASSERT_FALSE(cache.insert(gen, 3, {var}));
+}
+
+TEST_F(TestBvSolver, fraig)
+{
+  NodeManager nm;
+  d_options.fraig.set(true);
+  d_options.rewrite_level.set(0);
+
+  Type bv8 = nm.mk_bv_type(8);
+  Node x   = nm.mk_const(bv8);
+  Node y   = nm.mk_const(bv8);
+  Node one = nm.mk_value(BitVector::from_ui(8, 1));
+  // x + y = (x ^ y) + ((x & y) << 1)
+  Node add1 = nm.mk_node(Kind::BV_ADD, {x, y});
+  Node add2 = nm.mk_node(
+      Kind::BV_ADD,
+      {nm.mk_node(Kind::BV_XOR, {x, y}),
+       nm.mk_node(Kind::BV_SHL, {nm.mk_node(Kind::BV_AND, {x, y}), one})});
+  {
+    SolvingContext ctx = SolvingContext(nm, d_options);
+    ctx.assert_formula(nm.mk_node(Kind::DISTINCT, {add1, add2}));
+    ASSERT_EQ(ctx.solve(), Result::UNSAT);
+    auto stats = ctx.env().statistics().get();
+    ASSERT_NE(stats.at("solver::bv::bitblast::fraig::num_merges"), "0");
+  }
+  {
+    SolvingContext ctx = SolvingContext(nm, d_options);
+    Node add3 = nm.mk_node(Kind::BV_ADD, {add1, one});
+    ctx.assert_formula(nm.mk_node(Kind::DISTINCT, {add3, add2}));
+    ASSERT_EQ(ctx.solve(), Result::SAT);
+    BitVector xv = ctx.get_value(x).value<BitVector>();
+    BitVector yv = ctx.get_value(y).value<BitVector>();
+    ASSERT_NE(xv.bvadd(yv).ibvinc(),
+              xv.bvxor(yv).ibvadd(xv.bvand(yv).ibvshl(1)));
+  }
+}
+
+TEST_F(TestBvSolver, scoped_bitblast)
+{
+  NodeManager nm;
+  d_options.scoped_bitblast.set(true);
+
+  Type bv8 = nm.mk_bv_type(8);
+  Node x   = nm.mk_const(bv8);
+  Node y   = nm.mk_const(bv8);
+  Node mul = nm.mk_node(Kind::BV_MUL, {x, y});
+
+  SolvingContext ctx = SolvingContext(nm, d_options);
+  ctx.assert_formula(nm.mk_node(Kind::BV_ULT, {x, y}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  auto stats           = ctx.env().statistics().get();
+  std::string num_ands = stats.at("solver::bv::bitblast::aig::num_ands");
+
+  for (uint64_t i = 0; i < 3; ++i)
+  {
+    ctx.push();
+    Node val = nm.mk_value(BitVector::from_ui(8, 143 + i));
+    ctx.assert_formula(nm.mk_node(Kind::EQUAL, {mul, val}));
+    ASSERT_EQ(ctx.solve(), Result::SAT);
+    BitVector xv = ctx.get_value(x).value<BitVector>();
+    BitVector yv = ctx.get_value(y).value<BitVector>();
+    ASSERT_EQ(xv.bvmul(yv), val.value<BitVector>());
+    ASSERT_TRUE(xv.compare(yv) < 0);
+    ctx.pop();
+    // The multiplier is released on pop.
+    stats = ctx.env().statistics().get();
+    ASSERT_EQ(stats.at("solver::bv::bitblast::aig::num_ands"), num_ands);
+  }
+
+  ctx.assert_formula(nm.mk_node(Kind::BV_ULT, {y, x}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
+
+TEST_F(TestBvSolver, scoped_bitblast_shared_cache)
+{
+  NodeManager nm;
+  d_options.scoped_bitblast.set(true);
+  d_options.shared_bitblast_cache.set(true);
+  d_options.preprocess.set(false);
+
+  Type bv8 = nm.mk_bv_type(8);
+  Node x   = nm.mk_const(bv8);
+  Node y   = nm.mk_const(bv8);
+  Node one = nm.mk_value(BitVector::from_ui(8, 1));
+  Node val = nm.mk_value(BitVector::from_ui(8, 143));
+  Node eq  = nm.mk_node(Kind::EQUAL, {nm.mk_node(Kind::BV_MUL, {x, y}), val});
+
+  SolvingContext ctx = SolvingContext(nm, d_options);
+  // The leaves x and y are bit-blasted and mapped to the shared cache within
+  // the scope, and released on pop.
+  ctx.push();
+  ctx.assert_formula(eq);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ctx.pop();
+
+  // The assertion is imported from the shared cache, the leaves are mapped
+  // again with their new bits.
+  ctx.assert_formula(eq);
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  auto stats = ctx.env().statistics().get();
+  ASSERT_NE(stats.at("solver::bv::bitblast::cache::num_imports"), "0");
+  BitVector xv = ctx.get_value(x).value<BitVector>();
+  BitVector yv = ctx.get_value(y).value<BitVector>();
+  ASSERT_EQ(xv.bvmul(yv), val.value<BitVector>());
+
+  ctx.assert_formula(nm.mk_node(Kind::EQUAL, {x, one}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(ctx.get_value(y), val);
+
+  ctx.assert_formula(nm.mk_node(Kind::EQUAL, {y, one}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
+
 }  // namespace bzla::test
@@ -0,0 +1,76 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * Copyright (C) 2023 by the authors listed in the AUTHORS file at
+ * https://github.com/bitwuzla/bitwuzla/blob/main/AUTHORS
+ *
+ * This file is part of Bitwuzla under the MIT license. See COPYING for more
+ * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
+ */
+
+#include "node/node_manager.h"
+#include "solving_context.h"
+#include "test/unit/test.h"
+
+namespace bzla::test {
+
+using namespace node;
+
+class TestCubeAndConquer : public TestCommon
+{
+ protected:
+  void SetUp() override
+  {
+    TestCommon::SetUp();
+    d_options.cube_depth.set(4);
+    d_options.nthreads.set(3);
+    d_options.produce_models.set(true);
+    d_options.rewrite_level.set(0);
+  }
+
+  option::Options d_options;
+  NodeManager d_nm;
+};
+
+TEST_F(TestCubeAndConquer, mul_comm)
+{
+  Type bv8 = d_nm.mk_bv_type(8);
+  Node x   = d_nm.mk_const(bv8, "x");
+  Node y   = d_nm.mk_const(bv8, "y");
+  SolvingContext ctx(d_nm, d_options);
+  ctx.assert_formula(
+      d_nm.mk_node(Kind::DISTINCT,
+                   {d_nm.mk_node(Kind::BV_MUL, {x, y}),
+                    d_nm.mk_node(Kind::BV_MUL, {y, x})}));
+  ASSERT_EQ(ctx.solve(), Result::UNSAT);
+}
+
+TEST_F(TestCubeAndConquer, factor)
+{
+  Type bv8  = d_nm.mk_bv_type(8);
+  Node x    = d_nm.mk_const(bv8, "x");
+  Node y    = d_nm.mk_const(bv8, "y");
+  Node one  = d_nm.mk_value(BitVector::mk_one(8));
+  Node prod = d_nm.mk_value(BitVector::from_ui(8, 143));
+  SolvingContext ctx(d_nm, d_options);
+  ctx.assert_formula(d_nm.mk_node(
+      Kind::EQUAL, {d_nm.mk_node(Kind::BV_MUL, {x, y}), prod}));
+  ctx.assert_formula(d_nm.mk_node(Kind::BV_UGT, {x, one}));
+  ctx.assert_formula(d_nm.mk_node(Kind::BV_UGT, {y, one}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  const BitVector& vx = ctx.get_value(x).value<BitVector>();
+  const BitVector& vy = ctx.get_value(y).value<BitVector>();
+  ASSERT_EQ(vx.bvmul(vy), prod.value<BitVector>());
+
+  // Incremental: exclude the found model.
+  ctx.push();
+  ctx.assert_formula(d_nm.mk_node(
+      Kind::NOT, {d_nm.mk_node(Kind::EQUAL, {x, d_nm.mk_value(vx)})}));
+  ASSERT_EQ(ctx.solve(), Result::SAT);
+  ASSERT_EQ(ctx.get_value(x).value<BitVector>().bvmul(
+                ctx.get_value(y).value<BitVector>()),
+            prod.value<BitVector>());
+  ctx.pop();
+}
+
+}  // namespace bzla::test
@@ -77,4 +77,39 @@ TEST_F(TestFunSolver, fc2)
   ASSERT_EQ(ctx.solve(), Result::UNSAT);
 }
 
+TEST_F(TestFunSolver, lemmas_in_search)
+{
+  // f(x_i) = i for n applications with x_i < bound requires n distinct values
+  // of x_i, which is unsatisfiable for bound < n.
+  uint64_t n = 6;
+  for (uint64_t bound : {n - 1, n})
+  {
+    Result expected = bound < n ? Result::UNSAT : Result::SAT;
+    uint64_t num_rounds[2];
+    for (bool in_search : {false, true})
+    {
+      NodeManager nm;
+      option::Options options;
+      options.lemmas_in_search.set(in_search);
+      SolvingContext ctx(nm, options);
+
+      Type bv_type = nm.mk_bv_type(4);
+      Node f       = nm.mk_const(nm.mk_fun_type({bv_type, bv_type}));
+      Node max     = nm.mk_value(BitVector::from_ui(4, bound));
+      for (uint64_t i = 0; i < n; ++i)
+      {
+        Node x   = nm.mk_const(bv_type);
+        Node f_x = nm.mk_node(Kind::APPLY, {f, x});
+        ctx.assert_formula(nm.mk_node(
+            Kind::EQUAL, {f_x, nm.mk_value(BitVector::from_ui(4, i))}));
+        ctx.assert_formula(nm.mk_node(Kind::BV_ULT, {x, max}));
+      }
+      ASSERT_EQ(ctx.solve(), expected);
+      auto stats = ctx.env().statistics().get();
+      num_rounds[in_search] = std::stoull(stats.at("solver::bv::num_checks"));
+    }
+    ASSERT_LT(num_rounds[1], num_rounds[0]);
+  }
+}
+
 }
@@ -9,6 +9,7 @@
  */
 
 #include "node/node_manager.h"
+#include "solver/quant/mbqi_worker.h"
 #include "solving_context.h"
 #include "test/unit/test.h"
 
@@ -224,4 +225,57 @@ TEST_F(TestIncremental, lemmas_on_demand1)
   ctx.pop();
   ASSERT_EQ(ctx.solve(), Result::SAT);
 }
+
+TEST_F(TestIncremental, mbqi1)
+{
+  NodeManager nm;
+  option::Options options;
+  SolvingContext ctx = SolvingContext(nm, options);
+
+  Type type   = nm.mk_bv_type(8);
+  Node a      = nm.mk_const(type, "a");
+  Node b      = nm.mk_const(type, "b");
+  Node x      = nm.mk_var(type, "x");
+  Node three  = nm.mk_value(BitVector::from_ui(8, 3));
+  Node ult    = nm.mk_node(Kind::BV_ULT, {x, a});
+  Node mul    = nm.mk_node(Kind::BV_MUL, {x, three});
+  Node body   = nm.mk_node(Kind::IMPLIES,
+                           {ult, nm.mk_node(Kind::BV_ULT, {mul, b})});
+  Node forall = nm.mk_node(Kind::FORALL, {x, body});
+
+  ctx.assert_formula(forall);
+  ctx.assert_formula(
+      nm.mk_node(Kind::BV_UGT, {a, nm.mk_value(BitVector::from_ui(8, 5))}));
+
+  // The MBQI instance is asserted once, the model of each check is asserted
+  // in a scope that is removed at the end of the check.
+  const auto& quant_solver = ctx.d_solver_engine.d_quant_solver;
+  auto check               = [&](Result expected) {
+    ASSERT_EQ(ctx.solve(), expected);
+    ASSERT_EQ(quant_solver.d_mbqi_workers.size(), 1u);
+    const auto& worker = quant_solver.d_mbqi_workers[0];
+    ASSERT_EQ(worker->d_active.size(), 1u);
+    ASSERT_TRUE(worker->d_pending.empty());
+    ASSERT_EQ(worker->d_ctx->backtrack_mgr()->num_levels(), 0u);
+    ASSERT_EQ(worker->d_ctx->d_original_assertions.size(), 1u);
+  };
+
+  check(Result::SAT);
+  ASSERT_GT(quant_solver.d_stats.mbqi_checks, 1u);
+
+  ctx.push();
+  ctx.assert_formula(
+      nm.mk_node(Kind::BV_ULT, {b, nm.mk_value(BitVector::from_ui(8, 8))}));
+  check(Result::UNSAT);
+  ctx.pop();
+
+  // The instance of the popped check is still valid.
+  check(Result::SAT);
+
+  ctx.push();
+  ctx.assert_formula(
+      nm.mk_node(Kind::EQUAL, {b, nm.mk_value(BitVector::from_ui(8, 255))}));
+  check(Result::SAT);
+  ctx.pop();
+}
 }  // namespace bzla::test
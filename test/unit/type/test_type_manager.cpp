@@ -8,6 +8,7 @@
  * information at https://github.com/bitwuzla/bitwuzla/blob/main/COPYING
  */
 
+#include <thread>
 #include <unordered_set>
 
 #include "test/unit/test.h"
@@ -180,4 +181,41 @@ TEST_F(TestTypeManager, hash_type)
   ASSERT_FALSE(set.count(bool_type) > 0);
 }
 
+TEST_F(TestTypeManager, thread_safe)
+{
+  TypeManager tm(true);
+  ASSERT_TRUE(tm.thread_safe());
+
+  // Concurrently create and release the same types.
+  size_t num_threads = 8;
+  std::vector<std::vector<Type>> types(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (size_t round = 0; round < 100; ++round)
+      {
+        std::vector<Type> res;
+        for (uint64_t size = 1; size <= 16; ++size)
+        {
+          Type bv = tm.mk_bv_type(size);
+          res.push_back(tm.mk_array_type(bv, tm.mk_bool_type()));
+          res.push_back(tm.mk_fun_type({bv, bv, tm.mk_fp_type(5, size + 1)}));
+        }
+        types[t] = std::move(res);
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (size_t t = 1; t < num_threads; ++t)
+  {
+    ASSERT_EQ(types[t], types[0]);
+  }
+  ASSERT_EQ(types[0][0], tm.mk_array_type(tm.mk_bv_type(1), tm.mk_bool_type()));
+}
+
 }  // namespace bzla::test